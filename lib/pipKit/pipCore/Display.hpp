@@ -23,5 +23,8 @@ namespace pipcore
                                   int16_t h,
                                   const uint16_t *pixels,
                                   int32_t stridePixels) = 0;
+
+        virtual void beginBatch() {}
+        virtual void endBatch() {}
     };
 }
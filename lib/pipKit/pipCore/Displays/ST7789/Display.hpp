@@ -53,6 +53,9 @@ namespace pipcore::st7789
                           const uint16_t *pixels,
                           int32_t stridePixels) override;
 
+        void beginBatch() override { (void)_drv.beginBatch(); }
+        void endBatch() override { (void)_drv.endBatch(); }
+
     private:
         pipcore::Platform *_platform = nullptr;
         Driver _drv;
@@ -443,4 +443,25 @@ namespace pipcore::st7789
 
         return flushTransport();
     }
+
+    bool Driver::beginBatch()
+    {
+        if (!_transport || !_initialized)
+        {
+            _lastError = IoError::NotReady;
+            return false;
+        }
+        if (_transport->beginBatch())
+            return true;
+        return failFromTransport(IoError::QueueTransmit);
+    }
+
+    bool Driver::endBatch()
+    {
+        if (!_transport)
+            return failFromTransport(IoError::NotReady);
+        if (_transport->endBatch())
+            return true;
+        return failFromTransport(IoError::QueueResult);
+    }
 }
@@ -40,6 +40,8 @@ namespace pipcore::st7789
         [[nodiscard]] virtual bool acquireBus() = 0;
         virtual void releaseBus() = 0;
         [[nodiscard]] virtual bool flush() = 0;
+        [[nodiscard]] virtual bool beginBatch() { return true; }
+        [[nodiscard]] virtual bool endBatch() { return flush(); }
     };
 
     class Driver
@@ -72,6 +74,9 @@ namespace pipcore::st7789
 
         [[nodiscard]] bool fillScreen565(uint16_t color565, bool swapBytes = false);
 
+        [[nodiscard]] bool beginBatch();
+        [[nodiscard]] bool endBatch();
+
         void setInversion(bool enabled);
 
     private:
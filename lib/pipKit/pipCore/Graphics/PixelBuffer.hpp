@@ -0,0 +1,69 @@
+#pragma once
+
+#include <pipCore/Graphics/PixelFormat.hpp>
+#include <pipCore/Platform.hpp>
+
+namespace pipcore
+{
+    // Owned w x h pixel storage in any PixelFormat; the light-weight sibling of Sprite for
+    // offscreen coverage and mask buffers (no bands, no clip, no display path).
+    template <typename Format>
+    class PixelBuffer
+    {
+    public:
+        using Pixel = typename Format::Pixel;
+
+        PixelBuffer() = default;
+        explicit PixelBuffer(Platform *platform) noexcept
+            : _platform(platform)
+        {
+        }
+        ~PixelBuffer() { release(); }
+
+        PixelBuffer(const PixelBuffer &) = delete;
+        PixelBuffer &operator=(const PixelBuffer &) = delete;
+
+        void setPlatform(Platform *platform) noexcept { _platform = platform; }
+
+        [[nodiscard]] bool create(int16_t w, int16_t h, AllocCaps caps = AllocCaps::Default)
+        {
+            release();
+            if (w <= 0 || h <= 0 || !_platform)
+                return false;
+            const size_t stride = Format::rowBytes(w);
+            _mem = static_cast<uint8_t *>(_platform->alloc(stride * (size_t)h, caps));
+            if (!_mem)
+                return false;
+            _w = w;
+            _h = h;
+            _stride = stride;
+            return true;
+        }
+
+        void release() noexcept
+        {
+            if (_mem && _platform)
+                _platform->free(_mem);
+            _mem = nullptr;
+            _w = _h = 0;
+            _stride = 0;
+        }
+
+        [[nodiscard]] int16_t width() const noexcept { return _w; }
+        [[nodiscard]] int16_t height() const noexcept { return _h; }
+        [[nodiscard]] size_t bytes() const noexcept { return _stride * (size_t)_h; }
+
+        [[nodiscard]] uint8_t *row(int16_t y) noexcept { return _mem + _stride * (size_t)y; }
+        [[nodiscard]] const uint8_t *row(int16_t y) const noexcept { return _mem + _stride * (size_t)y; }
+
+    private:
+        Platform *_platform = nullptr;
+        uint8_t *_mem = nullptr;
+        size_t _stride = 0;
+        int16_t _w = 0;
+        int16_t _h = 0;
+    };
+
+    using CoverageBuffer = PixelBuffer<PixelGray8>;
+    using MaskBuffer = PixelBuffer<PixelMask1>;
+}
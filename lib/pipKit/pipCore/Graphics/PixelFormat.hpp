@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace pipcore
+{
+    // Formats of the alpha-only buffers behind GUI::beginAlphaLayer(). Every format stores whole
+    // rows of rowBytes(w) bytes and converts from the RGB565 pass the layer was drawn in, so
+    // PixelBuffer and the layer paths are written once and instantiated per format.
+
+    // 8-bit coverage: half the memory of RGB565, blended per pixel.
+    struct PixelGray8
+    {
+        using Pixel = uint8_t;
+
+        [[nodiscard]] static constexpr size_t rowBytes(int16_t w) noexcept { return (size_t)w; }
+
+        // Rec. 601 luma of the expanded 8-bit channels; white drawn on black reads back as its
+        // coverage.
+        [[nodiscard]] static constexpr Pixel fromRgb565(uint16_t c) noexcept
+        {
+            const uint32_t r = ((c >> 8) & 0xF8u) | (c >> 13);
+            const uint32_t g = ((c >> 3) & 0xFCu) | ((c >> 9) & 0x03u);
+            const uint32_t b = ((c << 3) & 0xF8u) | ((c >> 2) & 0x07u);
+            return (Pixel)((r * 77u + g * 150u + b * 29u) >> 8);
+        }
+
+        [[nodiscard]] static inline Pixel load(const uint8_t *row, int32_t x) noexcept { return row[x]; }
+        static inline void store(uint8_t *row, int32_t x, Pixel p) noexcept { row[x] = p; }
+    };
+
+    // 1-bpp mask, MSB first: 1/16 of RGB565, for hard-edged layers.
+    struct PixelMask1
+    {
+        using Pixel = uint8_t;
+
+        [[nodiscard]] static constexpr size_t rowBytes(int16_t w) noexcept { return ((size_t)w + 7u) >> 3; }
+
+        [[nodiscard]] static constexpr Pixel fromRgb565(uint16_t c) noexcept
+        {
+            return PixelGray8::fromRgb565(c) >= 128 ? 1 : 0;
+        }
+
+        [[nodiscard]] static inline Pixel load(const uint8_t *row, int32_t x) noexcept
+        {
+            return (uint8_t)((row[x >> 3] >> (7 - (x & 7))) & 1u);
+        }
+        static inline void store(uint8_t *row, int32_t x, Pixel p) noexcept
+        {
+            const uint8_t bit = (uint8_t)(0x80u >> (x & 7));
+            if (p)
+                row[x >> 3] |= bit;
+            else
+                row[x >> 3] &= (uint8_t)~bit;
+        }
+    };
+}
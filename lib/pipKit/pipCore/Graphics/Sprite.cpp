@@ -9,40 +9,128 @@ namespace pipcore
     Sprite::~Sprite() { deleteSprite(); }
 
     bool Sprite::createSprite(int16_t w, int16_t h)
+    {
+        return createBand(w, h, h);
+    }
+
+    bool Sprite::createBand(int16_t w, int16_t h, int16_t lines)
     {
         deleteSprite();
-        if (w <= 0 || h <= 0)
+        if (w <= 0 || h <= 0 || lines <= 0)
             return false;
+        if (lines > h)
+            lines = h;
 
         if (Platform *const plat = platform(); !plat)
             return false;
         else
         {
-            const size_t pixels = static_cast<size_t>(w) * static_cast<size_t>(h);
+            const size_t pixels = static_cast<size_t>(w) * static_cast<size_t>(lines);
             if (pixels > SIZE_MAX / sizeof(uint16_t))
                 return false;
-            _buf = static_cast<uint16_t *>(plat->alloc(pixels * sizeof(uint16_t), AllocCaps::Default));
+            _mem = static_cast<uint16_t *>(plat->alloc(pixels * sizeof(uint16_t), AllocCaps::Default));
         }
-        if (!_buf)
+        if (!_mem)
             return false;
 
+        _buf = _mem;
         _w = w;
         _h = h;
+        _bandY = 0;
+        _bandH = lines;
         _clipX = _clipY = 0;
         _clipW = w;
-        _clipH = h;
+        _clipH = lines;
         return true;
     }
 
     void Sprite::deleteSprite()
     {
-        if (_buf)
+        freeHotBand();
+        if (_mem)
+        {
+            if (Platform *const plat = platform(); plat)
+                plat->free(_mem);
+            _mem = nullptr;
+        }
+        _buf = nullptr;
+        _w = _h = _bandY = _bandH = _clipX = _clipY = _clipW = _clipH = 0;
+    }
+
+    void Sprite::setBandOrigin(int16_t y)
+    {
+        if (!_mem)
+            return;
+
+        _bandY = clampi16(y, 0, static_cast<int16_t>(_h - _bandH));
+        clipNormalize();
+    }
+
+    bool Sprite::createHotBand(int16_t lines)
+    {
+        freeHotBand();
+        if (!_mem || banded() || lines <= 0)
+            return false;
+        if (lines > _h)
+            lines = _h;
+
+        Platform *const plat = platform();
+        if (!plat)
+            return false;
+
+        const size_t bytes = static_cast<size_t>(_w) * static_cast<size_t>(lines) * sizeof(uint16_t);
+        auto *hot = static_cast<uint16_t *>(plat->alloc(bytes, AllocCaps::PreferInternal));
+        if (!hot)
+            return false;
+        if (!plat->isInternal(hot))
+        {
+            plat->free(hot);
+            return false;
+        }
+
+        _hot = hot;
+        _hotCap = lines;
+        return true;
+    }
+
+    void Sprite::freeHotBand()
+    {
+        endHot();
+        if (_hot)
         {
             if (Platform *const plat = platform(); plat)
-                plat->free(_buf);
-            _buf = nullptr;
+                plat->free(_hot);
+            _hot = nullptr;
         }
-        _w = _h = _clipX = _clipY = _clipW = _clipH = 0;
+        _hotCap = 0;
+    }
+
+    void Sprite::beginHot(int16_t y, int16_t lines)
+    {
+        if (!_hot || _hotH)
+            return;
+
+        y = clampi16(y, 0, static_cast<int16_t>(_h - 1));
+        lines = std::min<int16_t>(lines, std::min<int16_t>(_hotCap, static_cast<int16_t>(_h - y)));
+        if (lines <= 0)
+            return;
+
+        std::memcpy(_hot, _mem + static_cast<size_t>(y) * _w, static_cast<size_t>(_w) * lines * sizeof(uint16_t));
+        _hotY = y;
+        _hotH = lines;
+        _buf = _hot;
+        clipNormalize();
+    }
+
+    void Sprite::endHot()
+    {
+        if (!_hotH)
+            return;
+
+        std::memcpy(_mem + static_cast<size_t>(_hotY) * _w, _hot, static_cast<size_t>(_w) * _hotH * sizeof(uint16_t));
+        _buf = _mem;
+        _hotY = 0;
+        _hotH = 0;
     }
 
     void Sprite::clipNormalize()
@@ -54,9 +142,9 @@ namespace pipcore
         }
 
         const int32_t x1 = std::max<int32_t>(0, _clipX);
-        const int32_t y1 = std::max<int32_t>(0, _clipY);
+        const int32_t y1 = std::max<int32_t>(rowsY(), _clipY);
         const int32_t x2 = std::min<int32_t>(_w, static_cast<int32_t>(_clipX) + std::max<int32_t>(0, _clipW));
-        const int32_t y2 = std::min<int32_t>(_h, static_cast<int32_t>(_clipY) + std::max<int32_t>(0, _clipH));
+        const int32_t y2 = std::min<int32_t>(static_cast<int32_t>(rowsY()) + rowsH(), static_cast<int32_t>(_clipY) + std::max<int32_t>(0, _clipH));
 
         _clipX = static_cast<int16_t>(x1);
         _clipY = static_cast<int16_t>(y1);
@@ -119,8 +207,8 @@ namespace pipcore
         {
             if (contiguous)
             {
-                memmove(dst->_buf + static_cast<size_t>(y1) * dst->_w,
-                        _buf + static_cast<size_t>(srcY) * _w,
+                memmove(dst->rowPtr(y1),
+                        rowPtr(srcY),
                         static_cast<size_t>(ch) * bytes);
                 return;
             }
@@ -135,8 +223,8 @@ namespace pipcore
             {
                 for (int32_t row = ch - 1; row >= 0; --row)
                 {
-                    uint16_t *dstRow = dst->_buf + (static_cast<size_t>(y1 + row) * dst->_w + x1);
-                    const uint16_t *srcRow = _buf + (static_cast<size_t>(srcY + row) * _w + srcX);
+                    uint16_t *dstRow = dst->rowPtr(y1 + row) + x1;
+                    const uint16_t *srcRow = rowPtr(srcY + row) + srcX;
                     memmove(dstRow, srcRow, bytes);
                 }
                 return;
@@ -144,8 +232,8 @@ namespace pipcore
 
             for (int32_t row = 0; row < ch; ++row)
             {
-                uint16_t *dstRow = dst->_buf + (static_cast<size_t>(y1 + row) * dst->_w + x1);
-                const uint16_t *srcRow = _buf + (static_cast<size_t>(srcY + row) * _w + srcX);
+                uint16_t *dstRow = dst->rowPtr(y1 + row) + x1;
+                const uint16_t *srcRow = rowPtr(srcY + row) + srcX;
                 memmove(dstRow, srcRow, bytes);
             }
             return;
@@ -153,14 +241,14 @@ namespace pipcore
 
         if (contiguous)
         {
-            memcpy(dst->_buf + static_cast<size_t>(y1) * dst->_w,
-                   _buf + static_cast<size_t>(srcY) * _w,
+            memcpy(dst->rowPtr(y1),
+                   rowPtr(srcY),
                    static_cast<size_t>(ch) * bytes);
             return;
         }
 
-        const uint16_t *src = _buf + (static_cast<size_t>(srcY) * _w + srcX);
-        uint16_t *dst_ = dst->_buf + (static_cast<size_t>(y1) * dst->_w + x1);
+        const uint16_t *src = rowPtr(srcY) + srcX;
+        uint16_t *dst_ = dst->rowPtr(y1) + x1;
 
         for (int32_t row = 0; row < ch; ++row)
         {
@@ -189,7 +277,7 @@ namespace pipcore
                              static_cast<int16_t>(y1),
                              static_cast<int16_t>(cw),
                              static_cast<int16_t>(ch),
-                             _buf + (static_cast<size_t>(y1) * _w + x1),
+                             rowPtr(y1) + x1,
                              _w);
     }
 }
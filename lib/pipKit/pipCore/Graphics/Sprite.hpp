@@ -22,14 +22,29 @@ namespace pipcore
         Sprite &operator=(const Sprite &) = delete;
 
         [[nodiscard]] bool createSprite(int16_t w, int16_t h);
+        [[nodiscard]] bool createBand(int16_t w, int16_t h, int16_t lines);
         void deleteSprite();
 
         [[nodiscard]] int16_t width() const noexcept { return _w; }
         [[nodiscard]] int16_t height() const noexcept { return _h; }
+
+        [[nodiscard]] bool banded() const noexcept { return _bandH < _h; }
+        [[nodiscard]] int16_t bandY() const noexcept { return _bandY; }
+        [[nodiscard]] int16_t bandLines() const noexcept { return _bandH; }
+        void setBandOrigin(int16_t y);
+
+        [[nodiscard]] bool createHotBand(int16_t lines);
+        [[nodiscard]] bool hotBand() const noexcept { return _hot != nullptr; }
+        [[nodiscard]] int16_t hotLines() const noexcept { return _hotCap; }
+        void beginHot(int16_t y, int16_t lines);
+        void endHot();
         void setPlatform(Platform *platform) noexcept { _platform = platform; }
 
+        // getBuffer() holds only the rows from bufferY() on: the band, or the hot rows while they
+        // are active. Row y of the sprite is at (y - bufferY()) * width().
         [[nodiscard]] void *getBuffer() noexcept { return _buf; }
         [[nodiscard]] const void *getBuffer() const noexcept { return _buf; }
+        [[nodiscard]] int16_t bufferY() const noexcept { return rowsY(); }
 
         void fillScreen(uint16_t color565);
         void drawPixel(int16_t x, int16_t y, uint16_t color565);
@@ -85,6 +100,10 @@ namespace pipcore
     private:
         [[nodiscard]] Platform *platform() const noexcept { return _platform; }
         void clipNormalize();
+        void freeHotBand();
+        [[nodiscard]] int16_t rowsY() const noexcept { return _hotH ? _hotY : _bandY; }
+        [[nodiscard]] int16_t rowsH() const noexcept { return _hotH ? _hotH : _bandH; }
+        [[nodiscard]] uint16_t *rowPtr(int32_t y) const noexcept { return _buf + static_cast<ptrdiff_t>(y - rowsY()) * _w; }
         inline void fillRow(uint16_t *dst, int16_t w, uint16_t v);
 
         [[nodiscard]] static constexpr int16_t clampi16(int16_t v, int16_t lo, int16_t hi) noexcept
@@ -94,9 +113,17 @@ namespace pipcore
 
     private:
         Platform *_platform = nullptr;
+        uint16_t *_mem = nullptr;
         uint16_t *_buf = nullptr;
         int16_t _w = 0;
         int16_t _h = 0;
+        int16_t _bandY = 0;
+        int16_t _bandH = 0;
+
+        uint16_t *_hot = nullptr;
+        int16_t _hotCap = 0;
+        int16_t _hotY = 0;
+        int16_t _hotH = 0;
 
         int16_t _clipX = 0;
         int16_t _clipY = 0;
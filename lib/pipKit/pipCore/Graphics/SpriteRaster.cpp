@@ -88,10 +88,10 @@ namespace pipcore
 
     void Sprite::fillScreen(uint16_t color565)
     {
-        if (!_buf || _w <= 0 || _h <= 0)
+        if (!_mem || _w <= 0 || rowsH() <= 0)
             return;
 
-        fillSwapped565(_buf, static_cast<size_t>(_w) * static_cast<size_t>(_h), swap16(color565));
+        fillSwapped565(_buf, static_cast<size_t>(_w) * static_cast<size_t>(rowsH()), swap16(color565));
     }
 
     void Sprite::drawPixel(int16_t x, int16_t y, uint16_t color565)
@@ -99,7 +99,7 @@ namespace pipcore
         if (((uint16_t)(x - _clipX) >= (uint16_t)_clipW) |
             ((uint16_t)(y - _clipY) >= (uint16_t)_clipH))
             return;
-        *(_buf + y * _w + x) = __builtin_bswap16(color565);
+        *(rowPtr(y) + x) = __builtin_bswap16(color565);
     }
 
     inline void Sprite::fillRow(uint16_t *dst, int16_t w, uint16_t v)
@@ -123,7 +123,7 @@ namespace pipcore
             return;
 
         uint16_t v = swap16(color565);
-        uint16_t *ptr = _buf + ry1 * _w + rx1;
+        uint16_t *ptr = rowPtr(ry1) + rx1;
 
         if (w == _w)
         {
@@ -154,14 +154,14 @@ namespace pipcore
 
         if (cw == w && rx1 == 0 && _w == w)
         {
-            copySwap565(_buf + static_cast<size_t>(ry1) * _w,
+            copySwap565(rowPtr(ry1),
                         pixels565 + static_cast<size_t>(ry1 - y) * w,
                         static_cast<size_t>(cw) * static_cast<size_t>(ch));
             return;
         }
 
         const uint16_t *srcLine = pixels565 + (size_t)(ry1 - y) * w + (rx1 - x);
-        uint16_t *dstLine = _buf + (size_t)ry1 * _w + rx1;
+        uint16_t *dstLine = rowPtr(ry1) + rx1;
 
         while (ch--)
         {
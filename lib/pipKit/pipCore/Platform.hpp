@@ -83,11 +83,14 @@ namespace pipcore
         int16_t yOffset = 0;
     };
 
+    using BackgroundJob = void (*)(void *ctx);
+
     class Platform
     {
     public:
         virtual ~Platform() = default;
         [[nodiscard]] virtual uint32_t nowMs() noexcept = 0;
+        [[nodiscard]] virtual uint32_t nowUs() noexcept { return nowMs() * 1000U; }
 
         virtual void pinModeInput(uint8_t, InputMode) noexcept {}
         [[nodiscard]] virtual bool digitalRead(uint8_t) noexcept { return false; }
@@ -99,6 +102,7 @@ namespace pipcore
 
         virtual void *alloc(size_t bytes, AllocCaps caps = AllocCaps::Default) noexcept = 0;
         virtual void free(void *ptr) noexcept = 0;
+        [[nodiscard]] virtual bool isInternal(const void *) const noexcept { return true; }
 
         [[nodiscard]] virtual bool configDisplay(const DisplayConfig &) noexcept
         {
@@ -125,6 +129,10 @@ namespace pipcore
         [[nodiscard]] virtual PlatformError lastError() const noexcept { return PlatformError::None; }
         [[nodiscard]] virtual const char *lastErrorText() const noexcept { return platformErrorText(lastError()); }
 
+        [[nodiscard]] virtual bool submitBackground(BackgroundJob, void *) noexcept { return false; }
+        [[nodiscard]] virtual bool backgroundBusy() noexcept { return false; }
+        virtual void waitBackground() noexcept {}
+
         [[nodiscard]] virtual uint8_t readProgmemByte(const void *addr) noexcept { return *static_cast<const uint8_t *>(addr); }
 
         [[nodiscard]] virtual net::Backend *network() noexcept { return nullptr; }
@@ -22,6 +22,11 @@ namespace pipcore::esp32
         return _time.nowMs();
     }
 
+    uint32_t Platform::nowUs() noexcept
+    {
+        return _time.nowUs();
+    }
+
     uint8_t Platform::loadMaxBrightnessPercent() noexcept
     {
         uint8_t percent = 100;
@@ -59,6 +64,11 @@ namespace pipcore::esp32
         _heap.free(ptr);
     }
 
+    bool Platform::isInternal(const void *ptr) const noexcept
+    {
+        return _heap.isInternal(ptr);
+    }
+
     bool Platform::configDisplay(const DisplayConfig &cfg) noexcept
     {
         _lastError = PlatformError::None;
@@ -176,6 +186,21 @@ namespace pipcore::esp32
         return platformErrorText(PlatformError::None);
     }
 
+    bool Platform::submitBackground(BackgroundJob job, void *ctx) noexcept
+    {
+        return _worker.submit(job, ctx);
+    }
+
+    bool Platform::backgroundBusy() noexcept
+    {
+        return _worker.busy();
+    }
+
+    void Platform::waitBackground() noexcept
+    {
+        _worker.wait();
+    }
+
     uint8_t Platform::readProgmemByte(const void *addr) noexcept
     {
         return pgm_read_byte(addr);
@@ -30,6 +30,7 @@ namespace pipcore::esp32
         void configureBacklightPin(uint8_t pin, uint8_t channel = 0, uint32_t freqHz = 5000, uint8_t resolutionBits = 12) noexcept override;
 
         [[nodiscard]] uint32_t nowMs() noexcept override;
+        [[nodiscard]] uint32_t nowUs() noexcept override;
         [[nodiscard]] uint8_t loadMaxBrightnessPercent() noexcept override;
         void storeMaxBrightnessPercent(uint8_t percent) noexcept override;
 
@@ -37,6 +38,7 @@ namespace pipcore::esp32
 
         void *alloc(size_t bytes, AllocCaps caps = AllocCaps::Default) noexcept override;
         void free(void *ptr) noexcept override;
+        [[nodiscard]] bool isInternal(const void *ptr) const noexcept override;
 
         [[nodiscard]] bool configDisplay(const DisplayConfig &cfg) noexcept override;
         [[nodiscard]] bool beginDisplay(uint8_t rotation) noexcept override;
@@ -50,6 +52,10 @@ namespace pipcore::esp32
         [[nodiscard]] PlatformError lastError() const noexcept override;
         [[nodiscard]] const char *lastErrorText() const noexcept override;
 
+        [[nodiscard]] bool submitBackground(BackgroundJob job, void *ctx) noexcept override;
+        [[nodiscard]] bool backgroundBusy() noexcept override;
+        void waitBackground() noexcept override;
+
         [[nodiscard]] uint8_t readProgmemByte(const void *addr) noexcept override;
 
         [[nodiscard]] pipcore::net::Backend *network() noexcept override;
@@ -63,6 +69,7 @@ namespace pipcore::esp32
         services::Gpio _gpio;
         services::Backlight _backlight;
         services::Heap _heap;
+        services::Worker _worker;
         services::Prefs _prefs;
         services::Wifi _wifi;
         services::Ota _ota;
@@ -2,7 +2,15 @@
 
 #include <Arduino.h>
 #include <esp_heap_caps.h>
+#if __has_include(<esp_memory_utils.h>)
+#include <esp_memory_utils.h>
+#else
+#include <soc/soc_memory_layout.h>
+#endif
 #include <esp_system.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
 
 #include <algorithm>
 
@@ -47,6 +55,11 @@ namespace pipcore::esp32::services
         heap_caps_free(ptr);
     }
 
+    bool Heap::isInternal(const void *ptr) const noexcept
+    {
+        return ptr && esp_ptr_internal(ptr);
+    }
+
     uint32_t Heap::freeHeapTotal() const noexcept
     {
         return esp_get_free_heap_size();
@@ -67,11 +80,79 @@ namespace pipcore::esp32::services
         return esp_get_minimum_free_heap_size();
     }
 
+    bool Worker::start() noexcept
+    {
+        if (_task)
+            return true;
+
+        if (!_done)
+        {
+            _done = xSemaphoreCreateBinary();
+            if (!_done)
+                return false;
+        }
+
+        const UBaseType_t priority = uxTaskPriorityGet(nullptr) + 1;
+        TaskHandle_t task = nullptr;
+#if portNUM_PROCESSORS > 1
+        const BaseType_t core = xPortGetCoreID() ^ 1;
+#else
+        const BaseType_t core = 0;
+#endif
+        if (xTaskCreatePinnedToCore(&Worker::taskEntry, "pipcore_bg", 4096, this, priority, &task, core) != pdPASS)
+            return false;
+
+        _task = task;
+        return true;
+    }
+
+    void Worker::taskEntry(void *arg)
+    {
+        auto *self = static_cast<Worker *>(arg);
+        for (;;)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            if (self->_job)
+                self->_job(self->_ctx);
+            self->_busy.store(false, std::memory_order_release);
+            xSemaphoreGive(static_cast<SemaphoreHandle_t>(self->_done));
+        }
+    }
+
+    bool Worker::submit(BackgroundJob job, void *ctx) noexcept
+    {
+        if (!job)
+            return false;
+
+        wait();
+        if (!start())
+            return false;
+
+        (void)xSemaphoreTake(static_cast<SemaphoreHandle_t>(_done), 0);
+        _job = job;
+        _ctx = ctx;
+        _busy.store(true, std::memory_order_release);
+        xTaskNotifyGive(static_cast<TaskHandle_t>(_task));
+        return true;
+    }
+
+    void Worker::wait() noexcept
+    {
+        if (!busy())
+            return;
+        (void)xSemaphoreTake(static_cast<SemaphoreHandle_t>(_done), portMAX_DELAY);
+    }
+
     uint32_t Time::nowMs() const noexcept
     {
         return millis();
     }
 
+    uint32_t Time::nowUs() const noexcept
+    {
+        return micros();
+    }
+
     void Backlight::configurePin(uint8_t pin, uint8_t channel, uint32_t freqHz, uint8_t resolutionBits) noexcept
     {
         const uint8_t resolvedBits = (resolutionBits >= 1 && resolutionBits <= 16) ? resolutionBits : 12;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <pipCore/Platform.hpp>
+#include <atomic>
 
 namespace pipcore::esp32::services
 {
@@ -16,6 +17,7 @@ namespace pipcore::esp32::services
     public:
         void *alloc(size_t bytes, AllocCaps caps) const noexcept;
         void free(void *ptr) const noexcept;
+        [[nodiscard]] bool isInternal(const void *ptr) const noexcept;
         [[nodiscard]] uint32_t freeHeapTotal() const noexcept;
         [[nodiscard]] uint32_t freeHeapInternal() const noexcept;
         [[nodiscard]] uint32_t largestFreeBlock() const noexcept;
@@ -26,6 +28,25 @@ namespace pipcore::esp32::services
     {
     public:
         [[nodiscard]] uint32_t nowMs() const noexcept;
+        [[nodiscard]] uint32_t nowUs() const noexcept;
+    };
+
+    class Worker
+    {
+    public:
+        [[nodiscard]] bool submit(BackgroundJob job, void *ctx) noexcept;
+        [[nodiscard]] bool busy() const noexcept { return _busy.load(std::memory_order_acquire); }
+        void wait() noexcept;
+
+    private:
+        [[nodiscard]] bool start() noexcept;
+        static void taskEntry(void *arg);
+
+        void *_task = nullptr;
+        void *_done = nullptr;
+        BackgroundJob _job = nullptr;
+        void *_ctx = nullptr;
+        std::atomic<bool> _busy{false};
     };
 
     class Backlight
@@ -7,6 +7,7 @@
 #include <esp_rom_gpio.h>
 #include <esp_rom_sys.h>
 #include <esp_heap_caps.h>
+#include <esp_attr.h>
 #include <soc/spi_periph.h>
 #include <algorithm>
 
@@ -18,6 +19,17 @@ namespace pipcore::esp32
 
         [[nodiscard]] inline constexpr bool isPinValid(int8_t pin) noexcept { return pin >= 0; }
 
+        [[nodiscard]] inline void *dcTag(int8_t pin, int level) noexcept
+        {
+            return reinterpret_cast<void *>(static_cast<intptr_t>((pin << 1) | (level & 1)));
+        }
+
+        void IRAM_ATTR dcPreTransfer(spi_transaction_t *t)
+        {
+            const intptr_t tag = reinterpret_cast<intptr_t>(t->user);
+            gpio_set_level(static_cast<gpio_num_t>(tag >> 1), static_cast<uint32_t>(tag & 1));
+        }
+
         [[nodiscard]] inline int8_t getSpi2IomuxMosi() noexcept
         {
 #if defined(spi_periph_signal)
@@ -123,9 +135,11 @@ namespace pipcore::esp32
         _trans[1] = nullptr;
         _transInFlight[0] = false;
         _transInFlight[1] = false;
+        _cmdTrans = nullptr;
+        _cmdNext = 0;
         _dmaNext = 0;
-        _dmaInflight = 0;
-        _dcLevel = -1;
+        _inflight = 0;
+        _batchDepth = 0;
         _busAcquired = false;
         _initialized = false;
         _lastError = st7789::IoError::None;
@@ -170,13 +184,13 @@ namespace pipcore::esp32
             return fail(st7789::IoError::Gpio);
         }
 
-        _dcLevel = -1;
         _initialized = true;
         return true;
     }
 
     void St7789Spi::deinit()
     {
+        _batchDepth = 0;
         if (_spiHandle)
         {
             (void)flush();
@@ -197,11 +211,15 @@ namespace pipcore::esp32
                 heap_caps_free(_trans[i]);
                 _trans[i] = nullptr;
             }
-            _transInFlight[i] = false;
+        }
+        if (_cmdTrans)
+        {
+            heap_caps_free(_cmdTrans);
+            _cmdTrans = nullptr;
         }
 
-        _dmaNext = _dmaInflight = 0;
-        _dcLevel = -1;
+        clearInFlight();
+        _cmdNext = _dmaNext = 0;
         _busAcquired = false;
         _initialized = false;
     }
@@ -228,7 +246,8 @@ namespace pipcore::esp32
         dev.mode = 3;
         dev.clock_speed_hz = (int)_hz;
         dev.spics_io_num = isPinValid(_pinCs) ? _pinCs : -1;
-        dev.queue_size = 2;
+        dev.queue_size = CmdSlots + 2;
+        dev.pre_cb = dcPreTransfer;
         dev.cs_ena_pretrans = 1;
         dev.cs_ena_posttrans = 1;
 
@@ -259,26 +278,21 @@ namespace pipcore::esp32
                 deinit();
                 return fail(st7789::IoError::TransactionAlloc);
             }
-            _transInFlight[i] = false;
+        }
+        _cmdTrans = static_cast<spi_transaction_t *>(heap_caps_calloc(CmdSlots, sizeof(spi_transaction_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+        if (!_cmdTrans)
+        {
+            deinit();
+            return fail(st7789::IoError::TransactionAlloc);
         }
 
-        _dmaNext = _dmaInflight = 0;
+        clearInFlight();
+        _cmdNext = _dmaNext = 0;
         _busAcquired = false;
         clearError();
         return true;
     }
 
-    inline bool St7789Spi::setDcCached(int level)
-    {
-        if (_dcLevel != level)
-        {
-            if (gpio_set_level((gpio_num_t)_pinDc, level) != ESP_OK)
-                return fail(st7789::IoError::Gpio);
-            _dcLevel = level;
-        }
-        return true;
-    }
-
     bool St7789Spi::setRst(bool level)
     {
         if (isPinValid(_pinRst))
@@ -295,15 +309,16 @@ namespace pipcore::esp32
     {
         if (!_spiHandle)
             return fail(st7789::IoError::NotReady);
+        if (_batchDepth)
+            return queueSmall(0, &cmd, 1);
         if (!flushQueued())
             return false;
-        if (!setDcCached(0))
-            return false;
 
         spi_transaction_t t{};
         t.flags = SPI_TRANS_USE_TXDATA;
         t.length = 8;
         t.tx_data[0] = cmd;
+        t.user = dcTag(_pinDc, 0);
         if (spi_device_polling_transmit((spi_device_handle_t)_spiHandle, &t) != ESP_OK)
             return fail(st7789::IoError::CommandTransmit);
         return true;
@@ -313,14 +328,15 @@ namespace pipcore::esp32
     {
         if (!len || !_spiHandle)
             return fail(st7789::IoError::NotReady);
+        if (_batchDepth && len <= 4)
+            return queueSmall(1, data, len);
         if (!flushQueued())
             return false;
-        if (!setDcCached(1))
-            return false;
 
         spi_transaction_t t{};
         t.length = (int)(len * 8U);
         t.tx_buffer = data;
+        t.user = dcTag(_pinDc, 1);
         if (spi_device_polling_transmit((spi_device_handle_t)_spiHandle, &t) != ESP_OK)
             return fail(st7789::IoError::DataTransmit);
         return true;
@@ -340,7 +356,7 @@ namespace pipcore::esp32
 
     void St7789Spi::releaseBus()
     {
-        if (!_spiHandle || !_busAcquired)
+        if (!_spiHandle || !_busAcquired || _batchDepth)
             return;
         spi_device_release_bus(static_cast<spi_device_handle_t>(_spiHandle));
         _busAcquired = false;
@@ -351,9 +367,6 @@ namespace pipcore::esp32
         if (!len || !_spiHandle || !_dmaBuf[0] || !_dmaBuf[1] || !_trans[0] || !_trans[1])
             return fail(st7789::IoError::NotReady);
 
-        if (!setDcCached(1))
-            return false;
-
         if (!acquireBus())
             return false;
 
@@ -383,7 +396,7 @@ namespace pipcore::esp32
             t->rxlength = 0;
             t->tx_buffer = _dmaBuf[slot];
             t->rx_buffer = nullptr;
-            t->user = nullptr;
+            t->user = dcTag(_pinDc, 1);
 
             const esp_err_t err = spi_device_queue_trans((spi_device_handle_t)_spiHandle, t, portMAX_DELAY);
             if (err != ESP_OK)
@@ -394,7 +407,7 @@ namespace pipcore::esp32
                 return fail(st7789::IoError::QueueTransmit);
             }
             _transInFlight[slot] = true;
-            ++_dmaInflight;
+            ++_inflight;
 
             p += n;
             remaining -= n;
@@ -411,18 +424,74 @@ namespace pipcore::esp32
         return ok;
     }
 
+    bool St7789Spi::beginBatch()
+    {
+        if (!_spiHandle || !_cmdTrans)
+            return fail(st7789::IoError::NotReady);
+        if (!acquireBus())
+            return false;
+        ++_batchDepth;
+        return true;
+    }
+
+    bool St7789Spi::endBatch()
+    {
+        if (_batchDepth > 1)
+        {
+            --_batchDepth;
+            return true;
+        }
+        _batchDepth = 0;
+        return flush();
+    }
+
+    bool St7789Spi::queueSmall(int dc, const void *data, size_t len)
+    {
+        while (_cmdInFlight[_cmdNext])
+        {
+            if (!waitQueued())
+                return false;
+        }
+
+        const int slot = _cmdNext;
+        _cmdNext = (_cmdNext + 1) % CmdSlots;
+
+        spi_transaction_t *t = &_cmdTrans[slot];
+        memset(t, 0, sizeof(*t));
+        t->flags = SPI_TRANS_USE_TXDATA;
+        t->length = (int)(len * 8U);
+        memcpy(t->tx_data, data, len);
+        t->user = dcTag(_pinDc, dc);
+
+        if (spi_device_queue_trans((spi_device_handle_t)_spiHandle, t, portMAX_DELAY) != ESP_OK)
+        {
+            (void)flushQueued();
+            return fail(dc ? st7789::IoError::DataTransmit : st7789::IoError::CommandTransmit);
+        }
+        _cmdInFlight[slot] = true;
+        ++_inflight;
+        return true;
+    }
+
+    void St7789Spi::clearInFlight() noexcept
+    {
+        _transInFlight[0] = false;
+        _transInFlight[1] = false;
+        for (int i = 0; i < CmdSlots; ++i)
+            _cmdInFlight[i] = false;
+        _inflight = 0;
+    }
+
     bool St7789Spi::waitQueued()
     {
-        if (_dmaInflight <= 0 || !_spiHandle)
+        if (_inflight <= 0 || !_spiHandle)
             return true;
 
         spi_transaction_t *r = nullptr;
         const esp_err_t err = spi_device_get_trans_result((spi_device_handle_t)_spiHandle, &r, portMAX_DELAY);
         if (err != ESP_OK || !r)
         {
-            _transInFlight[0] = false;
-            _transInFlight[1] = false;
-            _dmaInflight = 0;
+            clearInFlight();
             return fail(st7789::IoError::QueueResult);
         }
 
@@ -430,21 +499,21 @@ namespace pipcore::esp32
             _transInFlight[0] = false;
         else if (r == _trans[1])
             _transInFlight[1] = false;
+        else if (_cmdTrans && r >= _cmdTrans && r < _cmdTrans + CmdSlots)
+            _cmdInFlight[r - _cmdTrans] = false;
         else
         {
-            _transInFlight[0] = false;
-            _transInFlight[1] = false;
-            _dmaInflight = 0;
+            clearInFlight();
             return fail(st7789::IoError::UnexpectedTransaction);
         }
 
-        --_dmaInflight;
+        --_inflight;
         return true;
     }
 
     bool St7789Spi::flushQueued()
     {
-        while (_dmaInflight > 0)
+        while (_inflight > 0)
         {
             if (!waitQueued())
                 return false;
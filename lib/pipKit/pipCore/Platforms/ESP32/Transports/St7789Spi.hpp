@@ -30,13 +30,18 @@ namespace pipcore::esp32
         [[nodiscard]] bool acquireBus() override;
         void releaseBus() override;
         [[nodiscard]] bool flush() override;
+        [[nodiscard]] bool beginBatch() override;
+        [[nodiscard]] bool endBatch() override;
 
     private:
+        static constexpr int CmdSlots = 10;
+
         [[nodiscard]] bool initSpi();
+        [[nodiscard]] bool queueSmall(int dc, const void *data, size_t len);
         [[nodiscard]] bool waitQueued();
         [[nodiscard]] bool flushQueued();
+        void clearInFlight() noexcept;
         [[nodiscard]] bool fail(st7789::IoError error);
-        [[nodiscard]] inline bool setDcCached(int level);
 
         int8_t _pinMosi = -1;
         int8_t _pinSclk = -1;
@@ -50,9 +55,12 @@ namespace pipcore::esp32
         uint8_t *_dmaBuf[2] = {nullptr, nullptr};
         spi_transaction_t *_trans[2] = {nullptr, nullptr};
         bool _transInFlight[2] = {false, false};
+        spi_transaction_t *_cmdTrans = nullptr;
+        bool _cmdInFlight[CmdSlots] = {};
+        int _cmdNext = 0;
         int _dmaNext = 0;
-        int _dmaInflight = 0;
-        int8_t _dcLevel = -1;
+        int _inflight = 0;
+        uint8_t _batchDepth = 0;
         bool _busAcquired = false;
         bool _initialized = false;
         st7789::IoError _lastError = st7789::IoError::None;
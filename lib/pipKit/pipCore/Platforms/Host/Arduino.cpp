@@ -0,0 +1,348 @@
+#if defined(PIPCORE_HOST)
+
+#include <pipCore/Platforms/Host/Arduino.hpp>
+#include <cctype>
+#include <chrono>
+#include <cstdarg>
+#include <thread>
+
+HostSerial Serial;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    [[nodiscard]] Clock::time_point startTime() noexcept
+    {
+        static const Clock::time_point t0 = Clock::now();
+        return t0;
+    }
+
+    [[nodiscard]] unsigned int formatInteger(char *out, size_t cap, unsigned long long value, bool negative, unsigned char base) noexcept
+    {
+        if (base < 2 || base > 36)
+            base = 10;
+
+        char tmp[72];
+        unsigned int n = 0;
+        do
+        {
+            const unsigned digit = static_cast<unsigned>(value % base);
+            tmp[n++] = static_cast<char>(digit < 10 ? '0' + digit : 'a' + digit - 10);
+            value /= base;
+        } while (value && n < sizeof(tmp));
+
+        unsigned int len = 0;
+        if (negative && len + 1 < cap)
+            out[len++] = '-';
+        while (n && len + 1 < cap)
+            out[len++] = tmp[--n];
+        out[len] = '\0';
+        return len;
+    }
+}
+
+uint32_t millis() noexcept
+{
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startTime()).count());
+}
+
+uint32_t micros() noexcept
+{
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime()).count());
+}
+
+void delay(uint32_t ms) noexcept
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) noexcept
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+String::String(const char *cstr)
+{
+    if (cstr)
+        append(cstr, static_cast<unsigned int>(std::strlen(cstr)));
+}
+
+String::String(const char *cstr, unsigned int length)
+{
+    if (cstr)
+        append(cstr, length);
+}
+
+String::String(const String &other)
+{
+    append(other.c_str(), other._len);
+}
+
+String::String(String &&other) noexcept
+    : _buf(other._buf), _len(other._len), _cap(other._cap)
+{
+    other._buf = nullptr;
+    other._len = 0;
+    other._cap = 0;
+}
+
+String::String(char c)
+{
+    append(&c, 1);
+}
+
+String::String(unsigned char value, unsigned char base)
+    : String(static_cast<unsigned long>(value), base)
+{
+}
+
+String::String(int value, unsigned char base)
+    : String(static_cast<long>(value), base)
+{
+}
+
+String::String(unsigned int value, unsigned char base)
+    : String(static_cast<unsigned long>(value), base)
+{
+}
+
+String::String(long value, unsigned char base)
+{
+    char tmp[72];
+    const bool negative = value < 0 && base == 10;
+    const unsigned long long mag = negative ? 0ULL - static_cast<unsigned long long>(value)
+                                            : static_cast<unsigned long long>(static_cast<unsigned long>(value));
+    append(tmp, formatInteger(tmp, sizeof(tmp), mag, negative, base));
+}
+
+String::String(unsigned long value, unsigned char base)
+{
+    char tmp[72];
+    append(tmp, formatInteger(tmp, sizeof(tmp), value, false, base));
+}
+
+String::String(float value, unsigned char decimalPlaces)
+    : String(static_cast<double>(value), decimalPlaces)
+{
+}
+
+String::String(double value, unsigned char decimalPlaces)
+{
+    char tmp[64];
+    const int n = std::snprintf(tmp, sizeof(tmp), "%.*f", static_cast<int>(decimalPlaces), value);
+    if (n > 0)
+        append(tmp, static_cast<unsigned int>(std::min<int>(n, static_cast<int>(sizeof(tmp) - 1))));
+}
+
+String::~String()
+{
+    std::free(_buf);
+}
+
+String &String::operator=(const String &rhs)
+{
+    if (this == &rhs)
+        return *this;
+    _len = 0;
+    if (_buf)
+        _buf[0] = '\0';
+    append(rhs.c_str(), rhs._len);
+    return *this;
+}
+
+String &String::operator=(String &&rhs) noexcept
+{
+    if (this == &rhs)
+        return *this;
+    std::free(_buf);
+    _buf = rhs._buf;
+    _len = rhs._len;
+    _cap = rhs._cap;
+    rhs._buf = nullptr;
+    rhs._len = 0;
+    rhs._cap = 0;
+    return *this;
+}
+
+String &String::operator=(const char *cstr)
+{
+    if (cstr && _buf && cstr >= _buf && cstr < _buf + _cap)
+    {
+        String copy(cstr);
+        return *this = static_cast<String &&>(copy);
+    }
+
+    _len = 0;
+    if (_buf)
+        _buf[0] = '\0';
+    if (cstr)
+        append(cstr, static_cast<unsigned int>(std::strlen(cstr)));
+    return *this;
+}
+
+bool String::reserve(unsigned int size)
+{
+    if (_buf && _cap >= size)
+        return true;
+
+    char *next = static_cast<char *>(std::realloc(_buf, static_cast<size_t>(size) + 1));
+    if (!next)
+        return false;
+    if (!_buf)
+        next[0] = '\0';
+    _buf = next;
+    _cap = size;
+    return true;
+}
+
+bool String::append(const char *data, unsigned int len)
+{
+    const unsigned int need = _len + len;
+    if (!reserve(need < 16 ? 16 : (need > _cap && need < _cap * 2 ? _cap * 2 : need)))
+        return false;
+    if (len)
+        std::memmove(_buf + _len, data, len);
+    _len = need;
+    _buf[_len] = '\0';
+    return true;
+}
+
+char &String::operator[](unsigned int index) noexcept
+{
+    static char dummy = '\0';
+    if (index >= _len)
+    {
+        dummy = '\0';
+        return dummy;
+    }
+    return _buf[index];
+}
+
+bool String::startsWith(const String &prefix) const noexcept
+{
+    return prefix._len <= _len && std::strncmp(c_str(), prefix.c_str(), prefix._len) == 0;
+}
+
+bool String::endsWith(const String &suffix) const noexcept
+{
+    return suffix._len <= _len && std::strcmp(c_str() + _len - suffix._len, suffix.c_str()) == 0;
+}
+
+int String::indexOf(char c, unsigned int fromIndex) const noexcept
+{
+    if (fromIndex >= _len)
+        return -1;
+    const char *hit = static_cast<const char *>(std::memchr(_buf + fromIndex, c, _len - fromIndex));
+    return hit ? static_cast<int>(hit - _buf) : -1;
+}
+
+int String::indexOf(const String &str, unsigned int fromIndex) const noexcept
+{
+    if (fromIndex >= _len)
+        return -1;
+    const char *hit = std::strstr(_buf + fromIndex, str.c_str());
+    return hit ? static_cast<int>(hit - _buf) : -1;
+}
+
+int String::lastIndexOf(char c) const noexcept
+{
+    for (unsigned int i = _len; i-- > 0;)
+    {
+        if (_buf[i] == c)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const
+{
+    if (beginIndex > endIndex)
+        std::swap(beginIndex, endIndex);
+    if (beginIndex >= _len)
+        return String();
+    if (endIndex > _len)
+        endIndex = _len;
+    return String(_buf + beginIndex, endIndex - beginIndex);
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+    if (index >= _len || count == 0)
+        return;
+    if (count > _len - index)
+        count = _len - index;
+    std::memmove(_buf + index, _buf + index + count, _len - index - count);
+    _len -= count;
+    _buf[_len] = '\0';
+}
+
+void String::trim()
+{
+    if (!_buf || _len == 0)
+        return;
+    unsigned int begin = 0;
+    while (begin < _len && std::isspace(static_cast<unsigned char>(_buf[begin])))
+        ++begin;
+    unsigned int end = _len;
+    while (end > begin && std::isspace(static_cast<unsigned char>(_buf[end - 1])))
+        --end;
+    _len = end - begin;
+    if (begin)
+        std::memmove(_buf, _buf + begin, _len);
+    _buf[_len] = '\0';
+}
+
+void String::toLowerCase()
+{
+    for (unsigned int i = 0; i < _len; ++i)
+        _buf[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(_buf[i])));
+}
+
+void String::toUpperCase()
+{
+    for (unsigned int i = 0; i < _len; ++i)
+        _buf[i] = static_cast<char>(std::toupper(static_cast<unsigned char>(_buf[i])));
+}
+
+int HostSerial::available() noexcept
+{
+    if (!_in)
+        return 0;
+    const int c = std::fgetc(_in);
+    if (c == EOF)
+        return 0;
+    std::ungetc(c, _in);
+    return 1;
+}
+
+int HostSerial::read() noexcept
+{
+    return _in ? std::fgetc(_in) : -1;
+}
+
+void HostSerial::flush() noexcept
+{
+    if (_out)
+        std::fflush(_out);
+}
+
+size_t HostSerial::write(const uint8_t *data, size_t len) noexcept
+{
+    if (!_out || !data || len == 0)
+        return 0;
+    return std::fwrite(data, 1, len, _out);
+}
+
+int HostSerial::printf(const char *fmt, ...) noexcept
+{
+    if (!_out)
+        return 0;
+    va_list args;
+    va_start(args, fmt);
+    const int n = std::vfprintf(_out, fmt, args);
+    va_end(args);
+    return n;
+}
+
+#endif
@@ -0,0 +1,191 @@
+#pragma once
+
+#if !defined(PIPCORE_HOST)
+#error "pipCore/Platforms/Host/Arduino.hpp is only for PIPCORE_HOST builds"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#ifndef pgm_read_byte
+#define pgm_read_byte(addr) (*reinterpret_cast<const uint8_t *>(addr))
+#define pgm_read_word(addr) (*reinterpret_cast<const uint16_t *>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t *>(addr))
+#endif
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#endif
+
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+
+using std::abs;
+using std::max;
+using std::min;
+
+[[nodiscard]] uint32_t millis() noexcept;
+[[nodiscard]] uint32_t micros() noexcept;
+void delay(uint32_t ms) noexcept;
+void delayMicroseconds(uint32_t us) noexcept;
+inline void yield() noexcept {}
+
+class String
+{
+public:
+    String() noexcept = default;
+    String(const char *cstr);
+    String(const char *cstr, unsigned int length);
+    String(const String &other);
+    String(String &&other) noexcept;
+    explicit String(char c);
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(float value, unsigned char decimalPlaces = 2);
+    explicit String(double value, unsigned char decimalPlaces = 2);
+    ~String();
+
+    String &operator=(const String &rhs);
+    String &operator=(String &&rhs) noexcept;
+    String &operator=(const char *cstr);
+
+    [[nodiscard]] unsigned int length() const noexcept { return _len; }
+    [[nodiscard]] bool isEmpty() const noexcept { return _len == 0; }
+    [[nodiscard]] const char *c_str() const noexcept { return _buf ? _buf : ""; }
+    bool reserve(unsigned int size);
+
+    bool concat(const String &str) { return append(str.c_str(), str._len); }
+    bool concat(const char *cstr) { return cstr ? append(cstr, static_cast<unsigned int>(std::strlen(cstr))) : false; }
+    bool concat(char c) { return append(&c, 1); }
+    bool concat(int value) { return concat(String(value)); }
+    bool concat(unsigned int value) { return concat(String(value)); }
+    bool concat(long value) { return concat(String(value)); }
+    bool concat(unsigned long value) { return concat(String(value)); }
+    bool concat(float value) { return concat(String(value)); }
+    bool concat(double value) { return concat(String(value)); }
+
+    template <typename T>
+    String &operator+=(const T &rhs)
+    {
+        concat(rhs);
+        return *this;
+    }
+
+    [[nodiscard]] char charAt(unsigned int index) const noexcept { return index < _len ? _buf[index] : '\0'; }
+    void setCharAt(unsigned int index, char c) noexcept
+    {
+        if (index < _len)
+            _buf[index] = c;
+    }
+    [[nodiscard]] char operator[](unsigned int index) const noexcept { return charAt(index); }
+    char &operator[](unsigned int index) noexcept;
+
+    [[nodiscard]] int compareTo(const String &s) const noexcept { return std::strcmp(c_str(), s.c_str()); }
+    [[nodiscard]] bool equals(const String &s) const noexcept { return _len == s._len && compareTo(s) == 0; }
+    [[nodiscard]] bool equals(const char *cstr) const noexcept { return std::strcmp(c_str(), cstr ? cstr : "") == 0; }
+    [[nodiscard]] bool startsWith(const String &prefix) const noexcept;
+    [[nodiscard]] bool endsWith(const String &suffix) const noexcept;
+
+    [[nodiscard]] int indexOf(char c, unsigned int fromIndex = 0) const noexcept;
+    [[nodiscard]] int indexOf(const String &str, unsigned int fromIndex = 0) const noexcept;
+    [[nodiscard]] int lastIndexOf(char c) const noexcept;
+
+    [[nodiscard]] String substring(unsigned int beginIndex) const { return substring(beginIndex, _len); }
+    [[nodiscard]] String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+    void remove(unsigned int index) { remove(index, _len); }
+    void remove(unsigned int index, unsigned int count);
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+
+    [[nodiscard]] long toInt() const noexcept { return std::strtol(c_str(), nullptr, 10); }
+    [[nodiscard]] float toFloat() const noexcept { return std::strtof(c_str(), nullptr); }
+
+private:
+    bool append(const char *data, unsigned int len);
+
+    char *_buf = nullptr;
+    unsigned int _len = 0;
+    unsigned int _cap = 0;
+};
+
+[[nodiscard]] inline bool operator==(const String &a, const String &b) noexcept { return a.equals(b); }
+[[nodiscard]] inline bool operator==(const String &a, const char *b) noexcept { return a.equals(b); }
+[[nodiscard]] inline bool operator==(const char *a, const String &b) noexcept { return b.equals(a); }
+[[nodiscard]] inline bool operator!=(const String &a, const String &b) noexcept { return !a.equals(b); }
+[[nodiscard]] inline bool operator!=(const String &a, const char *b) noexcept { return !a.equals(b); }
+[[nodiscard]] inline bool operator<(const String &a, const String &b) noexcept { return a.compareTo(b) < 0; }
+
+template <typename T>
+[[nodiscard]] inline String operator+(const String &lhs, const T &rhs)
+{
+    String out(lhs);
+    out.concat(rhs);
+    return out;
+}
+
+[[nodiscard]] inline String operator+(const char *lhs, const String &rhs)
+{
+    String out(lhs);
+    out.concat(rhs);
+    return out;
+}
+
+class HostSerial
+{
+public:
+    void begin(unsigned long) noexcept {}
+    void end() noexcept {}
+    void setOutput(FILE *out) noexcept { _out = out; }
+    void setInput(FILE *in) noexcept { _in = in; }
+
+    [[nodiscard]] int available() noexcept;
+    [[nodiscard]] int read() noexcept;
+    [[nodiscard]] size_t availableForWrite() const noexcept { return _out ? 4096 : 0; }
+    void flush() noexcept;
+
+    size_t write(uint8_t c) noexcept { return write(&c, 1); }
+    size_t write(const uint8_t *data, size_t len) noexcept;
+    size_t write(const char *data, size_t len) noexcept { return write(reinterpret_cast<const uint8_t *>(data), len); }
+
+    size_t print(const String &s) noexcept { return write(s.c_str(), s.length()); }
+    size_t print(const char *s) noexcept { return s ? write(s, std::strlen(s)) : 0; }
+    size_t print(char c) noexcept { return write(static_cast<uint8_t>(c)); }
+    template <typename T>
+    size_t print(T value) { return print(String(value)); }
+
+    size_t println() noexcept { return write("\r\n", 2); }
+    template <typename T>
+    size_t println(const T &value)
+    {
+        const size_t n = print(value);
+        return n + println();
+    }
+
+    int printf(const char *fmt, ...) noexcept __attribute__((format(printf, 2, 3)));
+
+    explicit operator bool() const noexcept { return true; }
+
+private:
+    FILE *_out = stdout;
+    FILE *_in = nullptr;
+};
+
+extern HostSerial Serial;
@@ -0,0 +1,155 @@
+#if defined(PIPCORE_HOST)
+
+#include <pipCore/Platforms/Host/Display.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace pipcore::host
+{
+    namespace
+    {
+        [[nodiscard]] inline constexpr uint16_t bswap16(uint16_t v) noexcept { return __builtin_bswap16(v); }
+    }
+
+    Display::~Display()
+    {
+        reset();
+    }
+
+    bool Display::configure(uint16_t width, uint16_t height, bool swap) noexcept
+    {
+        reset();
+        if (width == 0 || height == 0)
+            return false;
+
+        _fb = static_cast<uint16_t *>(std::calloc(static_cast<size_t>(width) * height, sizeof(uint16_t)));
+        if (!_fb)
+            return false;
+
+        _physWidth = width;
+        _physHeight = height;
+        _width = width;
+        _height = height;
+        _swap = swap;
+        return true;
+    }
+
+    void Display::reset() noexcept
+    {
+        std::free(_fb);
+        _fb = nullptr;
+        _physWidth = 0;
+        _physHeight = 0;
+        _width = 0;
+        _height = 0;
+        _rotation = 0;
+        _ready = false;
+        _stats = DisplayStats();
+    }
+
+    bool Display::begin(uint8_t rotation)
+    {
+        if (!_fb)
+            return false;
+        _ready = true;
+        if (!setRotation(rotation))
+            return false;
+        std::memset(_fb, 0, static_cast<size_t>(_physWidth) * _physHeight * sizeof(uint16_t));
+        return true;
+    }
+
+    bool Display::setRotation(uint8_t rotation)
+    {
+        if (!_ready)
+            return false;
+        _rotation = rotation & 3U;
+        const bool landscape = (_rotation & 1U) != 0;
+        _width = landscape ? _physHeight : _physWidth;
+        _height = landscape ? _physWidth : _physHeight;
+        return true;
+    }
+
+    void Display::fillScreen565(uint16_t color565)
+    {
+        if (!_ready)
+            return;
+        const size_t total = static_cast<size_t>(_width) * _height;
+        std::fill(_fb, _fb + total, _swap ? color565 : bswap16(color565));
+        ++_stats.fills;
+        _stats.pixelsWritten += total;
+    }
+
+    void Display::writeRect565(int16_t x, int16_t y, int16_t w, int16_t h,
+                               const uint16_t *pixels, int32_t stridePixels)
+    {
+        if (!_ready || !pixels || w <= 0 || h <= 0 || stridePixels < w)
+            return;
+
+        int32_t x0 = x;
+        int32_t y0 = y;
+        int32_t x1 = static_cast<int32_t>(x) + w - 1;
+        int32_t y1 = static_cast<int32_t>(y) + h - 1;
+        if (x1 < 0 || y1 < 0 || x0 >= _width || y0 >= _height)
+            return;
+
+        x0 = std::max<int32_t>(x0, 0);
+        y0 = std::max<int32_t>(y0, 0);
+        x1 = std::min<int32_t>(x1, _width - 1);
+        y1 = std::min<int32_t>(y1, _height - 1);
+
+        const int32_t cW = x1 - x0 + 1;
+        const int32_t cH = y1 - y0 + 1;
+        pixels += static_cast<size_t>(y0 - y) * stridePixels + (x0 - x);
+
+        for (int32_t row = 0; row < cH; ++row)
+        {
+            const uint16_t *src = pixels + static_cast<size_t>(row) * stridePixels;
+            uint16_t *dst = _fb + static_cast<size_t>(y0 + row) * _width + x0;
+            if (_swap)
+                std::memcpy(dst, src, static_cast<size_t>(cW) * sizeof(uint16_t));
+            else
+                for (int32_t i = 0; i < cW; ++i)
+                    dst[i] = bswap16(src[i]);
+        }
+
+        ++_stats.rectWrites;
+        _stats.pixelsWritten += static_cast<uint64_t>(cW) * static_cast<uint64_t>(cH);
+    }
+
+    uint16_t Display::pixel565(int16_t x, int16_t y) const noexcept
+    {
+        if (!_fb || x < 0 || y < 0 || x >= _width || y >= _height)
+            return 0;
+        return _fb[static_cast<size_t>(y) * _width + x];
+    }
+
+    bool Display::savePpm(const char *path) const noexcept
+    {
+        if (!_fb || !path)
+            return false;
+
+        FILE *f = std::fopen(path, "wb");
+        if (!f)
+            return false;
+
+        bool ok = std::fprintf(f, "P6\n%u %u\n255\n", static_cast<unsigned>(_width), static_cast<unsigned>(_height)) > 0;
+        const size_t total = static_cast<size_t>(_width) * _height;
+        for (size_t i = 0; ok && i < total; ++i)
+        {
+            const uint16_t c = _fb[i];
+            const uint8_t r5 = static_cast<uint8_t>((c >> 11) & 0x1F);
+            const uint8_t g6 = static_cast<uint8_t>((c >> 5) & 0x3F);
+            const uint8_t b5 = static_cast<uint8_t>(c & 0x1F);
+            const uint8_t rgb[3] = {static_cast<uint8_t>((r5 << 3) | (r5 >> 2)),
+                                    static_cast<uint8_t>((g6 << 2) | (g6 >> 4)),
+                                    static_cast<uint8_t>((b5 << 3) | (b5 >> 2))};
+            ok = std::fwrite(rgb, 1, sizeof(rgb), f) == sizeof(rgb);
+        }
+
+        return (std::fclose(f) == 0) && ok;
+    }
+}
+
+#endif
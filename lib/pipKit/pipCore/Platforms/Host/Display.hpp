@@ -0,0 +1,63 @@
+#pragma once
+
+#include <pipCore/Display.hpp>
+
+namespace pipcore::host
+{
+    struct DisplayStats
+    {
+        uint32_t rectWrites = 0;
+        uint32_t fills = 0;
+        uint64_t pixelsWritten = 0;
+    };
+
+    class Display final : public pipcore::Display
+    {
+    public:
+        Display() = default;
+        ~Display() override;
+
+        Display(const Display &) = delete;
+        Display &operator=(const Display &) = delete;
+
+        Display(Display &&) = delete;
+        Display &operator=(Display &&) = delete;
+
+        [[nodiscard]] bool configure(uint16_t width, uint16_t height, bool swap = false) noexcept;
+        void reset() noexcept;
+
+        [[nodiscard]] bool begin(uint8_t rotation) override;
+        [[nodiscard]] bool setRotation(uint8_t rotation) override;
+        [[nodiscard]] uint16_t width() const noexcept override { return _width; }
+        [[nodiscard]] uint16_t height() const noexcept override { return _height; }
+
+        void fillScreen565(uint16_t color565) override;
+
+        void writeRect565(int16_t x,
+                          int16_t y,
+                          int16_t w,
+                          int16_t h,
+                          const uint16_t *pixels,
+                          int32_t stridePixels) override;
+
+        [[nodiscard]] const uint16_t *pixels() const noexcept { return _fb; }
+        [[nodiscard]] uint16_t pixel565(int16_t x, int16_t y) const noexcept;
+        [[nodiscard]] uint8_t rotation() const noexcept { return _rotation; }
+
+        [[nodiscard]] const DisplayStats &stats() const noexcept { return _stats; }
+        void resetStats() noexcept { _stats = DisplayStats(); }
+
+        [[nodiscard]] bool savePpm(const char *path) const noexcept;
+
+    private:
+        uint16_t *_fb = nullptr;
+        uint16_t _physWidth = 0;
+        uint16_t _physHeight = 0;
+        uint16_t _width = 0;
+        uint16_t _height = 0;
+        uint8_t _rotation = 0;
+        bool _swap = false;
+        bool _ready = false;
+        DisplayStats _stats;
+    };
+}
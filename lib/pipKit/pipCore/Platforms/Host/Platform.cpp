@@ -0,0 +1,330 @@
+#if defined(PIPCORE_HOST)
+
+#include <pipCore/Platforms/Host/Platform.hpp>
+#include <pipCore/Platforms/Host/Arduino.hpp>
+#include <cstdlib>
+
+namespace pipcore::host
+{
+    namespace
+    {
+        constexpr size_t HeaderBytes = 16;
+
+        struct AllocHeader
+        {
+            uint32_t bytes;
+            uint8_t internal;
+        };
+
+        static_assert(sizeof(AllocHeader) <= HeaderBytes, "alloc header must fit its slot");
+
+        [[nodiscard]] inline uint32_t remaining(uint32_t limit, uint32_t used) noexcept
+        {
+            return (used < limit) ? (limit - used) : 0;
+        }
+    }
+
+    Platform::~Platform()
+    {
+        if (!_worker.joinable())
+            return;
+        {
+            std::lock_guard<std::mutex> lock(_workerMutex);
+            _workerStop = true;
+        }
+        _workerCv.notify_all();
+        _worker.join();
+    }
+
+    uint32_t Platform::nowMs() noexcept
+    {
+        return _manualClock ? _clockMs : millis();
+    }
+
+    uint32_t Platform::nowUs() noexcept
+    {
+        // The manual clock drives microseconds too: the dirty-rect cost model is fed from this
+        // clock, and wall time there would make rect partitioning differ between runs.
+        return _manualClock ? _clockMs * 1000U : micros();
+    }
+
+    void Platform::setNowMs(uint32_t ms) noexcept
+    {
+        _manualClock = true;
+        _clockMs = ms;
+    }
+
+    void Platform::advanceMs(uint32_t ms) noexcept
+    {
+        if (!_manualClock)
+            setNowMs(millis());
+        _clockMs += ms;
+    }
+
+    void Platform::pinModeInput(uint8_t pin, InputMode mode) noexcept
+    {
+        if (mode == InputMode::Pullup)
+            setPinLevel(pin, true);
+        else if (mode == InputMode::Pulldown)
+            setPinLevel(pin, false);
+    }
+
+    bool Platform::digitalRead(uint8_t pin) noexcept
+    {
+        if (pin >= sizeof(_pinLevels) * 8)
+            return false;
+        return (_pinLevels[pin >> 5] >> (pin & 31U)) & 1U;
+    }
+
+    void Platform::setPinLevel(uint8_t pin, bool level) noexcept
+    {
+        if (pin >= sizeof(_pinLevels) * 8)
+            return;
+        const uint32_t bit = 1U << (pin & 31U);
+        if (level)
+            _pinLevels[pin >> 5] |= bit;
+        else
+            _pinLevels[pin >> 5] &= ~bit;
+    }
+
+    void *Platform::alloc(size_t bytes, AllocCaps caps) noexcept
+    {
+        if (bytes == 0)
+            return nullptr;
+
+        const bool fitsInternal = bytes <= remaining(_limits.internalBytes, _heapStats.internalUsed);
+        const bool fitsExternal = bytes <= remaining(_limits.externalBytes, _heapStats.externalUsed);
+        bool internal = false;
+        if (caps == AllocCaps::PreferInternal)
+            internal = fitsInternal;
+        else
+            internal = !fitsExternal && fitsInternal;
+
+        if (!internal && !fitsExternal)
+        {
+            ++_heapStats.failedCount;
+            return nullptr;
+        }
+
+        auto *raw = static_cast<uint8_t *>(std::malloc(bytes + HeaderBytes));
+        if (!raw)
+        {
+            ++_heapStats.failedCount;
+            return nullptr;
+        }
+
+        auto *hdr = reinterpret_cast<AllocHeader *>(raw);
+        hdr->bytes = static_cast<uint32_t>(bytes);
+        hdr->internal = internal ? 1U : 0U;
+
+        if (internal)
+        {
+            _heapStats.internalUsed += hdr->bytes;
+            if (_heapStats.internalUsed > _heapStats.internalPeak)
+                _heapStats.internalPeak = _heapStats.internalUsed;
+        }
+        else
+        {
+            _heapStats.externalUsed += hdr->bytes;
+            if (_heapStats.externalUsed > _heapStats.externalPeak)
+                _heapStats.externalPeak = _heapStats.externalUsed;
+        }
+        ++_heapStats.allocCount;
+
+        const uint32_t freeNow = freeHeapTotal();
+        if (freeNow < _minFreeHeap)
+            _minFreeHeap = freeNow;
+
+        return raw + HeaderBytes;
+    }
+
+    void Platform::free(void *ptr) noexcept
+    {
+        if (!ptr)
+            return;
+
+        auto *raw = static_cast<uint8_t *>(ptr) - HeaderBytes;
+        const auto *hdr = reinterpret_cast<const AllocHeader *>(raw);
+        if (hdr->internal)
+            _heapStats.internalUsed -= hdr->bytes;
+        else
+            _heapStats.externalUsed -= hdr->bytes;
+        ++_heapStats.freeCount;
+        std::free(raw);
+    }
+
+    bool Platform::isInternal(const void *ptr) const noexcept
+    {
+        if (!ptr)
+            return false;
+        const auto *hdr = reinterpret_cast<const AllocHeader *>(static_cast<const uint8_t *>(ptr) - HeaderBytes);
+        return hdr->internal != 0;
+    }
+
+    void Platform::resetHeapPeaks() noexcept
+    {
+        _heapStats.internalPeak = _heapStats.internalUsed;
+        _heapStats.externalPeak = _heapStats.externalUsed;
+        _minFreeHeap = freeHeapTotal();
+    }
+
+    bool Platform::configDisplay(const DisplayConfig &cfg) noexcept
+    {
+        _lastError = PlatformError::None;
+        _displayConfigured = false;
+        _displayReady = false;
+        if (cfg.width == 0 || cfg.height == 0)
+        {
+            _lastError = PlatformError::InvalidDisplayConfig;
+            return false;
+        }
+
+        bool ok = false;
+        if (_useRecorder)
+        {
+            _st7789.reset();
+            ok = _st7789.configure(this, &_recorder, cfg.width, cfg.height, cfg.order, cfg.invert, cfg.swap, cfg.xOffset, cfg.yOffset);
+        }
+        else
+            ok = _display.configure(cfg.width, cfg.height, cfg.swap);
+
+        if (!ok)
+        {
+            _lastError = PlatformError::DisplayConfigureFailed;
+            return false;
+        }
+
+        _displayConfigured = true;
+        return true;
+    }
+
+    bool Platform::beginDisplay(uint8_t rotation) noexcept
+    {
+        _displayReady = false;
+        if (!_displayConfigured)
+        {
+            _lastError = PlatformError::InvalidDisplayConfig;
+            return false;
+        }
+
+        if (!activeDisplay().begin(rotation))
+        {
+            _lastError = PlatformError::DisplayBeginFailed;
+            return false;
+        }
+
+        _lastError = PlatformError::None;
+        _displayReady = true;
+        return true;
+    }
+
+    bool Platform::setDisplayRotation(uint8_t rotation) noexcept
+    {
+        if (!_displayConfigured || !_displayReady)
+        {
+            _lastError = PlatformError::InvalidDisplayConfig;
+            return false;
+        }
+
+        if (!activeDisplay().setRotation(rotation))
+        {
+            _lastError = PlatformError::DisplayIoFailed;
+            return false;
+        }
+
+        _lastError = PlatformError::None;
+        return true;
+    }
+
+    pipcore::Display *Platform::display() noexcept
+    {
+        if (!_displayConfigured || !_displayReady)
+            return nullptr;
+        return &activeDisplay();
+    }
+
+    pipcore::Display &Platform::activeDisplay() noexcept
+    {
+        if (_useRecorder)
+            return _st7789;
+        return _display;
+    }
+
+    bool Platform::submitBackground(BackgroundJob job, void *ctx) noexcept
+    {
+        if (!job)
+            return false;
+
+        waitBackground();
+        if (!_worker.joinable())
+            _worker = std::thread([this]()
+                                  { workerLoop(); });
+
+        {
+            std::lock_guard<std::mutex> lock(_workerMutex);
+            _job = job;
+            _jobCtx = ctx;
+            _jobPending = true;
+        }
+        _workerCv.notify_all();
+        return true;
+    }
+
+    bool Platform::backgroundBusy() noexcept
+    {
+        std::lock_guard<std::mutex> lock(_workerMutex);
+        return _jobPending;
+    }
+
+    void Platform::waitBackground() noexcept
+    {
+        std::unique_lock<std::mutex> lock(_workerMutex);
+        _workerCv.wait(lock, [this]()
+                       { return !_jobPending; });
+    }
+
+    void Platform::workerLoop() noexcept
+    {
+        std::unique_lock<std::mutex> lock(_workerMutex);
+        for (;;)
+        {
+            _workerCv.wait(lock, [this]()
+                           { return _jobPending || _workerStop; });
+            if (_workerStop)
+                return;
+
+            const BackgroundJob job = _job;
+            void *ctx = _jobCtx;
+            lock.unlock();
+            job(ctx);
+            lock.lock();
+            _jobPending = false;
+            _workerCv.notify_all();
+        }
+    }
+
+    uint32_t Platform::freeHeapTotal() noexcept
+    {
+        return freeHeapInternal() + remaining(_limits.externalBytes, _heapStats.externalUsed);
+    }
+
+    uint32_t Platform::freeHeapInternal() noexcept
+    {
+        return remaining(_limits.internalBytes, _heapStats.internalUsed);
+    }
+
+    uint32_t Platform::largestFreeBlock() noexcept
+    {
+        const uint32_t external = remaining(_limits.externalBytes, _heapStats.externalUsed);
+        const uint32_t internal = freeHeapInternal();
+        return external > internal ? external : internal;
+    }
+
+    uint32_t Platform::minFreeHeap() noexcept
+    {
+        const uint32_t freeNow = freeHeapTotal();
+        return (_minFreeHeap < freeNow) ? _minFreeHeap : freeNow;
+    }
+}
+
+#endif
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <pipCore/Platform.hpp>
+
+#if !defined(PIPCORE_HOST)
+#error "pipcore::host::Platform requires PIPCORE_HOST"
+#endif
+
+#include <pipCore/Displays/ST7789/Display.hpp>
+#include <pipCore/Platforms/Host/Display.hpp>
+#include <pipCore/Platforms/Host/Transports/St7789Recorder.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace pipcore::host
+{
+    struct HeapLimits
+    {
+        uint32_t internalBytes = 320U * 1024U;
+        uint32_t externalBytes = 8U * 1024U * 1024U;
+    };
+
+    struct HeapStats
+    {
+        uint32_t internalUsed = 0;
+        uint32_t externalUsed = 0;
+        uint32_t internalPeak = 0;
+        uint32_t externalPeak = 0;
+        uint32_t allocCount = 0;
+        uint32_t freeCount = 0;
+        uint32_t failedCount = 0;
+    };
+
+    class Platform final : public pipcore::Platform
+    {
+    public:
+        Platform() = default;
+        ~Platform() override;
+
+        [[nodiscard]] uint32_t nowMs() noexcept override;
+        [[nodiscard]] uint32_t nowUs() noexcept override;
+        void setNowMs(uint32_t ms) noexcept;
+        void advanceMs(uint32_t ms) noexcept;
+        void useRealClock() noexcept { _manualClock = false; }
+
+        void pinModeInput(uint8_t pin, InputMode mode) noexcept override;
+        [[nodiscard]] bool digitalRead(uint8_t pin) noexcept override;
+        void setPinLevel(uint8_t pin, bool level) noexcept;
+
+        [[nodiscard]] uint8_t loadMaxBrightnessPercent() noexcept override { return _maxBrightness; }
+        void storeMaxBrightnessPercent(uint8_t percent) noexcept override { _maxBrightness = percent; }
+        void setBacklightPercent(uint8_t percent) noexcept override { _backlight = percent; }
+        [[nodiscard]] uint8_t backlightPercent() const noexcept { return _backlight; }
+
+        void *alloc(size_t bytes, AllocCaps caps = AllocCaps::Default) noexcept override;
+        void free(void *ptr) noexcept override;
+        [[nodiscard]] bool isInternal(const void *ptr) const noexcept override;
+        void setHeapLimits(const HeapLimits &limits) noexcept { _limits = limits; }
+        [[nodiscard]] const HeapStats &heapStats() const noexcept { return _heapStats; }
+        void resetHeapPeaks() noexcept;
+
+        [[nodiscard]] bool configDisplay(const DisplayConfig &cfg) noexcept override;
+        [[nodiscard]] bool beginDisplay(uint8_t rotation) noexcept override;
+        [[nodiscard]] bool setDisplayRotation(uint8_t rotation) noexcept override;
+        [[nodiscard]] pipcore::Display *display() noexcept override;
+        [[nodiscard]] Display &framebuffer() noexcept { return _display; }
+        void useSt7789Recorder(bool enabled) noexcept { _useRecorder = enabled; }
+        [[nodiscard]] St7789Recorder &recorder() noexcept { return _recorder; }
+
+        [[nodiscard]] uint32_t freeHeapTotal() noexcept override;
+        [[nodiscard]] uint32_t freeHeapInternal() noexcept override;
+        [[nodiscard]] uint32_t largestFreeBlock() noexcept override;
+        [[nodiscard]] uint32_t minFreeHeap() noexcept override;
+        [[nodiscard]] PlatformError lastError() const noexcept override { return _lastError; }
+
+        [[nodiscard]] bool submitBackground(BackgroundJob job, void *ctx) noexcept override;
+        [[nodiscard]] bool backgroundBusy() noexcept override;
+        void waitBackground() noexcept override;
+
+    private:
+        void workerLoop() noexcept;
+        [[nodiscard]] pipcore::Display &activeDisplay() noexcept;
+
+        Display _display;
+        std::thread _worker;
+        std::mutex _workerMutex;
+        std::condition_variable _workerCv;
+        BackgroundJob _job = nullptr;
+        void *_jobCtx = nullptr;
+        bool _jobPending = false;
+        bool _workerStop = false;
+        HeapLimits _limits;
+        HeapStats _heapStats;
+        uint32_t _minFreeHeap = UINT32_MAX;
+        uint32_t _clockMs = 0;
+        uint32_t _pinLevels[8] = {};
+        uint8_t _maxBrightness = 100;
+        uint8_t _backlight = 0;
+        bool _manualClock = false;
+        bool _useRecorder = false;
+        bool _displayConfigured = false;
+        bool _displayReady = false;
+        PlatformError _lastError = PlatformError::None;
+        St7789Recorder _recorder;
+        st7789::Display _st7789;
+    };
+}
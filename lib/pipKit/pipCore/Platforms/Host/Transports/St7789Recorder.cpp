@@ -0,0 +1,261 @@
+#if defined(PIPCORE_HOST)
+
+#include <pipCore/Platforms/Host/Transports/St7789Recorder.hpp>
+#include <cstdlib>
+
+namespace pipcore::host
+{
+    namespace
+    {
+        constexpr uint8_t CmdSWRESET = 0x01;
+        constexpr uint8_t CmdINVOFF = 0x20;
+        constexpr uint8_t CmdINVON = 0x21;
+        constexpr uint8_t CmdCASET = 0x2A;
+        constexpr uint8_t CmdRASET = 0x2B;
+        constexpr uint8_t CmdRAMWR = 0x2C;
+        constexpr uint8_t CmdMADCTL = 0x36;
+        constexpr uint8_t MadctlMY = 0x80;
+        constexpr uint8_t MadctlMX = 0x40;
+        constexpr uint8_t MadctlMV = 0x20;
+
+        // Same DMA chunk size as esp32::St7789Spi, so transaction counts match the target.
+        constexpr size_t DmaChunkBytes = 8192;
+
+        [[nodiscard]] inline uint16_t readBE16(const uint8_t *p) noexcept
+        {
+            return static_cast<uint16_t>((p[0] << 8) | p[1]);
+        }
+    }
+
+    St7789Recorder::~St7789Recorder()
+    {
+        deinit();
+    }
+
+    bool St7789Recorder::init()
+    {
+        if (_initialized)
+            return true;
+
+        _gram = static_cast<uint16_t *>(std::calloc(static_cast<size_t>(GramWidth) * GramHeight, sizeof(uint16_t)));
+        if (!_gram)
+        {
+            _lastError = st7789::IoError::DmaBufferAlloc;
+            return false;
+        }
+
+        resetRegisters();
+        _initialized = true;
+        return true;
+    }
+
+    void St7789Recorder::deinit()
+    {
+        std::free(_gram);
+        _gram = nullptr;
+        _batchDepth = 0;
+        _busAcquired = false;
+        _initialized = false;
+    }
+
+    void St7789Recorder::resetRegisters() noexcept
+    {
+        _xs = 0;
+        _xe = GramWidth - 1;
+        _ys = 0;
+        _ye = GramHeight - 1;
+        _cx = 0;
+        _cy = 0;
+        _cmd = 0;
+        _paramCount = 0;
+        _madctl = 0;
+        _pendingByte = -1;
+        _ramwr = false;
+        _inverted = false;
+    }
+
+    bool St7789Recorder::setRst(bool level)
+    {
+        if (!level)
+            resetRegisters();
+        return true;
+    }
+
+    bool St7789Recorder::writeCommand(uint8_t cmd)
+    {
+        if (!_initialized)
+        {
+            _lastError = st7789::IoError::NotReady;
+            return false;
+        }
+
+        ++_stats.commands;
+        ++_stats.transactions;
+        ++_stats.bytes;
+
+        _cmd = cmd;
+        _paramCount = 0;
+        _pendingByte = -1;
+        _ramwr = false;
+
+        switch (cmd)
+        {
+        case CmdSWRESET:
+            resetRegisters();
+            break;
+        case CmdINVON:
+            _inverted = true;
+            break;
+        case CmdINVOFF:
+            _inverted = false;
+            break;
+        case CmdRAMWR:
+            _ramwr = true;
+            _cx = _xs;
+            _cy = _ys;
+            ++_stats.windows;
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool St7789Recorder::write(const void *data, size_t len)
+    {
+        if (!_initialized || !data || !len)
+        {
+            _lastError = st7789::IoError::NotReady;
+            return false;
+        }
+
+        ++_stats.transactions;
+        _stats.bytes += len;
+        feed(static_cast<const uint8_t *>(data), len);
+        return true;
+    }
+
+    bool St7789Recorder::writePixels(const void *data, size_t len)
+    {
+        if (!_initialized || !data || !len)
+        {
+            _lastError = st7789::IoError::NotReady;
+            return false;
+        }
+
+        _stats.transactions += static_cast<uint32_t>((len + DmaChunkBytes - 1) / DmaChunkBytes);
+        _stats.bytes += len;
+        feed(static_cast<const uint8_t *>(data), len);
+        return true;
+    }
+
+    bool St7789Recorder::acquireBus()
+    {
+        if (!_initialized)
+        {
+            _lastError = st7789::IoError::NotReady;
+            return false;
+        }
+        _busAcquired = true;
+        return true;
+    }
+
+    bool St7789Recorder::flush()
+    {
+        ++_stats.waits;
+        if (!_batchDepth)
+            _busAcquired = false;
+        return true;
+    }
+
+    bool St7789Recorder::beginBatch()
+    {
+        if (!acquireBus())
+            return false;
+        if (_batchDepth++ == 0)
+            ++_stats.batches;
+        return true;
+    }
+
+    bool St7789Recorder::endBatch()
+    {
+        if (_batchDepth > 1)
+        {
+            --_batchDepth;
+            return true;
+        }
+        _batchDepth = 0;
+        return flush();
+    }
+
+    void St7789Recorder::feed(const uint8_t *data, size_t len) noexcept
+    {
+        if (_ramwr)
+        {
+            _stats.pixelBytes += len;
+            size_t i = 0;
+            if (_pendingByte >= 0)
+            {
+                const uint8_t pair[2] = {static_cast<uint8_t>(_pendingByte), data[0]};
+                putPixel(readBE16(pair));
+                _pendingByte = -1;
+                i = 1;
+            }
+            for (; i + 1 < len; i += 2)
+                putPixel(readBE16(data + i));
+            if (i < len)
+                _pendingByte = data[i];
+            return;
+        }
+
+        for (size_t i = 0; i < len && _paramCount < sizeof(_params); ++i)
+            _params[_paramCount++] = data[i];
+
+        if (_cmd == CmdMADCTL && _paramCount >= 1)
+            _madctl = _params[0];
+        else if (_cmd == CmdCASET && _paramCount == 4)
+        {
+            _xs = readBE16(_params);
+            _xe = readBE16(_params + 2);
+        }
+        else if (_cmd == CmdRASET && _paramCount == 4)
+        {
+            _ys = readBE16(_params);
+            _ye = readBE16(_params + 2);
+        }
+    }
+
+    void St7789Recorder::putPixel(uint16_t color565) noexcept
+    {
+        uint16_t px = _cx;
+        uint16_t py = _cy;
+        if (_madctl & MadctlMV)
+        {
+            px = _cy;
+            py = _cx;
+        }
+        if ((_madctl & MadctlMX) && px < GramWidth)
+            px = static_cast<uint16_t>(GramWidth - 1 - px);
+        if ((_madctl & MadctlMY) && py < GramHeight)
+            py = static_cast<uint16_t>(GramHeight - 1 - py);
+        if (px < GramWidth && py < GramHeight)
+            _gram[static_cast<size_t>(py) * GramWidth + px] = color565;
+
+        if (_cx < _xe)
+        {
+            ++_cx;
+            return;
+        }
+        _cx = _xs;
+        _cy = (_cy < _ye) ? static_cast<uint16_t>(_cy + 1) : _ys;
+    }
+
+    uint16_t St7789Recorder::pixel565(uint16_t x, uint16_t y) const noexcept
+    {
+        if (!_gram || x >= GramWidth || y >= GramHeight)
+            return 0;
+        return _gram[static_cast<size_t>(y) * GramWidth + x];
+    }
+}
+
+#endif
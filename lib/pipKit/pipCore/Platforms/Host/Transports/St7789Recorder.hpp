@@ -0,0 +1,84 @@
+#pragma once
+
+#include <pipCore/Displays/ST7789/Driver.hpp>
+
+#if !defined(PIPCORE_HOST)
+#error "pipcore::host::St7789Recorder requires PIPCORE_HOST"
+#endif
+
+namespace pipcore::host
+{
+    struct SpiStats
+    {
+        uint32_t commands = 0;
+        uint32_t transactions = 0;
+        uint32_t windows = 0;
+        uint32_t batches = 0;
+        uint32_t waits = 0;
+        uint64_t bytes = 0;
+        uint64_t pixelBytes = 0;
+    };
+
+    class St7789Recorder final : public st7789::Transport
+    {
+    public:
+        static constexpr uint16_t GramWidth = 240;
+        static constexpr uint16_t GramHeight = 320;
+
+        St7789Recorder() = default;
+        ~St7789Recorder() override;
+
+        St7789Recorder(const St7789Recorder &) = delete;
+        St7789Recorder &operator=(const St7789Recorder &) = delete;
+
+        [[nodiscard]] bool init() override;
+        void deinit() override;
+        [[nodiscard]] st7789::IoError lastError() const noexcept override { return _lastError; }
+        void clearError() noexcept override { _lastError = st7789::IoError::None; }
+        [[nodiscard]] bool setRst(bool level) override;
+        void delayMs(uint32_t ms) override { _delayedMs += ms; }
+        [[nodiscard]] bool write(const void *data, size_t len) override;
+        [[nodiscard]] bool writeCommand(uint8_t cmd) override;
+        [[nodiscard]] bool writePixels(const void *data, size_t len) override;
+        [[nodiscard]] bool acquireBus() override;
+        void releaseBus() override { _busAcquired = false; }
+        [[nodiscard]] bool flush() override;
+        [[nodiscard]] bool beginBatch() override;
+        [[nodiscard]] bool endBatch() override;
+
+        [[nodiscard]] const SpiStats &stats() const noexcept { return _stats; }
+        void resetStats() noexcept { _stats = SpiStats(); }
+
+        [[nodiscard]] const uint16_t *gram() const noexcept { return _gram; }
+        [[nodiscard]] uint16_t pixel565(uint16_t x, uint16_t y) const noexcept;
+        [[nodiscard]] uint8_t madctl() const noexcept { return _madctl; }
+        [[nodiscard]] bool inverted() const noexcept { return _inverted; }
+        [[nodiscard]] uint32_t delayedMs() const noexcept { return _delayedMs; }
+
+    private:
+        void resetRegisters() noexcept;
+        void feed(const uint8_t *data, size_t len) noexcept;
+        void putPixel(uint16_t color565) noexcept;
+
+        uint16_t *_gram = nullptr;
+        uint16_t _xs = 0;
+        uint16_t _xe = GramWidth - 1;
+        uint16_t _ys = 0;
+        uint16_t _ye = GramHeight - 1;
+        uint16_t _cx = 0;
+        uint16_t _cy = 0;
+        uint8_t _cmd = 0;
+        uint8_t _params[4] = {};
+        uint8_t _paramCount = 0;
+        uint8_t _madctl = 0;
+        uint8_t _batchDepth = 0;
+        int16_t _pendingByte = -1;
+        uint32_t _delayedMs = 0;
+        bool _ramwr = false;
+        bool _inverted = false;
+        bool _busAcquired = false;
+        bool _initialized = false;
+        SpiStats _stats;
+        st7789::IoError _lastError = st7789::IoError::None;
+    };
+}
@@ -14,7 +14,9 @@
 #error "Platform not selected. Define PIPCORE_PLATFORM in config.hpp"
 #endif
 
-#if defined(ESP32) && (PIPCORE_PLATFORM == ESP32)
+#if defined(PIPCORE_HOST)
+#include <pipCore/Platforms/Host/Platform.hpp>
+#elif defined(ESP32) && (PIPCORE_PLATFORM == ESP32)
 #include <pipCore/Platforms/ESP32/Platform.hpp>
 #else
 #error "Unsupported PIPCORE_PLATFORM value for this target"
@@ -22,7 +24,11 @@
 
 namespace pipcore
 {
+#if defined(PIPCORE_HOST)
+    using SelectedPlatform = host::Platform;
+#else
     using SelectedPlatform = esp32::Platform;
+#endif
 
     [[nodiscard]] inline Platform *GetPlatform() noexcept
     {
@@ -279,6 +279,22 @@ namespace pipgui
     template void GlowCircleFluentT<false>::draw();
     template void GlowCircleFluentT<true>::draw();
 
+    template <bool IsUpdate, bool Squircle>
+    void GlowRectFluentT<IsUpdate, Squircle>::draw()
+    {
+        if (!beginCommit())
+            return;
+        const int16_t bgColor = detail::optionalColor16(_bgColor);
+        const int16_t glowColor = detail::optionalColor16(_glowColor);
+        detail::callByMode<IsUpdate>(
+            [&] { detail::GuiAccess::updateGlowRect(*_gui, _x, _y, _w, _h, _radius, Squircle, _fillColor, bgColor, glowColor, _glowSize, _glowStrength, _anim, _pulsePeriodMs); },
+            [&] { detail::GuiAccess::drawGlowRect(*_gui, _x, _y, _w, _h, _radius, Squircle, _fillColor, bgColor, glowColor, _glowSize, _glowStrength, _anim, _pulsePeriodMs); });
+    }
+    template void GlowRectFluentT<false, false>::draw();
+    template void GlowRectFluentT<true, false>::draw();
+    template void GlowRectFluentT<false, true>::draw();
+    template void GlowRectFluentT<true, true>::draw();
+
     void ToastFluent::commit()
     {
         if (!beginCommit())
@@ -174,4 +174,123 @@ namespace pipgui
         void draw();
     };
 
+
+    template <bool IsUpdate, bool Squircle>
+    struct GlowRectFluentT : detail::FluentLifetime
+    {
+        PIPGUI_DEFAULT_FLUENT_MOVE(GlowRectFluentT);
+        int16_t _x, _y, _w, _h;
+        uint8_t _radius;
+        uint16_t _fillColor;
+        std::optional<uint16_t> _bgColor;
+        std::optional<uint16_t> _glowColor;
+        uint8_t _glowSize, _glowStrength;
+        GlowAnim _anim;
+        uint16_t _pulsePeriodMs;
+        GlowRectFluentT(GUI *g)
+            : detail::FluentLifetime(g),
+              _x(0),
+              _y(0),
+              _w(0),
+              _h(0),
+              _radius(0),
+              _fillColor(0),
+              _bgColor(std::nullopt),
+              _glowColor(std::nullopt),
+              _glowSize(12),
+              _glowStrength(220),
+              _anim(None),
+              _pulsePeriodMs(1000)
+        {
+        }
+        ~GlowRectFluentT() { draw(); }
+        GlowRectFluentT &pos(int16_t x, int16_t y)
+        {
+            if (!canMutate())
+                return *this;
+            _x = x;
+            _y = y;
+            return *this;
+        }
+        GlowRectFluentT &size(int16_t w, int16_t h)
+        {
+            if (!canMutate())
+                return *this;
+            _w = w;
+            _h = h;
+            return *this;
+        }
+        GlowRectFluentT &radius(uint8_t r)
+        {
+            if (!canMutate())
+                return *this;
+            _radius = r;
+            return *this;
+        }
+        GlowRectFluentT &fillColor(uint16_t c)
+        {
+            if (!canMutate())
+                return *this;
+            _fillColor = c;
+            return *this;
+        }
+        GlowRectFluentT &bgColor(int16_t c)
+        {
+            if (!canMutate())
+                return *this;
+            detail::assignOptionalColor(_bgColor, c);
+            return *this;
+        }
+        GlowRectFluentT &bgColor(uint16_t c)
+        {
+            if (!canMutate())
+                return *this;
+            _bgColor = c;
+            return *this;
+        }
+        GlowRectFluentT &glowColor(int16_t c)
+        {
+            if (!canMutate())
+                return *this;
+            detail::assignOptionalColor(_glowColor, c);
+            return *this;
+        }
+        GlowRectFluentT &glowColor(uint16_t c)
+        {
+            if (!canMutate())
+                return *this;
+            _glowColor = c;
+            return *this;
+        }
+        GlowRectFluentT &glowSize(uint8_t s)
+        {
+            if (!canMutate())
+                return *this;
+            _glowSize = s;
+            return *this;
+        }
+        GlowRectFluentT &glowStrength(uint8_t s)
+        {
+            if (!canMutate())
+                return *this;
+            _glowStrength = s;
+            return *this;
+        }
+        GlowRectFluentT &anim(GlowAnim a)
+        {
+            if (!canMutate())
+                return *this;
+            _anim = a;
+            return *this;
+        }
+        GlowRectFluentT &pulseMs(uint16_t ms)
+        {
+            if (!canMutate())
+                return *this;
+            _pulsePeriodMs = ms;
+            return *this;
+        }
+        void draw();
+    };
+
 }
@@ -23,6 +23,10 @@ namespace pipgui
 
     inline DrawGlowCircleFluent GUI::drawGlowCircle() { return DrawGlowCircleFluent(this); }
     inline UpdateGlowCircleFluent GUI::updateGlowCircle() { return UpdateGlowCircleFluent(this); }
+    inline DrawGlowRoundRectFluent GUI::drawGlowRoundRect() { return DrawGlowRoundRectFluent(this); }
+    inline UpdateGlowRoundRectFluent GUI::updateGlowRoundRect() { return UpdateGlowRoundRectFluent(this); }
+    inline DrawGlowSquircleRectFluent GUI::drawGlowSquircleRect() { return DrawGlowSquircleRectFluent(this); }
+    inline UpdateGlowSquircleRectFluent GUI::updateGlowSquircleRect() { return UpdateGlowSquircleRectFluent(this); }
 
     inline DrawScrollDotsFluent GUI::drawScrollDots() { return DrawScrollDotsFluent(this); }
     inline UpdateScrollDotsFluent GUI::updateScrollDots() { return UpdateScrollDotsFluent(this); }
@@ -12,6 +12,7 @@ namespace pipgui
         uint16_t _sizePx;
         uint16_t _weight;
         String _text;
+        const ShapedText *_run;
         uint16_t _fg565;
         uint16_t _bg565;
         TextAlign _align;
@@ -22,6 +23,7 @@ namespace pipgui
               _sizePx(0),
               _weight(0),
               _text(),
+              _run(nullptr),
               _fg565(0xFFFF),
               _bg565(0x0000),
               _align(TextAlign::Left)
@@ -69,6 +71,14 @@ namespace pipgui
             return *this;
         }
 
+        TextFluentT &text(const ShapedText &run)
+        {
+            if (!canMutate())
+                return *this;
+            _run = &run;
+            return *this;
+        }
+
         TextFluentT &color(uint16_t fg565)
         {
             if (!canMutate())
@@ -104,6 +114,7 @@ namespace pipgui
         uint16_t _sizePx;
         uint16_t _weight;
         String _text;
+        const ShapedText *_run;
         uint16_t _fg565;
         TextAlign _align;
         MarqueeTextOptions _opts;
@@ -114,6 +125,7 @@ namespace pipgui
               _sizePx(0),
               _weight(0),
               _text(),
+              _run(nullptr),
               _fg565(0xFFFF),
               _align(TextAlign::Left),
               _opts()
@@ -169,6 +181,14 @@ namespace pipgui
             return *this;
         }
 
+        DrawTextMarqueeFluent &text(const ShapedText &run)
+        {
+            if (!canMutate())
+                return *this;
+            _run = &run;
+            return *this;
+        }
+
         DrawTextMarqueeFluent &color(uint16_t fg565)
         {
             if (!canMutate())
@@ -228,6 +248,7 @@ namespace pipgui
         uint16_t _sizePx;
         uint16_t _weight;
         String _text;
+        const ShapedText *_run;
         uint16_t _fg565;
         TextAlign _align;
         DrawTextEllipsizedFluent(GUI *g)
@@ -237,6 +258,7 @@ namespace pipgui
               _sizePx(0),
               _weight(0),
               _text(),
+              _run(nullptr),
               _fg565(0xFFFF),
               _align(TextAlign::Left)
         {
@@ -291,6 +313,14 @@ namespace pipgui
             return *this;
         }
 
+        DrawTextEllipsizedFluent &text(const ShapedText &run)
+        {
+            if (!canMutate())
+                return *this;
+            _run = &run;
+            return *this;
+        }
+
         DrawTextEllipsizedFluent &color(uint16_t fg565)
         {
             if (!canMutate())
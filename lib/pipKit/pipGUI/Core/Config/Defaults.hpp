@@ -8,6 +8,10 @@
 #define PIPGUI_DEBUG_METRICS 0
 #endif
 
+#ifndef PIPGUI_DEBUG_PROFILER
+#define PIPGUI_DEBUG_PROFILER 0
+#endif
+
 #ifndef PIPGUI_SCREENSHOTS
 #define PIPGUI_SCREENSHOTS 1
 #endif
@@ -16,6 +20,59 @@
 #define PIPGUI_SCREENSHOT_MODE 1
 #endif
 
+// Banded rendering (lines per band, 0 disables the fallback)
+#ifndef PIPGUI_BAND_LINES
+#define PIPGUI_BAND_LINES 32
+#endif
+#ifndef PIPGUI_BANDED_RENDER
+#define PIPGUI_BANDED_RENDER 0
+#endif
+
+// PSRAM hot band (internal-RAM lines used for dirty redraws, 0 disables)
+#ifndef PIPGUI_HOT_BAND_LINES
+#define PIPGUI_HOT_BAND_LINES 0
+#endif
+
+// Corner/circle coverage mask cache budget in bytes (0 disables)
+#ifndef PIPGUI_SHAPE_MASK_CACHE_BYTES
+#define PIPGUI_SHAPE_MASK_CACHE_BYTES 8192
+#endif
+
+// Rendered glyph coverage cache budget in bytes (0 disables)
+#ifndef PIPGUI_GLYPH_CACHE_BYTES
+#define PIPGUI_GLYPH_CACHE_BYTES 16384
+#endif
+
+// Retained display list buffer in bytes (allocated on first recorded redraw)
+#ifndef PIPGUI_DISPLAY_LIST_BYTES
+#define PIPGUI_DISPLAY_LIST_BYTES 8192
+#endif
+
+// Offscreen layer slots for beginLayer()/compositeLayer()
+#ifndef PIPGUI_LAYER_MAX
+#define PIPGUI_LAYER_MAX 4
+#endif
+
+// Nesting depth of pushClip()/popClip()
+#ifndef PIPGUI_CLIP_STACK_DEPTH
+#define PIPGUI_CLIP_STACK_DEPTH 8
+#endif
+
+// Scratch pool for temporary work buffers (blur, rotation, preview, screenshots)
+#ifndef PIPGUI_SCRATCH_SLOTS
+#define PIPGUI_SCRATCH_SLOTS 8
+#endif
+
+// Blur regions whose blurred backdrop is kept across frames (0 disables)
+#ifndef PIPGUI_BLUR_CACHE_SLOTS
+#define PIPGUI_BLUR_CACHE_SLOTS 2
+#endif
+
+// Frame-diff present (pixels per hashed row chunk)
+#ifndef PIPGUI_DIFF_CHUNK_PX
+#define PIPGUI_DIFF_CHUNK_PX 32
+#endif
+
 #ifndef PIPGUI_STATUS_BAR
 #define PIPGUI_STATUS_BAR 0
 #endif
@@ -2,6 +2,7 @@
 #include <pipCore/Platform.hpp>
 #include <pipCore/Platforms/Select.hpp>
 #include <pipCore/Graphics/Sprite.hpp>
+#include <cstdio>
 
 namespace pipgui
 {
@@ -13,6 +14,41 @@ namespace pipgui
     DirtyRect *Debug::_rects = nullptr;
     uint16_t Debug::_rectCapacity = 0;
     uint16_t Debug::_rectCount = 0;
+    bool Debug::_profilerEnabled = false;
+    Debug::PhaseAccum Debug::_phases[(uint8_t)DebugPhase::Count] = {};
+    uint32_t Debug::_framePixels = 0;
+    uint32_t Debug::_frameBytes = 0;
+    DebugFrameCounters Debug::_frameCounters;
+    uint64_t Debug::_totalPixels = 0;
+    uint64_t Debug::_totalBytes = 0;
+
+    namespace
+    {
+        // Quarter-octave buckets: exact below 4 us, then 4 buckets per power of two up to ~80 ms.
+        uint8_t profileBucket(uint32_t us) noexcept
+        {
+            if (us < 4)
+                return (uint8_t)us;
+            const uint32_t msb = 31u - (uint32_t)__builtin_clz(us);
+            const uint32_t idx = (msb - 1u) * 4u + ((us >> (msb - 2u)) & 3u);
+            return (uint8_t)((idx < 63u) ? idx : 63u);
+        }
+
+        uint32_t profileBucketUpper(uint8_t idx) noexcept
+        {
+            if (idx < 4)
+                return idx;
+            const uint32_t msb = (uint32_t)idx / 4u + 1u;
+            const uint32_t lower = (4u + (idx & 3u)) << (msb - 2u);
+            return lower + (1u << (msb - 2u)) - 1u;
+        }
+
+        uint32_t profileNowUs() noexcept
+        {
+            pipcore::Platform *plat = pipcore::GetPlatform();
+            return plat ? plat->nowUs() : 0;
+        }
+    }
 
     void Debug::init()
     {
@@ -36,18 +72,32 @@ namespace pipgui
 
     void Debug::formatStatusBar(char *out, size_t len)
     {
-        if (!_enabled || len == 0)
+        if ((!_enabled && !_profilerEnabled) || len == 0)
         {
             if (len > 0)
                 out[0] = '\0';
             return;
         }
 
-        int written = snprintf(out, len, "T:%dk In:%dk Bl:%dk Mn:%dk",
+        int written = 0;
+        if (_profilerEnabled)
+        {
+            const DebugPhaseStats frame = phaseStats(DebugPhase::Frame);
+            const DebugPhaseStats present = phaseStats(DebugPhase::Present);
+            written = snprintf(out, len, "F:%u/%uus P:%uus Tx:%uk",
+                               (unsigned)frame.avgUs,
+                               (unsigned)frame.p99Us,
+                               (unsigned)present.avgUs,
+                               (unsigned)(_frameCounters.avgBytesPushed / 1024));
+        }
+        else
+        {
+            written = snprintf(out, len, "T:%dk In:%dk Bl:%dk Mn:%dk",
                                (int)(_metrics.freeHeapTotal / 1024),
                                (int)(_metrics.freeHeapInternal / 1024),
                                (int)(_metrics.largestFreeBlock / 1024),
                                (int)(_metrics.minFreeHeap / 1024));
+        }
 
         if (written < 0 || (size_t)written >= len)
         {
@@ -131,4 +181,121 @@ namespace pipgui
         _rectCapacity = 0;
     }
 
+    void Debug::setProfilerEnabled(bool enabled) noexcept
+    {
+        if (enabled && !_profilerEnabled)
+            resetProfile();
+        _profilerEnabled = enabled;
+    }
+
+    void Debug::resetProfile() noexcept
+    {
+        for (PhaseAccum &acc : _phases)
+            acc = PhaseAccum{};
+        _framePixels = 0;
+        _frameBytes = 0;
+        _frameCounters = DebugFrameCounters{};
+        _totalPixels = 0;
+        _totalBytes = 0;
+    }
+
+    void Debug::beginPhase(DebugPhase phase) noexcept
+    {
+        PhaseAccum &acc = _phases[(uint8_t)phase];
+        if (acc.depth++ == 0)
+            acc.startUs = profileNowUs();
+    }
+
+    void Debug::endPhase(DebugPhase phase) noexcept
+    {
+        PhaseAccum &acc = _phases[(uint8_t)phase];
+        if (acc.depth == 0 || --acc.depth != 0)
+            return;
+
+        acc.frameUs += profileNowUs() - acc.startUs;
+        acc.touched = true;
+        if (phase == DebugPhase::Frame)
+            commitFrame();
+    }
+
+    void Debug::recordPhase(PhaseAccum &acc, uint32_t us) noexcept
+    {
+        uint16_t &bucket = acc.hist[profileBucket(us)];
+        if (bucket == UINT16_MAX)
+        {
+            for (uint16_t &count : acc.hist)
+                count >>= 1;
+        }
+        ++bucket;
+
+        if (acc.samples == 0 || us < acc.minUs)
+            acc.minUs = us;
+        if (us > acc.maxUs)
+            acc.maxUs = us;
+        acc.lastUs = us;
+        acc.sumUs += us;
+        ++acc.samples;
+    }
+
+    void Debug::commitFrame() noexcept
+    {
+        for (PhaseAccum &acc : _phases)
+        {
+            if (!acc.touched)
+                continue;
+            recordPhase(acc, acc.frameUs);
+            acc.frameUs = 0;
+            acc.touched = false;
+        }
+
+        _totalPixels += _framePixels;
+        _totalBytes += _frameBytes;
+        ++_frameCounters.frames;
+        _frameCounters.pixelsDrawn = _framePixels;
+        _frameCounters.bytesPushed = _frameBytes;
+        _frameCounters.avgPixelsDrawn = (uint32_t)(_totalPixels / _frameCounters.frames);
+        _frameCounters.avgBytesPushed = (uint32_t)(_totalBytes / _frameCounters.frames);
+        _framePixels = 0;
+        _frameBytes = 0;
+    }
+
+    DebugPhaseStats Debug::phaseStats(DebugPhase phase) noexcept
+    {
+        DebugPhaseStats out;
+        if (phase >= DebugPhase::Count)
+            return out;
+
+        const PhaseAccum &acc = _phases[(uint8_t)phase];
+        if (acc.samples == 0)
+            return out;
+
+        out.samples = acc.samples;
+        out.lastUs = acc.lastUs;
+        out.minUs = acc.minUs;
+        out.maxUs = acc.maxUs;
+        out.avgUs = (uint32_t)(acc.sumUs / acc.samples);
+
+        uint32_t total = 0;
+        for (uint16_t count : acc.hist)
+            total += count;
+        const uint32_t target = total - total / 100;
+        uint32_t seen = 0;
+        for (uint8_t i = 0; i < ProfileBuckets; ++i)
+        {
+            seen += acc.hist[i];
+            if (seen >= target)
+            {
+                const uint32_t upper = profileBucketUpper(i);
+                out.p99Us = (upper < acc.maxUs) ? upper : acc.maxUs;
+                break;
+            }
+        }
+        return out;
+    }
+
+    DebugFrameCounters Debug::frameCounters() noexcept
+    {
+        return _frameCounters;
+    }
+
 }
@@ -12,6 +12,12 @@ namespace pipgui
         uint32_t freeHeapInternal = 0;
         uint32_t largestFreeBlock = 0;
         uint32_t minFreeHeap = 0;
+        uint32_t scratchBytes = 0;
+        uint32_t scratchPeakBytes = 0;
+        uint32_t scratchPeakUsedBytes = 0;
+        uint32_t glyphCacheBytes = 0;
+        uint32_t glyphCacheHits = 0;
+        uint32_t glyphCacheMisses = 0;
 
         DebugMetrics() = default;
     };
@@ -21,6 +27,41 @@ namespace pipgui
         int16_t x, y, w, h;
     };
 
+    enum class DebugPhase : uint8_t
+    {
+        Frame = 0,
+        Screen,
+        StatusBar,
+        Overlays,
+        Present,
+        Blur,
+        Text,
+        Count
+    };
+
+    struct DebugPhaseStats
+    {
+        uint32_t samples = 0;
+        uint32_t lastUs = 0;
+        uint32_t minUs = 0;
+        uint32_t maxUs = 0;
+        uint32_t avgUs = 0;
+        uint32_t p99Us = 0;
+
+        DebugPhaseStats() = default;
+    };
+
+    struct DebugFrameCounters
+    {
+        uint32_t frames = 0;
+        uint32_t pixelsDrawn = 0;
+        uint32_t bytesPushed = 0;
+        uint32_t avgPixelsDrawn = 0;
+        uint32_t avgBytesPushed = 0;
+
+        DebugFrameCounters() = default;
+    };
+
     class Debug
     {
     public:
@@ -47,7 +88,69 @@ namespace pipgui
 
         static void clearRects();
 
+        static void setProfilerEnabled(bool enabled) noexcept;
+        [[nodiscard]] static bool profilerEnabled() noexcept { return _profilerEnabled; }
+        static void resetProfile() noexcept;
+
+        static void beginPhase(DebugPhase phase) noexcept;
+        static void endPhase(DebugPhase phase) noexcept;
+
+        static void recordScratch(uint32_t heldBytes, uint32_t peakHeldBytes, uint32_t peakUsedBytes) noexcept
+        {
+            _metrics.scratchBytes = heldBytes;
+            _metrics.scratchPeakBytes = peakHeldBytes;
+            _metrics.scratchPeakUsedBytes = peakUsedBytes;
+        }
+
+        static void recordGlyphCache(uint32_t bytes, uint32_t hits, uint32_t misses) noexcept
+        {
+            _metrics.glyphCacheBytes = bytes;
+            _metrics.glyphCacheHits = hits;
+            _metrics.glyphCacheMisses = misses;
+        }
+
+        static void addPixelsDrawn(uint32_t px) noexcept
+        {
+            if (_profilerEnabled)
+                _framePixels += px;
+        }
+        static void addBytesPushed(uint32_t bytes) noexcept
+        {
+            if (_profilerEnabled)
+                _frameBytes += bytes;
+        }
+
+        [[nodiscard]] static DebugPhaseStats phaseStats(DebugPhase phase) noexcept;
+        [[nodiscard]] static DebugFrameCounters frameCounters() noexcept;
+
     private:
+        static constexpr uint8_t ProfileBuckets = 64;
+
+        struct PhaseAccum
+        {
+            uint64_t sumUs;
+            uint32_t samples;
+            uint32_t minUs;
+            uint32_t maxUs;
+            uint32_t lastUs;
+            uint32_t startUs;
+            uint32_t frameUs;
+            uint16_t depth;
+            bool touched;
+            uint16_t hist[ProfileBuckets];
+        };
+
+        static void recordPhase(PhaseAccum &acc, uint32_t us) noexcept;
+        static void commitFrame() noexcept;
+
+        static bool _profilerEnabled;
+        static PhaseAccum _phases[(uint8_t)DebugPhase::Count];
+        static uint32_t _framePixels;
+        static uint32_t _frameBytes;
+        static DebugFrameCounters _frameCounters;
+        static uint64_t _totalPixels;
+        static uint64_t _totalBytes;
+
         static DebugMetrics _metrics;
         static bool _enabled;
 
@@ -58,4 +161,28 @@ namespace pipgui
         static uint16_t _rectCount;
     };
 
+    class DebugProbe
+    {
+    public:
+        explicit DebugProbe(DebugPhase phase) noexcept
+            : _phase(phase), _active(Debug::profilerEnabled())
+        {
+            if (_active)
+                Debug::beginPhase(_phase);
+        }
+
+        ~DebugProbe()
+        {
+            if (_active)
+                Debug::endPhase(_phase);
+        }
+
+        DebugProbe(const DebugProbe &) = delete;
+        DebugProbe &operator=(const DebugProbe &) = delete;
+
+    private:
+        DebugPhase _phase;
+        bool _active;
+    };
+
 }
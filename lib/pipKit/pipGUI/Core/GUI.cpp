@@ -5,6 +5,7 @@
 #include <pipGUI/Systems/Network/Wifi.hpp>
 #include <pipGUI/Graphics/Utils/Colors.hpp>
 #include <pipGUI/Graphics/Utils/Easing.hpp>
+#include <pipGUI/Graphics/Draw/ShapeMask.hpp>
 #include <pipCore/Platforms/Select.hpp>
 #include <cstring>
 #include <math.h>
@@ -111,6 +112,42 @@ namespace pipgui
             void writeRect565(int16_t, int16_t, int16_t, int16_t, const uint16_t *, int32_t) override {}
         };
 
+        void presentSnapshotJob(void *ctx)
+        {
+            auto *state = static_cast<detail::PresentState *>(ctx);
+            if (!state)
+                return;
+            for (;;)
+            {
+                uint8_t i = state->presented.load();
+                while (i != state->queued.load())
+                {
+                    const detail::PresentSlot &slot = state->slots[i];
+                    state->display->writeRect565(slot.rect.x, slot.rect.y, slot.rect.w, slot.rect.h,
+                                                 state->snapshot + slot.offset, slot.rect.w);
+                    state->presented.store(++i);
+                }
+                state->draining.store(false);
+                // A rect queued after the last check found draining still set and did not submit.
+                if (i == state->queued.load() || state->draining.exchange(true))
+                    return;
+            }
+        }
+
+        [[nodiscard]] inline uint32_t hashSpan565(const uint16_t *px, int32_t count) noexcept
+        {
+            uint32_t h = 2166136261U;
+            int32_t i = 0;
+            for (; i + 1 < count; i += 2)
+            {
+                h = (h ^ (static_cast<uint32_t>(px[i]) | (static_cast<uint32_t>(px[i + 1]) << 16))) * 0x9E3779B1U;
+                h ^= h >> 15;
+            }
+            if (i < count)
+                h = (h ^ px[i]) * 0x9E3779B1U;
+            return h | 1U;
+        }
+
     }
 
     void GUI::clearReportedPlatformError()
@@ -143,11 +180,19 @@ namespace pipgui
         if (!_disp.display || !_flags.spriteEnabled || w <= 0 || h <= 0)
             return false;
 
+        DebugProbe probe(DebugPhase::Present);
+        if (bandedRender())
+            return presentBanded(x, y, w, h, stage);
+
         if (adaptivePreviewActive())
+        {
+            waitPresent();
             return presentAdaptivePreview(stage);
+        }
 
         if (logicalRotationActive())
         {
+            waitPresent();
             const auto *src = static_cast<const uint16_t *>(_render.sprite.getBuffer());
             return presentOrthogonalRotatedSprite(src,
                                                   _render.sprite.width(),
@@ -157,13 +202,352 @@ namespace pipgui
                                                   stage);
         }
 
+        if (_present.diff)
+            return presentDiff(x, y, w, h, stage);
+
+        return presentRect(x, y, w, h, stage);
+    }
+
+    bool GUI::presentRect(int16_t x, int16_t y, int16_t w, int16_t h, const char *stage)
+    {
+        Debug::addBytesPushed((uint32_t)w * (uint32_t)h * 2U);
+        if (_present.async && presentSpriteAsync(x, y, w, h))
+            return true;
+
+        waitPresent();
+        pipcore::Platform *plat = pipcore::GetPlatform();
+        const uint32_t startUs = plat ? plat->nowUs() : 0;
         _render.sprite.writeToDisplay(*_disp.display, x, y, w, h);
+        if (plat)
+            recordPresentCost((uint32_t)w * (uint32_t)h, plat->nowUs() - startUs);
         reportPlatformErrorOnce(stage);
 
+        return !plat || plat->lastError() == pipcore::PlatformError::None;
+    }
+
+    void GUI::setAsyncPresent(bool enabled)
+    {
+        if (!enabled)
+        {
+            waitPresent();
+            freePresentBuffer(platform());
+        }
+        _present.async = enabled;
+    }
+
+    void GUI::setDiffPresent(bool enabled)
+    {
+        if (!enabled)
+            freeDiffBuffer(platform());
+        _present.diff = enabled;
+        _present.diffValid = false;
+    }
+
+    void GUI::waitPresent() noexcept
+    {
+        if (_present.queued.load() == 0)
+            return;
+        pipcore::Platform *plat = platform();
+        if (plat)
+            plat->waitBackground();
+        _present.queued.store(0);
+        _present.presented.store(0);
+        _present.snapshotUsed = 0;
+        reportPlatformErrorOnce("present");
+    }
+
+    bool GUI::presentSpriteAsync(int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+        const auto *src = static_cast<const uint16_t *>(_render.sprite.getBuffer());
+        const int32_t stride = _render.sprite.width();
+        const int32_t bufY = _render.sprite.bufferY();
+        if (!src || stride <= 0)
+            return false;
+
+        int32_t clipX = 0;
+        int32_t clipY = 0;
+        int32_t clipW = 0;
+        int32_t clipH = 0;
+        _render.sprite.getClipRect(&clipX, &clipY, &clipW, &clipH);
+        const int32_t x0 = std::max<int32_t>(x, clipX);
+        const int32_t y0 = std::max<int32_t>(y, clipY);
+        const int32_t x1 = std::min<int32_t>(static_cast<int32_t>(x) + w, clipX + clipW);
+        const int32_t y1 = std::min<int32_t>(static_cast<int32_t>(y) + h, clipY + clipH);
+        if (x1 <= x0 || y1 <= y0)
+            return true;
+
+        const int32_t cw = x1 - x0;
+        const int32_t ch = y1 - y0;
+        const uint32_t need = static_cast<uint32_t>(cw) * static_cast<uint32_t>(ch);
+
+        pipcore::Platform *plat = platform();
+        if (!plat)
+            return false;
+
+        // An idle worker has sent everything queued, so the slots and snapshot space are recycled
+        // without blocking; the wait below only stalls when the panel is really behind.
+        if (_present.queued.load() != 0 && !plat->backgroundBusy())
+            waitPresent();
+        if (_present.queued.load() >= detail::DIRTY_RECT_MAX || _present.snapshotUsed + need > _present.snapshotCap)
+            waitPresent();
+
+        if (_present.snapshotCap < need)
+        {
+            freePresentBuffer(plat);
+            const uint32_t full = static_cast<uint32_t>(_render.sprite.width()) * static_cast<uint32_t>(_render.sprite.bandLines());
+            const uint32_t cap = std::max(need, full);
+            _present.snapshot = static_cast<uint16_t *>(detail::alloc(plat, cap * sizeof(uint16_t), pipcore::AllocCaps::Default));
+            if (!_present.snapshot)
+            {
+                _present.async = false;
+                return false;
+            }
+            _present.snapshotCap = cap;
+        }
+
+        const uint8_t index = _present.queued.load();
+        detail::PresentSlot &slot = _present.slots[index];
+        slot.rect = {static_cast<int16_t>(x0), static_cast<int16_t>(y0),
+                     static_cast<int16_t>(cw), static_cast<int16_t>(ch)};
+        slot.offset = _present.snapshotUsed;
+
+        const uint16_t *row = src + static_cast<size_t>(y0 - bufY) * stride + x0;
+        uint16_t *dst = _present.snapshot + slot.offset;
+        for (int32_t yy = 0; yy < ch; ++yy)
+        {
+            memcpy(dst, row, static_cast<size_t>(cw) * sizeof(uint16_t));
+            row += stride;
+            dst += cw;
+        }
+        _present.snapshotUsed += need;
+
+        if (index == 0)
+            _present.display = _disp.display;
+        _present.queued.store(static_cast<uint8_t>(index + 1));
+        if (_present.draining.exchange(true))
+            return true;
+
+        if (!plat->submitBackground(presentSnapshotJob, &_present))
+        {
+            _present.async = false;
+            presentSnapshotJob(&_present);
+            waitPresent();
+        }
+        return true;
+    }
+
+    void GUI::freePresentBuffer(pipcore::Platform *plat) noexcept
+    {
+        waitPresent();
+        if (_present.snapshot)
+            detail::free(plat, _present.snapshot);
+        _present.snapshot = nullptr;
+        _present.snapshotCap = 0;
+    }
+
+    bool GUI::presentDiff(int16_t x, int16_t y, int16_t w, int16_t h, const char *stage)
+    {
+        const auto *src = static_cast<const uint16_t *>(_render.sprite.getBuffer());
+        const int32_t sw = _render.sprite.width();
+        const int32_t sh = _render.sprite.height();
+        int32_t clipX = 0;
+        int32_t clipY = 0;
+        int32_t clipW = 0;
+        int32_t clipH = 0;
+        _render.sprite.getClipRect(&clipX, &clipY, &clipW, &clipH);
+        if (!src || clipX != 0 || clipY != 0 || clipW != sw || clipH != sh)
+        {
+            invalidateDiffPresent();
+            return presentRect(x, y, w, h, stage);
+        }
+
+        const int32_t x0 = std::max<int32_t>(x, 0);
+        const int32_t y0 = std::max<int32_t>(y, 0);
+        const int32_t x1 = std::min<int32_t>(static_cast<int32_t>(x) + w, sw);
+        const int32_t y1 = std::min<int32_t>(static_cast<int32_t>(y) + h, sh);
+        if (x1 <= x0 || y1 <= y0)
+            return true;
+
+        constexpr int32_t chunk = PIPGUI_DIFF_CHUNK_PX;
+        const uint16_t cols = static_cast<uint16_t>((sw + chunk - 1) / chunk);
+        if (_present.diffCols != cols || _present.diffRows != sh)
+        {
+            pipcore::Platform *plat = platform();
+            freeDiffBuffer(plat);
+            const size_t bytes = static_cast<size_t>(cols) * static_cast<size_t>(sh) * sizeof(uint32_t);
+            _present.diffHashes = static_cast<uint32_t *>(detail::alloc(plat, bytes, pipcore::AllocCaps::Default));
+            if (!_present.diffHashes)
+            {
+                _present.diff = false;
+                return presentRect(x, y, w, h, stage);
+            }
+            _present.diffCols = cols;
+            _present.diffRows = static_cast<uint16_t>(sh);
+        }
+
+        if (!_present.diffValid)
+        {
+            memset(_present.diffHashes, 0, static_cast<size_t>(cols) * _present.diffRows * sizeof(uint32_t));
+            _present.diffValid = true;
+        }
+
+        const int32_t c0 = x0 / chunk;
+        const int32_t c1 = (x1 - 1) / chunk;
+        int32_t runY = -1;
+        int32_t runC0 = 0;
+        int32_t runC1 = 0;
+        bool ok = true;
+        const bool batch = !_present.async;
+
+        const auto flushRun = [&](int32_t endY)
+        {
+            if (runY < 0)
+                return;
+            const int32_t rx = runC0 * chunk;
+            const int32_t rw = std::min<int32_t>((runC1 + 1) * chunk, sw) - rx;
+            if (!presentRect(static_cast<int16_t>(rx), static_cast<int16_t>(runY),
+                             static_cast<int16_t>(rw), static_cast<int16_t>(endY - runY), stage))
+            {
+                // The run never reached the panel: forget its hashes so the next present resends it.
+                for (int32_t ry = runY; ry < endY; ++ry)
+                    memset(_present.diffHashes + static_cast<size_t>(ry) * cols + runC0, 0,
+                           static_cast<size_t>(runC1 - runC0 + 1) * sizeof(uint32_t));
+                ok = false;
+            }
+            runY = -1;
+        };
+
+        if (batch)
+            _disp.display->beginBatch();
+
+        for (int32_t yy = y0; yy < y1; ++yy)
+        {
+            const uint16_t *row = src + static_cast<size_t>(yy) * sw;
+            uint32_t *hashes = _present.diffHashes + static_cast<size_t>(yy) * cols;
+            int32_t rowC0 = -1;
+            int32_t rowC1 = -1;
+            for (int32_t c = c0; c <= c1; ++c)
+            {
+                const int32_t px = c * chunk;
+                const uint32_t hv = hashSpan565(row + px, std::min<int32_t>(chunk, sw - px));
+                if (hv == hashes[c])
+                    continue;
+                hashes[c] = hv;
+                if (rowC0 < 0)
+                    rowC0 = c;
+                rowC1 = c;
+            }
+
+            if (runY >= 0 && rowC0 == runC0 && rowC1 == runC1)
+                continue;
+            flushRun(yy);
+            if (rowC0 >= 0)
+            {
+                runY = yy;
+                runC0 = rowC0;
+                runC1 = rowC1;
+            }
+        }
+        flushRun(y1);
+
+        if (batch)
+            _disp.display->endBatch();
+        return ok;
+    }
+
+    void GUI::freeDiffBuffer(pipcore::Platform *plat) noexcept
+    {
+        if (_present.diffHashes)
+            detail::free(plat, _present.diffHashes);
+        _present.diffHashes = nullptr;
+        _present.diffCols = 0;
+        _present.diffRows = 0;
+        _present.diffValid = false;
+    }
+
+    bool GUI::presentBanded(int16_t x, int16_t y, int16_t w, int16_t h, const char *stage)
+    {
+        if (_flags.bandPass)
+            return true;
+
+        invalidateDiffPresent();
+
+        const int32_t x0 = std::max<int32_t>(x, 0);
+        const int32_t y0 = std::max<int32_t>(y, 0);
+        const int32_t x1 = std::min<int32_t>(static_cast<int32_t>(x) + w, _render.screenWidth);
+        const int32_t y1 = std::min<int32_t>(static_cast<int32_t>(y) + h, _render.screenHeight);
+        if (x1 <= x0 || y1 <= y0)
+            return true;
+
+        const bool prevRender = _flags.inSpritePass;
+        pipcore::Sprite *prevActive = _render.activeSprite;
+        const ClipState prevClip = _clip;
+        const int16_t lines = _render.sprite.bandLines();
+        const int16_t bandW = static_cast<int16_t>(x1 - x0);
+
+        _flags.bandPass = 1;
+        _flags.inSpritePass = 1;
+        _render.activeSprite = &_render.sprite;
+
+        for (int32_t by = y0; by < y1; by += lines)
+        {
+            const int16_t bandY = static_cast<int16_t>(by);
+            const int16_t bandH = static_cast<int16_t>(std::min<int32_t>(lines, y1 - by));
+            _render.sprite.setBandOrigin(bandY);
+            _clip = {};
+            applyClip(static_cast<int16_t>(x0), bandY, bandW, bandH);
+            renderBandFrame();
+            Debug::addPixelsDrawn((uint32_t)bandW * (uint32_t)bandH);
+            Debug::addBytesPushed((uint32_t)bandW * (uint32_t)bandH * 2U);
+
+            _render.sprite.setClipRect(static_cast<int16_t>(x0), bandY, bandW, bandH);
+            if (_present.async && presentSpriteAsync(static_cast<int16_t>(x0), bandY, bandW, bandH))
+                continue;
+            waitPresent();
+            _render.sprite.writeToDisplay(*_disp.display, static_cast<int16_t>(x0), bandY, bandW, bandH);
+            reportPlatformErrorOnce(stage);
+        }
+
+        _clip = prevClip;
+        _render.activeSprite = prevActive;
+        _flags.inSpritePass = prevRender;
+        _flags.bandPass = 0;
+
         pipcore::Platform *plat = pipcore::GetPlatform();
         return !plat || plat->lastError() == pipcore::PlatformError::None;
     }
 
+    void GUI::renderBandFrame()
+    {
+        const uint32_t now = nowMs();
+        if (_flags.bootActive)
+        {
+            renderBootBand();
+        }
+        else if (_flags.errorActive)
+        {
+            renderErrorFrame(now);
+        }
+        else
+        {
+            const ScreenCallback cb = (_screen.current < _screen.capacity && _screen.callbacks)
+                                          ? _screen.callbacks[_screen.current]
+                                          : nullptr;
+            renderScreenToMainSprite(cb, _screen.current);
+            renderStatusBar();
+
+            DirtyRect popup = {};
+            if (!_flags.notifActive && computePopupBounds(now, popup))
+                renderPopupMenuOverlay(now);
+        }
+
+        if (_flags.notifActive)
+            renderNotificationOverlay();
+        DirtyRect toast = {};
+        if (computeToastBounds(now, toast))
+            renderToastOverlay(now);
+    }
+
     detail::ButtonState &GUI::resolveButtonState(const String &label, int16_t x, int16_t y,
                                                  int16_t w, int16_t h, uint16_t baseColor, uint8_t radius,
                                                  IconId iconId)
@@ -338,7 +722,10 @@ namespace pipgui
     {
         pipcore::Platform *plat = pipcore::GetPlatform();
 
-        freeBlurBuffers(plat);
+        releaseBlurWorkBuffers();
+        freeBlurCache(plat);
+        detail::clearShapeMaskCache();
+        _glyphCache.clear(plat);
         freeGraphAreas(plat);
         freeLists(plat);
         freeTiles(plat);
@@ -349,8 +736,12 @@ namespace pipgui
         freeScreenshotGallery(plat);
         freeScreenshotStream(plat);
 #endif
-        freeAdaptivePreviewBuffer(plat);
+        freePresentBuffer(plat);
+        freeDiffBuffer(plat);
+        freeDisplayList(plat);
+        freeLayers();
         freeRotationBuffer(plat);
+        _scratch.clear(plat);
         _render.sprite.deleteSprite();
         _flags.spriteEnabled = 0;
     }
@@ -411,25 +802,10 @@ namespace pipgui
         }
     };
 
-    void GUI::freeBlurBuffers(pipcore::Platform *plat) noexcept
-    {
-        safeFree(plat, _blur.smallIn);
-        safeFree(plat, _blur.smallTmp);
-        safeFree(plat, _blur.rowR);
-        safeFree(plat, _blur.rowG);
-        safeFree(plat, _blur.rowB);
-        safeFree(plat, _blur.colR);
-        safeFree(plat, _blur.colG);
-        safeFree(plat, _blur.colB);
-        safeFree(plat, _blur.lookup);
-        _blur.workLen = 0;
-        _blur.rowCap = 0;
-        _blur.colCap = 0;
-        _blur.lookupSw = 0;
-        _blur.lookupSh = 0;
-        _blur.lookupW = 0;
-        _blur.lookupH = 0;
-        _blur.lastUseMs = 0;
+    void GUI::releaseBlurWorkBuffers() noexcept
+    {
+        _scratch.release(platform(), _blur.work);
+        _blur = detail::BlurState();
     }
 
     void GUI::freeGraphAreas(pipcore::Platform *plat) noexcept
@@ -526,8 +902,11 @@ namespace pipgui
 
     void GUI::resetDisplayRuntime() noexcept
     {
-        freeAdaptivePreviewBuffer(platform());
+        freePresentBuffer(platform());
+        freeDiffBuffer(platform());
         freeRotationBuffer(platform());
+        _adaptivePreview.lastPresentedW = 0;
+        _adaptivePreview.lastPresentedH = 0;
         _disp.display = nullptr;
         _render.physicalWidth = 0;
         _render.physicalHeight = 0;
@@ -695,6 +1074,11 @@ namespace pipgui
         Debug::init();
         _status.dirtyMask = StatusBarDirtyAll;
 #endif
+#if PIPGUI_DEBUG_PROFILER
+        _flags.statusBarDebugMetrics = true;
+        Debug::setProfilerEnabled(true);
+        _status.dirtyMask = StatusBarDirtyAll;
+#endif
 
         if (_disp.cfgConfigured)
         {
@@ -728,7 +1112,7 @@ namespace pipgui
 
         _render.sprite.setPlatform(plat);
 
-        _flags.spriteEnabled = _render.sprite.createSprite((int16_t)_render.screenWidth, (int16_t)_render.screenHeight);
+        _flags.spriteEnabled = createRenderSprite();
         _render.activeSprite = _flags.spriteEnabled ? &_render.sprite : nullptr;
 
         if (_flags.spriteEnabled)
@@ -779,6 +1163,7 @@ namespace pipgui
     bool GUI::adaptivePreviewActive() const noexcept
     {
         return _adaptivePreview.enabled &&
+               !bandedRender() &&
                _render.physicalWidth > 0 &&
                _render.physicalHeight > 0;
     }
@@ -809,9 +1194,13 @@ namespace pipgui
     bool GUI::presentOrthogonalRotatedSprite(const uint16_t *src, int16_t srcStride, int16_t srcW, int16_t srcH,
                                              uint8_t rotationDelta, const char *stage)
     {
+        invalidateDiffPresent();
+
         if (!_disp.display || !src || srcStride <= 0 || srcW <= 0 || srcH <= 0)
             return false;
 
+        waitPresent();
+
         const uint16_t physW = _disp.display->width();
         const uint16_t physH = _disp.display->height();
         if (physW == 0 || physH == 0)
@@ -825,21 +1214,9 @@ namespace pipgui
             return !plat || plat->lastError() == pipcore::PlatformError::None;
         }
 
-        if (_rotationAnim.lineBufCap < physW)
-        {
-            pipcore::Platform *plat = platform();
-            uint16_t *newBuf = plat ? static_cast<uint16_t *>(plat->alloc(static_cast<size_t>(physW) * sizeof(uint16_t), pipcore::AllocCaps::PreferInternal)) : nullptr;
-            if (!newBuf)
-                newBuf = plat ? static_cast<uint16_t *>(plat->alloc(static_cast<size_t>(physW) * sizeof(uint16_t), pipcore::AllocCaps::Default)) : nullptr;
-            if (newBuf)
-            {
-                freeRotationBuffer(plat);
-                _rotationAnim.lineBuf = newBuf;
-                _rotationAnim.lineBufCap = physW;
-            }
-        }
-
-        if (!_rotationAnim.lineBuf || _rotationAnim.lineBufCap < physW)
+        detail::ScratchLease line(_scratch, platform(), (uint32_t)physW * sizeof(uint16_t), pipcore::AllocCaps::PreferInternal);
+        uint16_t *lineBuf = line.as<uint16_t>();
+        if (!lineBuf)
             return false;
 
         for (int16_t y = 0; y < physH; ++y)
@@ -850,7 +1227,7 @@ namespace pipgui
             {
                 const int16_t srcX = y;
                 for (int16_t x = 0; x < physW; ++x)
-                    _rotationAnim.lineBuf[x] = src[(size_t)(srcH - 1 - x) * (size_t)srcStride + (size_t)srcX];
+                    lineBuf[x] = src[(size_t)(srcH - 1 - x) * (size_t)srcStride + (size_t)srcX];
                 break;
             }
             case 2:
@@ -858,19 +1235,19 @@ namespace pipgui
                 const int16_t srcY = srcH - 1 - y;
                 const uint16_t *srcRow = src + (size_t)srcY * (size_t)srcStride;
                 for (int16_t x = 0; x < physW; ++x)
-                    _rotationAnim.lineBuf[x] = srcRow[srcW - 1 - x];
+                    lineBuf[x] = srcRow[srcW - 1 - x];
                 break;
             }
             case 3:
             {
                 const int16_t srcX = srcW - 1 - y;
                 for (int16_t x = 0; x < physW; ++x)
-                    _rotationAnim.lineBuf[x] = src[(size_t)x * (size_t)srcStride + (size_t)srcX];
+                    lineBuf[x] = src[(size_t)x * (size_t)srcStride + (size_t)srcX];
                 break;
             }
             }
 
-            _disp.display->writeRect565(0, y, physW, 1, _rotationAnim.lineBuf, physW);
+            _disp.display->writeRect565(0, y, physW, 1, lineBuf, physW);
         }
 
         reportPlatformErrorOnce(stage);
@@ -878,16 +1255,6 @@ namespace pipgui
         return !plat || plat->lastError() == pipcore::PlatformError::None;
     }
 
-    void GUI::freeAdaptivePreviewBuffer(pipcore::Platform *plat) noexcept
-    {
-        if (_adaptivePreview.lineBuf && plat)
-            plat->free(_adaptivePreview.lineBuf);
-        _adaptivePreview.lineBuf = nullptr;
-        _adaptivePreview.lineBufCap = 0;
-        _adaptivePreview.lastPresentedW = 0;
-        _adaptivePreview.lastPresentedH = 0;
-    }
-
     void GUI::freeRotationBuffer(pipcore::Platform *plat) noexcept
     {
         if (_rotationAnim.snapshot && plat)
@@ -896,10 +1263,6 @@ namespace pipgui
         _rotationAnim.snapshotW = 0;
         _rotationAnim.snapshotH = 0;
         _rotationAnim.snapshotStride = 0;
-        if (_rotationAnim.lineBuf && plat)
-            plat->free(_rotationAnim.lineBuf);
-        _rotationAnim.lineBuf = nullptr;
-        _rotationAnim.lineBufCap = 0;
     }
 
     void GUI::serviceAdaptivePreview(uint32_t now) noexcept
@@ -941,6 +1304,8 @@ namespace pipgui
 
     bool GUI::presentAdaptivePreview(const char *stage)
     {
+        invalidateDiffPresent();
+
         if (!_disp.display || !_flags.spriteEnabled)
             return false;
 
@@ -963,33 +1328,21 @@ namespace pipgui
             return !plat || plat->lastError() == pipcore::PlatformError::None;
         }
 
-        if (_adaptivePreview.lineBufCap < physW)
-        {
-            pipcore::Platform *plat = platform();
-            uint16_t *newBuf = plat ? static_cast<uint16_t *>(plat->alloc(static_cast<size_t>(physW) * sizeof(uint16_t), pipcore::AllocCaps::PreferInternal)) : nullptr;
-            if (!newBuf)
-                newBuf = plat ? static_cast<uint16_t *>(plat->alloc(static_cast<size_t>(physW) * sizeof(uint16_t), pipcore::AllocCaps::Default)) : nullptr;
-            if (newBuf)
-            {
-                freeAdaptivePreviewBuffer(plat);
-                _adaptivePreview.lineBuf = newBuf;
-                _adaptivePreview.lineBufCap = physW;
-            }
-        }
-
-        const bool canClearStrips = (_adaptivePreview.lineBuf && _adaptivePreview.lineBufCap >= physW);
+        detail::ScratchLease line(_scratch, platform(), (uint32_t)physW * sizeof(uint16_t), pipcore::AllocCaps::PreferInternal);
+        uint16_t *lineBuf = line.as<uint16_t>();
+        const bool canClearStrips = lineBuf != nullptr;
         if (canClearStrips)
         {
             const uint16_t bg = __builtin_bswap16(_render.bgColor565);
             for (uint16_t x = 0; x < physW; ++x)
-                _adaptivePreview.lineBuf[x] = bg;
+                lineBuf[x] = bg;
 
             if (_adaptivePreview.lastPresentedW == 0 || _adaptivePreview.lastPresentedH == 0)
             {
                 for (uint16_t y = 0; y < physH; ++y)
                 {
                     _disp.display->writeRect565(0, static_cast<int16_t>(y), static_cast<int16_t>(physW), 1,
-                                                _adaptivePreview.lineBuf, static_cast<int32_t>(physW));
+                                                lineBuf, static_cast<int32_t>(physW));
                 }
             }
             else
@@ -1001,7 +1354,7 @@ namespace pipgui
                     for (int16_t y = 0; y < clearH; ++y)
                     {
                         _disp.display->writeRect565((int16_t)virtW, y, clearW, 1,
-                                                    _adaptivePreview.lineBuf, clearW);
+                                                    lineBuf, clearW);
                     }
                 }
 
@@ -1012,7 +1365,7 @@ namespace pipgui
                     for (int16_t y = 0; y < clearH; ++y)
                     {
                         _disp.display->writeRect565(0, (int16_t)(virtH + y), clearW, 1,
-                                                    _adaptivePreview.lineBuf, clearW);
+                                                    lineBuf, clearW);
                     }
                 }
             }
@@ -1034,6 +1387,8 @@ namespace pipgui
     bool GUI::presentTransformedSprite(const uint16_t *src, int16_t srcStride, int16_t srcW, int16_t srcH,
                                        float angleRad, float scale, const char *stage)
     {
+        invalidateDiffPresent();
+
         if (!_disp.display || !src || srcStride <= 0 || srcW <= 0 || srcH <= 0)
             return false;
 
@@ -1042,21 +1397,9 @@ namespace pipgui
         if (physW == 0 || physH == 0)
             return false;
 
-        if (_rotationAnim.lineBufCap < physW)
-        {
-            pipcore::Platform *plat = platform();
-            uint16_t *newBuf = plat ? static_cast<uint16_t *>(plat->alloc(static_cast<size_t>(physW) * sizeof(uint16_t), pipcore::AllocCaps::PreferInternal)) : nullptr;
-            if (!newBuf)
-                newBuf = plat ? static_cast<uint16_t *>(plat->alloc(static_cast<size_t>(physW) * sizeof(uint16_t), pipcore::AllocCaps::Default)) : nullptr;
-            if (newBuf)
-            {
-                freeRotationBuffer(plat);
-                _rotationAnim.lineBuf = newBuf;
-                _rotationAnim.lineBufCap = physW;
-            }
-        }
-
-        if (!_rotationAnim.lineBuf || _rotationAnim.lineBufCap < physW)
+        detail::ScratchLease line(_scratch, platform(), (uint32_t)physW * sizeof(uint16_t), pipcore::AllocCaps::PreferInternal);
+        uint16_t *lineBuf = line.as<uint16_t>();
+        if (!lineBuf)
             return false;
 
         const float safeScale = (scale < 0.08f) ? 0.08f : ((scale > 1.15f) ? 1.15f : scale);
@@ -1070,7 +1413,7 @@ namespace pipgui
         const uint16_t bg = __builtin_bswap16(_render.bgColor565);
 
         for (uint16_t x = 0; x < physW; ++x)
-            _rotationAnim.lineBuf[x] = bg;
+            lineBuf[x] = bg;
 
         for (uint16_t y = 0; y < physH; ++y)
         {
@@ -1084,14 +1427,14 @@ namespace pipgui
                 const int16_t srcXi = (int16_t)lroundf(srcXf);
                 const int16_t srcYi = (int16_t)lroundf(srcYf);
                 if (srcXi < 0 || srcYi < 0 || srcXi >= srcW || srcYi >= srcH)
-                    _rotationAnim.lineBuf[x] = bg;
+                    lineBuf[x] = bg;
                 else
-                    _rotationAnim.lineBuf[x] = src[(size_t)srcYi * (size_t)srcStride + (size_t)srcXi];
+                    lineBuf[x] = src[(size_t)srcYi * (size_t)srcStride + (size_t)srcXi];
                 srcXf += stepX;
                 srcYf += stepY;
             }
 
-            _disp.display->writeRect565(0, (int16_t)y, (int16_t)physW, 1, _rotationAnim.lineBuf, physW);
+            _disp.display->writeRect565(0, (int16_t)y, (int16_t)physW, 1, lineBuf, physW);
         }
 
         reportPlatformErrorOnce(stage);
@@ -1107,7 +1450,59 @@ namespace pipgui
         _render.screenHeight = quarterTurn ? _render.physicalWidth : _render.physicalHeight;
 
         _render.sprite.deleteSprite();
-        _flags.spriteEnabled = _render.sprite.createSprite((int16_t)_render.screenWidth, (int16_t)_render.screenHeight);
+        _flags.spriteEnabled = createRenderSprite();
+        _render.activeSprite = _flags.spriteEnabled ? &_render.sprite : nullptr;
+        _clip = {};
+        _dirty.count = 0;
+        return _flags.spriteEnabled;
+    }
+
+    bool GUI::createRenderSprite()
+    {
+        invalidateDiffPresent();
+
+        const int16_t w = (int16_t)_render.screenWidth;
+        const int16_t h = (int16_t)_render.screenHeight;
+#if !PIPGUI_BANDED_RENDER
+        if (_render.sprite.createSprite(w, h))
+        {
+#if PIPGUI_HOT_BAND_LINES > 0
+            pipcore::Platform *plat = platform();
+            if (plat && !plat->isInternal(_render.sprite.getBuffer()))
+                (void)_render.sprite.createHotBand((int16_t)PIPGUI_HOT_BAND_LINES);
+#endif
+            return true;
+        }
+#endif
+#if PIPGUI_BAND_LINES > 0
+        return _render.sprite.createBand(w, h, (int16_t)PIPGUI_BAND_LINES);
+#else
+        return false;
+#endif
+    }
+
+    bool GUI::applyBandedRotation(uint8_t rotation)
+    {
+        pipcore::Platform *plat = platform();
+        if (!plat || !_disp.display)
+            return false;
+
+        waitPresent();
+        if (!plat->setDisplayRotation(rotation))
+        {
+            reportPlatformErrorOnce("rotation");
+            return false;
+        }
+
+        _disp.physicalRotation = rotation & 3U;
+        _disp.rotation = _disp.physicalRotation;
+        _render.physicalWidth = _disp.display->width();
+        _render.physicalHeight = _disp.display->height();
+        _render.screenWidth = _render.physicalWidth;
+        _render.screenHeight = _render.physicalHeight;
+
+        _render.sprite.deleteSprite();
+        _flags.spriteEnabled = createRenderSprite();
         _render.activeSprite = _flags.spriteEnabled ? &_render.sprite : nullptr;
         _clip = {};
         _dirty.count = 0;
@@ -1125,6 +1520,13 @@ namespace pipgui
             freeRotationBuffer(platform());
         }
 
+        if (bandedRender())
+        {
+            if (_disp.rotation != rotation && applyBandedRotation(rotation))
+                requestRedraw();
+            return;
+        }
+
         if (!_disp.display || !_flags.spriteEnabled ||
             _flags.bootActive || _flags.errorActive || _flags.notifActive ||
             _flags.popupActive || _flags.toastActive || _flags.screenTransition)
@@ -1195,6 +1597,8 @@ namespace pipgui
         if (!_rotationAnim.active || !_disp.display || !_flags.spriteEnabled)
             return;
 
+        waitPresent();
+
         const uint32_t duration = _rotationAnim.durationMs ? _rotationAnim.durationMs : 1;
         uint32_t elapsed = now - _rotationAnim.startMs;
         if (elapsed > duration)
@@ -4,7 +4,10 @@
 #include <pipCore/Graphics/Sprite.hpp>
 #include <pipGUI/Core/Types.hpp>
 #include <pipGUI/Core/Internal/GuiState.hpp>
+#include <pipGUI/Core/Internal/Scratch.hpp>
 #include <pipGUI/Graphics/Utils/Colors.hpp>
+#include <pipGUI/Graphics/Text/Fonts/ShapedText.hpp>
+#include <pipGUI/Graphics/Text/Fonts/GlyphCache.hpp>
 #include <pipGUI/Systems/Network/Wifi.hpp>
 #include <pipGUI/Systems/Update/Ota.hpp>
 
@@ -47,6 +50,13 @@ namespace pipgui
     using DrawGlowCircleFluent = GlowCircleFluentT<false>;
     using UpdateGlowCircleFluent = GlowCircleFluentT<true>;
 
+    template <bool IsUpdate, bool Squircle>
+    struct GlowRectFluentT;
+    using DrawGlowRoundRectFluent = GlowRectFluentT<false, false>;
+    using UpdateGlowRoundRectFluent = GlowRectFluentT<true, false>;
+    using DrawGlowSquircleRectFluent = GlowRectFluentT<false, true>;
+    using UpdateGlowSquircleRectFluent = GlowRectFluentT<true, true>;
+
     template <bool IsUpdate>
     struct ToggleSwitchFluentT;
     using DrawToggleSwitchFluent = ToggleSwitchFluentT<false>;
@@ -172,6 +182,16 @@ namespace pipgui
         void setAdaptivePreview(uint16_t minWidth, uint16_t minHeight, uint32_t cycleMs = 3600);
         void clearAdaptivePreview() noexcept;
         void setRotation(uint8_t rotation, uint32_t durationMs = 520);
+        void setAsyncPresent(bool enabled);
+        [[nodiscard]] bool asyncPresentEnabled() const noexcept { return _present.async; }
+        void waitPresent() noexcept;
+        void setDiffPresent(bool enabled);
+        [[nodiscard]] bool diffPresentEnabled() const noexcept { return _present.diff; }
+        void invalidateDiffPresent() noexcept { _present.diffValid = false; }
+        void setDisplayList(bool enabled);
+        [[nodiscard]] bool displayListEnabled() const noexcept { return _displayList.enabled; }
+        void releaseScratch() noexcept;
+        [[nodiscard]] bool bandedRender() const noexcept { return _render.sprite.banded(); }
         [[nodiscard]] uint8_t screenRotation() const noexcept { return _disp.rotation; }
         [[nodiscard]] bool rotationTransitionActive() const noexcept;
 
@@ -201,6 +221,15 @@ namespace pipgui
         uint16_t rgb(uint8_t r, uint8_t g, uint8_t b) const;
         void clear(uint16_t color = 0x0000);
 
+        [[nodiscard]] bool beginLayer(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h, int32_t keyColor = -1);
+        void endLayer();
+        void compositeLayer(uint8_t layer, uint8_t opacity = 255, int16_t dx = 0, int16_t dy = 0);
+        [[nodiscard]] bool beginAlphaLayer(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h,
+                                           LayerAlpha format = LayerAlpha::Gray8);
+        void compositeAlphaLayer(uint8_t layer, uint16_t color565, uint8_t opacity = 255, int16_t dx = 0, int16_t dy = 0);
+        [[nodiscard]] bool layerReady(uint8_t layer) const noexcept;
+        void releaseLayer(uint8_t layer);
+
         [[nodiscard]] DrawRectFluent drawRect();
         [[nodiscard]] GradientVerticalFluent gradientVertical();
         [[nodiscard]] GradientHorizontalFluent gradientHorizontal();
@@ -217,9 +246,14 @@ namespace pipgui
 
         [[nodiscard]] DrawBlurFluent drawBlur();
         [[nodiscard]] UpdateBlurFluent updateBlur();
+        void invalidateBlurCache() noexcept;
 
         [[nodiscard]] DrawGlowCircleFluent drawGlowCircle();
         [[nodiscard]] UpdateGlowCircleFluent updateGlowCircle();
+        [[nodiscard]] DrawGlowRoundRectFluent drawGlowRoundRect();
+        [[nodiscard]] UpdateGlowRoundRectFluent updateGlowRoundRect();
+        [[nodiscard]] DrawGlowSquircleRectFluent drawGlowSquircleRect();
+        [[nodiscard]] UpdateGlowSquircleRectFluent updateGlowSquircleRect();
 
         [[nodiscard]] DrawScrollDotsFluent drawScrollDots();
         [[nodiscard]] UpdateScrollDotsFluent updateScrollDots();
@@ -301,6 +335,9 @@ namespace pipgui
         void requestRedraw();
         void setScreenAnim(ScreenAnim anim, uint32_t durationMs);
         void clearClip();
+        bool pushClip(int16_t x, int16_t y, int16_t w, int16_t h);
+        void popClip();
+        [[nodiscard]] bool quickReject(int16_t x, int16_t y, int16_t w, int16_t h) const noexcept;
 
         void setNotificationButtonDown(bool down);
         [[nodiscard]] bool notificationActive() const noexcept;
@@ -341,7 +378,13 @@ namespace pipgui
         detail::DisplayState _disp;
         detail::RenderState _render;
         detail::ClipState _clip;
+        detail::ClipStack _clipStack;
         detail::DirtyState _dirty;
+        detail::PresentState _present;
+        detail::DisplayListState _displayList;
+        detail::LayerState _layers;
+        detail::ScratchPool _scratch;
+        detail::GlyphCache _glyphCache;
         detail::ScreenState _screen;
         detail::BootState _boot;
         detail::TypographyState _typo;
@@ -351,12 +394,14 @@ namespace pipgui
         detail::PopupMenuState _popup;
         detail::StatusBarState _status;
         detail::BlurState _blur;
+        detail::BlurCacheState _blurCache;
         detail::Flags _flags = {};
         detail::DiagnosticsState _diag;
         InputState _input = {};
         detail::ButtonCacheState _buttonCache;
         detail::SliderCacheState _sliderCache;
         detail::TextCacheState _textCache;
+        ShapedText _textRun;
         detail::ToggleCacheState _toggleCache;
         detail::DrumRollCacheState _drumRollCache;
         detail::ScreenshotGalleryState _shots;
@@ -373,8 +418,26 @@ namespace pipgui
                                                           uint8_t rotationDelta, const char *stage);
         void serviceAdaptivePreview(uint32_t now) noexcept;
         [[nodiscard]] bool presentAdaptivePreview(const char *stage);
-        void freeAdaptivePreviewBuffer(pipcore::Platform *plat) noexcept;
         void freeRotationBuffer(pipcore::Platform *plat) noexcept;
+        [[nodiscard]] bool presentSpriteAsync(int16_t x, int16_t y, int16_t w, int16_t h);
+        void freePresentBuffer(pipcore::Platform *plat) noexcept;
+        [[nodiscard]] bool presentRect(int16_t x, int16_t y, int16_t w, int16_t h, const char *stage);
+        [[nodiscard]] bool presentDiff(int16_t x, int16_t y, int16_t w, int16_t h, const char *stage);
+        void freeDiffBuffer(pipcore::Platform *plat) noexcept;
+        [[nodiscard]] detail::DrawCommand *recordCommand(detail::DrawOp op, int16_t x, int16_t y, int16_t w, int16_t h,
+                                                         uint16_t payloadBytes = 0) noexcept;
+        [[nodiscard]] bool recordDisplayList(ScreenCallback cb);
+        void replayDisplayList(int16_t x, int16_t y, int16_t w, int16_t h);
+        void freeDisplayList(pipcore::Platform *plat) noexcept;
+        void freeLayers() noexcept;
+        [[nodiscard]] bool beginLayerSlot(uint8_t slot, int16_t x, int16_t y, int16_t w, int16_t h, int32_t keyColor);
+        void compositeLayerSlot(uint8_t slot, uint8_t opacity, int16_t dx, int16_t dy);
+        [[nodiscard]] bool beginAlphaLayerSlot(uint8_t slot, int16_t x, int16_t y, int16_t w, int16_t h, LayerAlpha format);
+        void compositeAlphaLayerSlot(uint8_t slot, uint16_t color565, uint8_t opacity, int16_t dx, int16_t dy);
+        [[nodiscard]] bool createRenderSprite();
+        [[nodiscard]] bool presentBanded(int16_t x, int16_t y, int16_t w, int16_t h, const char *stage);
+        void renderBandFrame();
+        [[nodiscard]] bool applyBandedRotation(uint8_t rotation);
         [[nodiscard]] bool presentTransformedSprite(const uint16_t *src, int16_t srcStride, int16_t srcW, int16_t srcH,
                                                     float angleRad, float scale, const char *stage);
         void renderRotationTransition(uint32_t now);
@@ -435,6 +498,8 @@ namespace pipgui
         bool stepToggleState(detail::ToggleState &state, bool &value, bool pressed);
         void flushDirty();
         void invalidateRect(int16_t x, int16_t y, int16_t w, int16_t h);
+        void recordDirtyPassCost(uint32_t pixels, uint32_t us) noexcept;
+        void recordPresentCost(uint32_t pixels, uint32_t us) noexcept;
         void drawProgressTextSpan(int16_t x, int16_t y, int16_t w, int16_t h,
                                   const String &text, uint16_t textColor565, uint16_t bgColor565,
                                   TextAlign align, uint16_t fontPx,
@@ -467,6 +532,7 @@ namespace pipgui
         void freeScreenState(pipcore::Platform *plat) noexcept;
         void renderScreenTransition(uint32_t now);
         void renderBootFrame(uint32_t now);
+        void renderBootBand();
 
         void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t thickness, uint16_t color);
         void drawLineCore(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
@@ -524,23 +590,20 @@ namespace pipgui
 
         int16_t AutoX(int32_t contentWidth) const;
         int16_t AutoY(int32_t contentHeight) const;
-        bool measureText(const String &text, int16_t &outW, int16_t &outH) const;
+        [[nodiscard]] const ShapedText *shapeText(const String &text);
+        bool measureText(const String &text, int16_t &outW, int16_t &outH);
         void drawTextAligned(const String &text,
                              int16_t x, int16_t y,
                              uint16_t fg565, uint16_t bg565,
                              TextAlign align);
-        void drawTextImmediate(const String &text,
-                               int16_t rx, int16_t ry,
-                               int16_t tw, int16_t th,
-                               uint16_t fg565, uint16_t bg565,
-                               TextAlign align);
-        void drawTextImmediateMasked(const String &text,
-                                     int16_t rx, int16_t ry,
-                                     int16_t tw, int16_t th,
-                                     uint16_t fg565, uint16_t bg565,
-                                     TextAlign align,
-                                     int16_t fadeBoxX, int16_t fadeBoxW,
-                                     uint8_t fadePx);
+        void drawTextAligned(const ShapedText &run,
+                             int16_t x, int16_t y,
+                             uint16_t fg565, uint16_t bg565,
+                             TextAlign align);
+        void drawTextRun(const char *text, int16_t rx, int16_t ry, uint16_t fg565);
+        void drawTextRun(const ShapedText &run,
+                         int16_t rx, int16_t ry, uint16_t fg565,
+                         int16_t fadeBoxX, int16_t fadeBoxW, uint8_t fadePx);
         void drawIconInternal(uint16_t iconId, int16_t x, int16_t y, uint16_t sizePx, uint16_t fg565);
         void updateIconInternal(uint16_t iconId, int16_t x, int16_t y, uint16_t sizePx, uint16_t fg565, uint16_t bg565);
         void drawAnimatedIconInternal(uint16_t iconId, int16_t x, int16_t y, uint16_t sizePx, uint16_t fg565, uint32_t nowMs);
@@ -548,20 +611,37 @@ namespace pipgui
         void drawBootTitleBlock(const String &title, const String &subtitle, uint16_t fg565, uint16_t bg565);
         void drawText(const String &text, int16_t x, int16_t y, uint16_t fg565, uint16_t bg565, TextAlign align = TextAlign::Left);
         void updateText(const String &text, int16_t x, int16_t y, uint16_t fg565, uint16_t bg565, TextAlign align = TextAlign::Left);
+        void drawText(const ShapedText &run, int16_t x, int16_t y, uint16_t fg565, uint16_t bg565, TextAlign align = TextAlign::Left);
+        void updateText(const ShapedText &run, int16_t x, int16_t y, uint16_t fg565, uint16_t bg565, TextAlign align = TextAlign::Left);
         bool drawTextMarquee(const String &text,
                              int16_t x, int16_t y,
                              int16_t maxWidth,
                              uint16_t fg565,
                              TextAlign align = TextAlign::Left,
                              const MarqueeTextOptions &opts = MarqueeTextOptions());
+        bool drawTextMarquee(const ShapedText &run,
+                             int16_t x, int16_t y,
+                             int16_t maxWidth,
+                             uint16_t fg565,
+                             TextAlign align = TextAlign::Left,
+                             const MarqueeTextOptions &opts = MarqueeTextOptions());
         bool drawTextEllipsized(const String &text,
                                 int16_t x, int16_t y,
                                 int16_t maxWidth,
                                 uint16_t fg565,
                                 TextAlign align = TextAlign::Left);
+        bool drawTextEllipsized(const ShapedText &run,
+                                int16_t x, int16_t y,
+                                int16_t maxWidth,
+                                uint16_t fg565,
+                                TextAlign align = TextAlign::Left);
 
-        bool ensureBlurWorkBuffers(uint32_t smallLen, int16_t sw, int16_t sh, int16_t w, int16_t h) noexcept;
-        void freeBlurBuffers(pipcore::Platform *plat) noexcept;
+        bool ensureBlurWorkBuffers(uint32_t smallLen, int16_t sw, int16_t sh, int16_t w, int16_t h, uint16_t kernelRadius) noexcept;
+        void releaseBlurWorkBuffers() noexcept;
+        [[nodiscard]] detail::BlurCacheSlot *findBlurCache(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t radius,
+                                                           int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH) noexcept;
+        void markBlurCacheDirty(int16_t x, int16_t y, int16_t w, int16_t h) noexcept;
+        void freeBlurCache(pipcore::Platform *plat) noexcept;
         void drawBlurRegion(int16_t x, int16_t y, int16_t w, int16_t h,
                             uint8_t radius, BlurDirection dir,
                             bool gradient, uint8_t materialStrength,
@@ -665,6 +745,18 @@ namespace pipgui
                               int16_t bgColor, int16_t glowColor,
                               uint8_t glowSize, uint8_t glowStrength,
                               GlowAnim anim, uint16_t pulsePeriodMs);
+        void drawGlowRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                          uint8_t radius, bool squircle, uint16_t fillColor,
+                          int16_t bgColor, int16_t glowColor,
+                          uint8_t glowSize, uint8_t glowStrength,
+                          GlowAnim anim, uint16_t pulsePeriodMs);
+        void updateGlowRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint8_t radius, bool squircle, uint16_t fillColor,
+                            int16_t bgColor, int16_t glowColor,
+                            uint8_t glowSize, uint8_t glowStrength,
+                            GlowAnim anim, uint16_t pulsePeriodMs);
+        void fillGlowRing(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t r, bool squircle,
+                          uint16_t bg, uint16_t glow, uint8_t glowSize, uint16_t strength);
 
         GraphArea *ensureGraphArea(uint8_t screenId);
         void beginGraphFrame(uint8_t screenId) noexcept;
@@ -702,6 +794,7 @@ namespace pipgui
 
         void renderToastOverlay(uint32_t now);
         bool computeToastBounds(uint32_t now, DirtyRect &outRect);
+        void hideToast() noexcept;
         bool computePopupBounds(uint32_t now, DirtyRect &outRect);
         void renderNotificationOverlay();
         void renderPopupMenuOverlay(uint32_t now);
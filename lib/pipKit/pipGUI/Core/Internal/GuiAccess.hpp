@@ -566,6 +566,42 @@ namespace pipgui
                 gui.updateGlowCircle(x, y, r, fillColor, bgColor, glowColor, glowSize, glowStrength, anim, pulsePeriodMs);
             }
 
+            static void drawGlowRect(GUI &gui,
+                                     int16_t x,
+                                     int16_t y,
+                                     int16_t w,
+                                     int16_t h,
+                                     uint8_t radius,
+                                     bool squircle,
+                                     uint16_t fillColor,
+                                     int16_t bgColor,
+                                     int16_t glowColor,
+                                     uint8_t glowSize,
+                                     uint8_t glowStrength,
+                                     GlowAnim anim,
+                                     uint16_t pulsePeriodMs)
+            {
+                gui.drawGlowRect(x, y, w, h, radius, squircle, fillColor, bgColor, glowColor, glowSize, glowStrength, anim, pulsePeriodMs);
+            }
+
+            static void updateGlowRect(GUI &gui,
+                                       int16_t x,
+                                       int16_t y,
+                                       int16_t w,
+                                       int16_t h,
+                                       uint8_t radius,
+                                       bool squircle,
+                                       uint16_t fillColor,
+                                       int16_t bgColor,
+                                       int16_t glowColor,
+                                       uint8_t glowSize,
+                                       uint8_t glowStrength,
+                                       GlowAnim anim,
+                                       uint16_t pulsePeriodMs)
+            {
+                gui.updateGlowRect(x, y, w, h, radius, squircle, fillColor, bgColor, glowColor, glowSize, glowStrength, anim, pulsePeriodMs);
+            }
+
             static void showToast(GUI &gui,
                                   const String &text,
                                   bool fromTop,
@@ -887,6 +923,17 @@ namespace pipgui
                 gui.drawText(text, x, y, fg565, bg565, align);
             }
 
+            static void drawText(GUI &gui,
+                                 const ShapedText &run,
+                                 int16_t x,
+                                 int16_t y,
+                                 uint16_t fg565,
+                                 uint16_t bg565,
+                                 TextAlign align)
+            {
+                gui.drawText(run, x, y, fg565, bg565, align);
+            }
+
             static void updateText(GUI &gui,
                                    const String &text,
                                    int16_t x,
@@ -898,6 +945,17 @@ namespace pipgui
                 gui.updateText(text, x, y, fg565, bg565, align);
             }
 
+            static void updateText(GUI &gui,
+                                   const ShapedText &run,
+                                   int16_t x,
+                                   int16_t y,
+                                   uint16_t fg565,
+                                   uint16_t bg565,
+                                   TextAlign align)
+            {
+                gui.updateText(run, x, y, fg565, bg565, align);
+            }
+
             static bool drawTextMarquee(GUI &gui,
                                         const String &text,
                                         int16_t x,
@@ -910,6 +968,18 @@ namespace pipgui
                 return gui.drawTextMarquee(text, x, y, maxWidth, fg565, align, opts);
             }
 
+            static bool drawTextMarquee(GUI &gui,
+                                        const ShapedText &run,
+                                        int16_t x,
+                                        int16_t y,
+                                        int16_t maxWidth,
+                                        uint16_t fg565,
+                                        TextAlign align,
+                                        const MarqueeTextOptions &opts)
+            {
+                return gui.drawTextMarquee(run, x, y, maxWidth, fg565, align, opts);
+            }
+
             static bool drawTextEllipsized(GUI &gui,
                                            const String &text,
                                            int16_t x,
@@ -921,6 +991,17 @@ namespace pipgui
                 return gui.drawTextEllipsized(text, x, y, maxWidth, fg565, align);
             }
 
+            static bool drawTextEllipsized(GUI &gui,
+                                           const ShapedText &run,
+                                           int16_t x,
+                                           int16_t y,
+                                           int16_t maxWidth,
+                                           uint16_t fg565,
+                                           TextAlign align)
+            {
+                return gui.drawTextEllipsized(run, x, y, maxWidth, fg565, align);
+            }
+
             static void drawIcon(GUI &gui,
                                  uint16_t iconId,
                                  int16_t x,
@@ -2,9 +2,11 @@
 
 #include <pipCore/Display.hpp>
 #include <pipCore/Graphics/Sprite.hpp>
+#include <pipCore/Graphics/PixelBuffer.hpp>
 #include <pipGUI/Core/Types.hpp>
 #include <pipGUI/Core/Internal/ViewModels.hpp>
 #include <pipGUI/Systems/Update/Ota.hpp>
+#include <atomic>
 
 #if (PIPGUI_SCREENSHOT_MODE == 2)
 #include <FS.h>
@@ -114,8 +116,6 @@ namespace pipgui::detail
         uint32_t startMs = 0;
         uint16_t lastPresentedW = 0;
         uint16_t lastPresentedH = 0;
-        uint16_t *lineBuf = nullptr;
-        uint16_t lineBufCap = 0;
     };
 
     struct RotationState
@@ -130,8 +130,6 @@ namespace pipgui::detail
         uint16_t snapshotW = 0;
         uint16_t snapshotH = 0;
         uint16_t snapshotStride = 0;
-        uint16_t *lineBuf = nullptr;
-        uint16_t lineBufCap = 0;
     };
 
     struct ClipState
@@ -143,6 +141,15 @@ namespace pipgui::detail
         int16_t h = 0;
     };
 
+    inline constexpr uint8_t CLIP_STACK_DEPTH = PIPGUI_CLIP_STACK_DEPTH;
+
+    struct ClipStack
+    {
+        ClipState saved[CLIP_STACK_DEPTH];
+        uint8_t depth = 0;
+        uint8_t overflow = 0;
+    };
+
     struct DirtyRect
     {
         int16_t x = 0;
@@ -151,12 +158,132 @@ namespace pipgui::detail
         int16_t h = 0;
     };
 
-    inline constexpr uint8_t DIRTY_RECT_MAX = 8;
+    inline constexpr uint8_t DIRTY_RECT_MAX = 16;
+
+    // Least-squares fit of the time one dirty-rect pass takes: fixedUs + usPerPx * pixels,
+    // with older samples decayed. rectCostPx is the fixed part expressed in pixels.
+    struct DirtyCostModel
+    {
+        float weight = 0.0f;
+        float sumPx = 0.0f;
+        float sumUs = 0.0f;
+        float sumPxPx = 0.0f;
+        float sumPxUs = 0.0f;
+        float presentUsPerPx = 0.0f;
+        int32_t rectCostPx = 160;
+    };
 
     struct DirtyState
     {
         DirtyRect rects[DIRTY_RECT_MAX] = {};
         uint8_t count = 0;
+        DirtyCostModel cost;
+    };
+
+    struct PresentSlot
+    {
+        DirtyRect rect;
+        uint32_t offset = 0;
+    };
+
+    // Snapshots of presented rects, packed into one buffer and written out by a background job.
+    // The main thread appends and publishes queued; the job advances presented until it catches up.
+    struct PresentState
+    {
+        bool async = false;
+        pipcore::Display *display = nullptr;
+        uint16_t *snapshot = nullptr;
+        uint32_t snapshotCap = 0;
+        uint32_t snapshotUsed = 0;
+        PresentSlot slots[DIRTY_RECT_MAX];
+        std::atomic<uint8_t> queued{0};
+        std::atomic<uint8_t> presented{0};
+        std::atomic<bool> draining{false};
+        bool diff = false;
+        bool diffValid = false;
+        uint32_t *diffHashes = nullptr;
+        uint16_t diffCols = 0;
+        uint16_t diffRows = 0;
+    };
+
+    enum class DrawOp : uint8_t
+    {
+        Clear = 0,
+        FillRect,
+        FillRoundRect,
+        DrawRoundRect,
+        FillSquircleRect,
+        DrawSquircleRect,
+        FillCircle,
+        DrawCircle,
+        Line,
+        Arc,
+        FillEllipse,
+        DrawEllipse,
+        FillTriangle,
+        FillRoundTriangle,
+        DrawRoundTriangle,
+        Text,
+        Icon,
+        Layer,
+        AlphaLayer
+    };
+
+    // One recorded primitive; Text commands are followed by a TypographyState and the characters.
+    struct DrawCommand
+    {
+        DrawOp op = DrawOp::Clear;
+        uint8_t thickness = 0;
+        uint16_t bytes = 0;
+        uint16_t color = 0;
+        uint8_t radius[4] = {};
+        int16_t v[6] = {};
+        float deg[2] = {};
+        ClipState clip;
+        DirtyRect bounds;
+    };
+
+    inline constexpr uint8_t LAYER_MAX = PIPGUI_LAYER_MAX;
+    // One slot past the public ones caches the toast content.
+    inline constexpr uint8_t TOAST_LAYER = LAYER_MAX;
+    inline constexpr uint8_t LAYER_SLOTS = LAYER_MAX + 1;
+    inline constexpr uint8_t INVALID_LAYER_ID = 0xFF;
+
+    // An alpha layer is drawn into sprite like any other, then kept only as coverage or mask
+    // and the sprite is freed.
+    struct LayerSlot
+    {
+        pipcore::Sprite sprite;
+        pipcore::CoverageBuffer coverage;
+        pipcore::MaskBuffer mask;
+        DirtyRect rect;
+        uint16_t key = 0;
+        bool keyed = false;
+        bool alpha = false;
+        LayerAlpha alphaFormat = LayerAlpha::Gray8;
+        bool ready = false;
+    };
+
+    struct LayerState
+    {
+        LayerSlot slots[LAYER_SLOTS];
+        uint8_t active = INVALID_LAYER_ID;
+        bool prevInSpritePass = false;
+        pipcore::Sprite *prevActive = nullptr;
+        ClipState prevClip;
+    };
+
+    struct DisplayListState
+    {
+        uint8_t *buf = nullptr;
+        uint32_t cap = 0;
+        uint32_t used = 0;
+        uint16_t count = 0;
+        uint8_t failedScreen = INVALID_SCREEN_ID;
+        bool enabled = false;
+        bool recording = false;
+        bool overflow = false;
+        bool unsupported = false;
     };
 
     struct ScreenState
@@ -186,6 +313,7 @@ namespace pipgui::detail
         String title;
         String subtitle;
         uint32_t startMs = 0;
+        uint16_t fg565 = 0xFFFF;
     };
 
     struct TypographyState
@@ -331,29 +459,43 @@ namespace pipgui::detail
 
     struct BlurState
     {
+        uint8_t *work = nullptr;
         uint16_t *smallIn = nullptr;
         uint16_t *smallTmp = nullptr;
-        uint32_t *rowR = nullptr;
-        uint32_t *rowG = nullptr;
-        uint32_t *rowB = nullptr;
-        uint32_t *colR = nullptr;
-        uint32_t *colG = nullptr;
-        uint32_t *colB = nullptr;
+        uint16_t *stack = nullptr;
+        uint16_t *tile = nullptr;
         uint8_t *lookup = nullptr;
-        uint32_t workLen = 0;
-        uint16_t rowCap = 0;
-        uint16_t colCap = 0;
-        uint16_t lookupSw = 0;
-        uint16_t lookupSh = 0;
-        uint16_t lookupW = 0;
-        uint16_t lookupH = 0;
-        uint32_t lastUseMs = 0;
+    };
+
+    inline constexpr uint8_t BLUR_CACHE_SLOTS = PIPGUI_BLUR_CACHE_SLOTS;
+
+    // Blurred half-resolution backdrop of one blur region, reused while the backdrop stays put.
+    // dirty* is the part of the small grid hit by invalidateRect() since it was computed.
+    struct BlurCacheSlot
+    {
+        uint16_t *out = nullptr;
+        uint32_t cap = 0;
+        uint32_t lastUse = 0;
+        int16_t x = 0, y = 0, w = 0, h = 0;
+        int16_t clipX = 0, clipY = 0, clipW = 0, clipH = 0;
+        int16_t sampleX = 0, sampleY = 0, sw = 0, sh = 0;
+        int16_t dirtyX0 = 0, dirtyY0 = 0, dirtyX1 = -1, dirtyY1 = -1;
+        uint8_t radius = 0;
+        bool ready = false;
+    };
+
+    struct BlurCacheState
+    {
+        BlurCacheSlot slots[BLUR_CACHE_SLOTS > 0 ? BLUR_CACHE_SLOTS : 1];
+        uint32_t useCounter = 0;
+        uint8_t hold = 0;
     };
 
     struct Flags
     {
         unsigned spriteEnabled : 1;
         unsigned inSpritePass : 1;
+        unsigned bandPass : 1;
         unsigned needRedraw : 1;
         unsigned dirtyRedrawPending : 1;
         unsigned bootActive : 1;
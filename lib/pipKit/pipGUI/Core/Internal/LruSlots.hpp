@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pipgui::detail
+{
+    // Frees least recently stamped slots until there is an empty slot and `bytes` more fit in
+    // `budget`. Slots need `data` (null when empty) and `stamp`; release() must empty the slot
+    // and take its size off usedBytes. Returns the empty slot, or nullptr once nothing is left
+    // to evict.
+    template <typename Slot, typename ReleaseFn>
+    [[nodiscard]] Slot *makeRoomLru(Slot *slots, size_t count, const uint32_t &usedBytes, uint32_t bytes, uint32_t budget,
+                                    ReleaseFn release) noexcept
+    {
+        for (;;)
+        {
+            Slot *empty = nullptr;
+            Slot *oldest = nullptr;
+            for (size_t i = 0; i < count; ++i)
+            {
+                Slot &slot = slots[i];
+                if (!slot.data)
+                {
+                    if (!empty)
+                        empty = &slot;
+                }
+                else if (!oldest || slot.stamp < oldest->stamp)
+                {
+                    oldest = &slot;
+                }
+            }
+            if (empty && usedBytes + bytes <= budget)
+                return empty;
+            if (!oldest)
+                return nullptr;
+            release(*oldest);
+        }
+    }
+
+    template <typename Slot, size_t N, typename ReleaseFn>
+    [[nodiscard]] Slot *makeRoomLru(Slot (&slots)[N], const uint32_t &usedBytes, uint32_t bytes, uint32_t budget,
+                                    ReleaseFn release) noexcept
+    {
+        return makeRoomLru(slots, N, usedBytes, bytes, budget, release);
+    }
+}
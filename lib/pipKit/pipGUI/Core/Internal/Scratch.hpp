@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <pipCore/Platform.hpp>
+#include <pipGUI/Core/Config/Select.hpp>
+
+namespace pipgui::detail
+{
+    inline constexpr uint8_t SCRATCH_SLOTS = PIPGUI_SCRATCH_SLOTS;
+
+    struct ScratchStats
+    {
+        uint32_t usedBytes = 0;
+        uint32_t heldBytes = 0;
+        uint32_t peakUsedBytes = 0;
+        uint32_t peakHeldBytes = 0;
+    };
+
+    // Size-classed pool of work buffers. Released blocks stay cached for the next borrower until an
+    // allocation fails or the owner drops them, so per-frame buffers stop cycling through the
+    // allocator. Exact requests skip the size class for large one-off buffers and are freed again
+    // on release instead of staying in the pool.
+    class ScratchPool
+    {
+    public:
+        [[nodiscard]] void *acquire(pipcore::Platform *plat, uint32_t bytes,
+                                    pipcore::AllocCaps caps = pipcore::AllocCaps::Default,
+                                    bool exact = false) noexcept;
+        void release(pipcore::Platform *plat, void *ptr) noexcept;
+        void dropIdle(pipcore::Platform *plat) noexcept;
+        void clear(pipcore::Platform *plat) noexcept;
+
+        [[nodiscard]] const ScratchStats &stats() const noexcept { return _stats; }
+
+    private:
+        struct Block
+        {
+            void *ptr = nullptr;
+            uint32_t bytes = 0;
+            pipcore::AllocCaps caps = pipcore::AllocCaps::Default;
+            bool used = false;
+            bool exact = false;
+        };
+
+        void freeBlock(pipcore::Platform *plat, Block &block) noexcept;
+
+        Block _blocks[SCRATCH_SLOTS];
+        ScratchStats _stats;
+    };
+
+    class ScratchLease
+    {
+    public:
+        ScratchLease(ScratchPool &pool, pipcore::Platform *plat, uint32_t bytes,
+                     pipcore::AllocCaps caps = pipcore::AllocCaps::Default) noexcept
+            : _pool(pool), _plat(plat), _ptr(pool.acquire(plat, bytes, caps))
+        {
+        }
+        ~ScratchLease() { _pool.release(_plat, _ptr); }
+
+        ScratchLease(const ScratchLease &) = delete;
+        ScratchLease &operator=(const ScratchLease &) = delete;
+
+        template <typename T>
+        [[nodiscard]] T *as() const noexcept { return static_cast<T *>(_ptr); }
+        explicit operator bool() const noexcept { return _ptr != nullptr; }
+
+    private:
+        ScratchPool &_pool;
+        pipcore::Platform *_plat;
+        void *_ptr;
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <pipGUI/Core/Types.hpp>
+#include <pipGUI/Graphics/Text/Fonts/ShapedText.hpp>
 
 namespace pipgui
 {
@@ -91,14 +92,8 @@ namespace pipgui
             uint8_t targetScreen;
             uint16_t iconId = 0xFFFF;
 
-            int16_t titleW = 0;
-            int16_t titleH = 0;
-            int16_t subW = 0;
-            int16_t subH = 0;
-            uint16_t cachedTitlePx = 0;
-            uint16_t cachedSubPx = 0;
-            uint16_t cachedTitleWeight = 0;
-            uint16_t cachedSubWeight = 0;
+            ShapedText titleRun;
+            ShapedText subRun;
         };
 
         bool configured = false;
@@ -144,14 +139,8 @@ namespace pipgui
             uint8_t layoutColSpan = 1;
             uint8_t layoutRowSpan = 1;
 
-            int16_t titleW = 0;
-            int16_t titleH = 0;
-            int16_t subW = 0;
-            int16_t subH = 0;
-            uint16_t cachedTitlePx = 0;
-            uint16_t cachedSubPx = 0;
-            uint16_t cachedTitleWeight = 0;
-            uint16_t cachedSubWeight = 0;
+            ShapedText titleRun;
+            ShapedText subRun;
         };
 
         bool configured = false;
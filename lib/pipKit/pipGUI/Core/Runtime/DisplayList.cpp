@@ -0,0 +1,187 @@
+#include <pipGUI/Core/pipGUI.hpp>
+#include <cstring>
+
+namespace pipgui
+{
+    void GUI::setDisplayList(bool enabled)
+    {
+        if (!enabled)
+            freeDisplayList(platform());
+        _displayList.enabled = enabled;
+        _displayList.failedScreen = INVALID_SCREEN_ID;
+    }
+
+    void GUI::freeDisplayList(pipcore::Platform *plat) noexcept
+    {
+        if (_displayList.buf)
+            detail::free(plat, _displayList.buf);
+        _displayList.buf = nullptr;
+        _displayList.cap = 0;
+        _displayList.used = 0;
+        _displayList.count = 0;
+        _displayList.recording = false;
+    }
+
+    detail::DrawCommand *GUI::recordCommand(detail::DrawOp op, int16_t x, int16_t y, int16_t w, int16_t h,
+                                            uint16_t payloadBytes) noexcept
+    {
+        detail::DisplayListState &dl = _displayList;
+        if (dl.overflow)
+            return nullptr;
+
+        int32_t x0 = x;
+        int32_t y0 = y;
+        int32_t x1 = (int32_t)x + w;
+        int32_t y1 = (int32_t)y + h;
+        if (_clip.enabled)
+        {
+            x0 = std::max<int32_t>(x0, _clip.x);
+            y0 = std::max<int32_t>(y0, _clip.y);
+            x1 = std::min<int32_t>(x1, (int32_t)_clip.x + _clip.w);
+            y1 = std::min<int32_t>(y1, (int32_t)_clip.y + _clip.h);
+        }
+        if (x1 <= x0 || y1 <= y0)
+            return nullptr;
+
+        const uint32_t bytes = ((uint32_t)sizeof(detail::DrawCommand) + payloadBytes + 3u) & ~3u;
+        if (bytes > 0xFFFFu || dl.used + bytes > dl.cap)
+        {
+            dl.overflow = true;
+            return nullptr;
+        }
+
+        detail::DrawCommand *cmd = new (dl.buf + dl.used) detail::DrawCommand();
+        cmd->op = op;
+        cmd->bytes = (uint16_t)bytes;
+        cmd->clip = _clip;
+        cmd->bounds = {(int16_t)x0, (int16_t)y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+        dl.used += bytes;
+        ++dl.count;
+        return cmd;
+    }
+
+    bool GUI::recordDisplayList(ScreenCallback cb)
+    {
+        detail::DisplayListState &dl = _displayList;
+        if (!cb || !dl.enabled || dl.failedScreen == _screen.current)
+            return false;
+
+        if (!dl.buf)
+        {
+            dl.buf = static_cast<uint8_t *>(detail::alloc(platform(), PIPGUI_DISPLAY_LIST_BYTES, pipcore::AllocCaps::PreferInternal));
+            if (!dl.buf)
+                return false;
+            dl.cap = PIPGUI_DISPLAY_LIST_BYTES;
+        }
+
+        dl.used = 0;
+        dl.count = 0;
+        dl.overflow = false;
+        dl.unsupported = false;
+
+        const ClipState prevClip = _clip;
+        dl.recording = true;
+        cb(*this);
+        dl.recording = false;
+        _clip = prevClip;
+
+        // Screens that draw through widgets or effects writing the sprite directly cannot be
+        // replayed; remember them so the record pass is not repeated on every redraw.
+        if (dl.unsupported || dl.overflow)
+        {
+            dl.failedScreen = _screen.current;
+            return false;
+        }
+        return true;
+    }
+
+    void GUI::replayDisplayList(int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+        const detail::DisplayListState &dl = _displayList;
+        const int32_t stripR = (int32_t)x + w;
+        const int32_t stripB = (int32_t)y + h;
+
+        for (uint32_t off = 0; off < dl.used;)
+        {
+            const detail::DrawCommand &cmd = *reinterpret_cast<const detail::DrawCommand *>(dl.buf + off);
+            off += cmd.bytes;
+
+            const detail::DirtyRect &b = cmd.bounds;
+            if (b.x >= stripR || b.y >= stripB || (int32_t)b.x + b.w <= x || (int32_t)b.y + b.h <= y)
+                continue;
+
+            _clip = cmd.clip;
+            applyClip(x, y, w, h);
+
+            const int16_t *v = cmd.v;
+            const uint8_t *r = cmd.radius;
+            switch (cmd.op)
+            {
+            case detail::DrawOp::Clear:
+                clear(cmd.color);
+                break;
+            case detail::DrawOp::FillRect:
+                fillRect(v[0], v[1], v[2], v[3], cmd.color);
+                break;
+            case detail::DrawOp::FillRoundRect:
+                fillRoundRect(v[0], v[1], v[2], v[3], r[0], r[1], r[2], r[3], cmd.color);
+                break;
+            case detail::DrawOp::DrawRoundRect:
+                drawRoundRect(v[0], v[1], v[2], v[3], r[0], r[1], r[2], r[3], cmd.color);
+                break;
+            case detail::DrawOp::FillSquircleRect:
+                fillSquircleRect(v[0], v[1], v[2], v[3], r[0], r[1], r[2], r[3], cmd.color);
+                break;
+            case detail::DrawOp::DrawSquircleRect:
+                drawSquircleRect(v[0], v[1], v[2], v[3], r[0], r[1], r[2], r[3], cmd.color);
+                break;
+            case detail::DrawOp::FillCircle:
+                fillCircle(v[0], v[1], v[2], cmd.color);
+                break;
+            case detail::DrawOp::DrawCircle:
+                drawCircle(v[0], v[1], v[2], cmd.color);
+                break;
+            case detail::DrawOp::Line:
+                drawLineCore(v[0], v[1], v[2], v[3], cmd.thickness, cmd.color, r[0] != 0, r[1] != 0, false);
+                break;
+            case detail::DrawOp::Arc:
+                drawArc(v[0], v[1], v[2], cmd.thickness, cmd.deg[0], cmd.deg[1], cmd.color);
+                break;
+            case detail::DrawOp::FillEllipse:
+                fillEllipse(v[0], v[1], v[2], v[3], cmd.color);
+                break;
+            case detail::DrawOp::DrawEllipse:
+                drawEllipse(v[0], v[1], v[2], v[3], cmd.color);
+                break;
+            case detail::DrawOp::FillTriangle:
+                fillTriangle(v[0], v[1], v[2], v[3], v[4], v[5], cmd.color);
+                break;
+            case detail::DrawOp::FillRoundTriangle:
+                fillRoundTriangle(v[0], v[1], v[2], v[3], v[4], v[5], r[0], cmd.color);
+                break;
+            case detail::DrawOp::DrawRoundTriangle:
+                drawRoundTriangle(v[0], v[1], v[2], v[3], v[4], v[5], r[0], cmd.color);
+                break;
+            case detail::DrawOp::Text:
+            {
+                const uint8_t *payload = reinterpret_cast<const uint8_t *>(&cmd + 1);
+                const detail::TypographyState prevTypo = _typo;
+                memcpy(&_typo, payload, sizeof(detail::TypographyState));
+                drawTextRun(reinterpret_cast<const char *>(payload + sizeof(detail::TypographyState)),
+                            v[0], v[1], cmd.color);
+                _typo = prevTypo;
+                break;
+            }
+            case detail::DrawOp::Icon:
+                drawIconInternal((uint16_t)v[3], v[0], v[1], (uint16_t)v[2], cmd.color);
+                break;
+            case detail::DrawOp::Layer:
+                compositeLayer(r[0], cmd.thickness, v[0], v[1]);
+                break;
+            case detail::DrawOp::AlphaLayer:
+                compositeAlphaLayer(r[0], cmd.color, cmd.thickness, v[0], v[1]);
+                break;
+            }
+        }
+    }
+}
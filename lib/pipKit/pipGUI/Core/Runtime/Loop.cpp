@@ -6,13 +6,17 @@ namespace pipgui
 {
     namespace
     {
-        constexpr uint32_t kIdleBlurCacheMs = 250;
         constexpr uint32_t kIdleShotGalleryCacheMs = 250;
     }
 
     void GUI::loop()
     {
+        DebugProbe frameProbe(DebugPhase::Frame);
         uint32_t now = nowMs();
+        const detail::ScratchStats &scratch = _scratch.stats();
+        Debug::recordScratch(scratch.heldBytes, scratch.peakHeldBytes, scratch.peakUsedBytes);
+        const detail::GlyphCacheStats &glyphs = _glyphCache.stats();
+        Debug::recordGlyphCache(glyphs.bytes, glyphs.hits, glyphs.misses);
         serviceAdaptivePreview(now);
 
         if (rotationTransitionActive())
@@ -123,13 +127,12 @@ namespace pipgui
                                        : nullptr;
         const auto renderCurrentScreenDirty = [&](ScreenCallback cb, uint8_t screenId)
         {
-            if (_dirty.count == 0)
+            if (_dirty.count == 0 || bandedRender())
                 return;
 
             const bool prevRender = _flags.inSpritePass;
             pipcore::Sprite *prevActive = _render.activeSprite;
             const uint8_t prevCurrent = _screen.current;
-            const ClipState prevClip = _clip;
             int32_t prevClipX = 0;
             int32_t prevClipY = 0;
             int32_t prevClipW = 0;
@@ -140,22 +143,59 @@ namespace pipgui
             _render.activeSprite = &_render.sprite;
             _screen.current = screenId;
 
+            DebugProbe screenProbe(DebugPhase::Screen);
             beginGraphFrame(screenId);
+
+            const bool hotBand = _render.sprite.hotBand();
+            uint16_t strips = 0;
+            bool splitsRect = false;
+            for (uint8_t i = 0; i < _dirty.count; ++i)
+            {
+                const DirtyRect &dirty = _dirty.rects[i];
+                if (dirty.w > 0 && dirty.h > 0)
+                {
+                    const int16_t lines = hotBand ? _render.sprite.hotLines() : dirty.h;
+                    strips += (uint16_t)((dirty.h + lines - 1) / lines);
+                    splitsRect = splitsRect || dirty.h > lines;
+                }
+            }
+            const bool replay = strips > 1 && _displayList.enabled && recordDisplayList(cb);
+            // Splitting a rect into hot strips re-runs the screen once per strip, and effects that
+            // clamp to the clip (blur) would seam at strip edges. Only a recorded display list, which
+            // never holds such effects, makes that safe; otherwise rects taller than the band are
+            // drawn whole in PSRAM.
+            const bool useHot = hotBand && (replay || !splitsRect);
+            pipcore::Platform *plat = platform();
+
             for (uint8_t i = 0; i < _dirty.count; ++i)
             {
                 const DirtyRect &dirty = _dirty.rects[i];
                 if (dirty.w <= 0 || dirty.h <= 0)
                     continue;
 
-                _clip = prevClip;
-                applyClip(dirty.x, dirty.y, dirty.w, dirty.h);
-                clear(_render.bgColor565 ? _render.bgColor565 : (uint16_t)_render.bgColor);
-                if (cb)
-                    cb(*this);
+                const int16_t lines = useHot ? _render.sprite.hotLines() : dirty.h;
+                for (int16_t y = 0; y < dirty.h; y += lines)
+                {
+                    const int16_t stripH = (int16_t)std::min<int32_t>(lines, dirty.h - y);
+                    const uint32_t passStartUs = plat ? plat->nowUs() : 0;
+                    if (useHot)
+                        _render.sprite.beginHot((int16_t)(dirty.y + y), stripH);
+                    pushClip(dirty.x, (int16_t)(dirty.y + y), dirty.w, stripH);
+                    clear(_render.bgColor565 ? _render.bgColor565 : (uint16_t)_render.bgColor);
+                    if (replay)
+                        replayDisplayList(dirty.x, (int16_t)(dirty.y + y), dirty.w, stripH);
+                    else if (cb)
+                        cb(*this);
+                    popClip();
+                    if (useHot)
+                        _render.sprite.endHot();
+                    if (plat)
+                        recordDirtyPassCost((uint32_t)dirty.w * (uint32_t)stripH, plat->nowUs() - passStartUs);
+                    Debug::addPixelsDrawn((uint32_t)dirty.w * (uint32_t)stripH);
+                }
             }
             endGraphFrame(screenId);
 
-            _clip = prevClip;
             _render.sprite.setClipRect((int16_t)prevClipX, (int16_t)prevClipY, (int16_t)prevClipW, (int16_t)prevClipH);
             _screen.current = prevCurrent;
             _render.activeSprite = prevActive;
@@ -374,12 +414,6 @@ namespace pipgui
             releaseScreenshotGalleryCache(platform());
         }
 #endif
-
-        if (_blur.lastUseMs != 0 && (now - _blur.lastUseMs) > kIdleBlurCacheMs)
-        {
-            freeBlurBuffers(platform());
-            _blur.lastUseMs = 0;
-        }
     }
 
     void GUI::loopWithInput(Button &next, Button &prev)
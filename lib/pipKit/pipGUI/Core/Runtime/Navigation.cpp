@@ -47,12 +47,8 @@ namespace pipgui
 
     void GUI::setScreenId(uint8_t id)
     {
-        if (_screen.current != id)
-        {
-            freeBlurBuffers(platform());
-            if (_screen.current != INVALID_SCREEN_ID)
-                releaseGraphBuffers(_screen.current);
-        }
+        if (_screen.current != id && _screen.current != INVALID_SCREEN_ID)
+            releaseGraphBuffers(_screen.current);
 
         _flags.screenTransition = 0;
 
@@ -129,6 +125,7 @@ namespace pipgui
 
         if (_screen.anim != ScreenAnimNone &&
             _flags.spriteEnabled &&
+            !bandedRender() &&
             _disp.display &&
             !_flags.notifActive &&
             _screen.current < _screen.capacity &&
@@ -137,8 +134,6 @@ namespace pipgui
             id < _screen.capacity &&
             _screen.callbacks[id])
         {
-            if (_screen.current != id)
-                freeBlurBuffers(platform());
             _screen.to = id;
             _screen.transDir = transDir;
             _screen.animStartMs = nowMs();
@@ -154,6 +149,13 @@ namespace pipgui
 
     void GUI::renderScreenToMainSprite(ScreenCallback cb, uint8_t screenId)
     {
+        if (bandedRender() && !_flags.bandPass)
+            return;
+
+        DebugProbe screenProbe(DebugPhase::Screen);
+        if (!_flags.bandPass)
+            Debug::addPixelsDrawn((uint32_t)_render.sprite.width() * (uint32_t)_render.sprite.height());
+
         const bool prevRender = _flags.inSpritePass;
         pipcore::Sprite *prevActive = _render.activeSprite;
         const uint8_t prevCurrent = _screen.current;
@@ -163,6 +165,10 @@ namespace pipgui
         _render.activeSprite = &_render.sprite;
         if (screenId != INVALID_SCREEN_ID)
             _screen.current = screenId;
+        // A full render may change anything under a cached blur. Clipped renders (the status bar
+        // backdrop) only repaint content whose changes already went through invalidateRect().
+        if (!_clip.enabled)
+            invalidateBlurCache();
         clear(_render.bgColor565 ? _render.bgColor565 : (uint16_t)_render.bgColor);
 
         ListState *list = getList(targetScreen);
@@ -196,6 +202,8 @@ namespace pipgui
                                   int16_t w, int16_t h,
                                   const char *stage)
     {
+        invalidateDiffPresent();
+
         if (!_disp.display || !_flags.spriteEnabled || w <= 0 || h <= 0)
             return false;
 
@@ -252,6 +260,7 @@ namespace pipgui
         if (w <= 0 || h <= 0)
             return false;
 
+        waitPresent();
         _disp.display->writeRect565(dstX, dstY, w, h, buf + (size_t)srcY * srcW + srcX, srcW);
         reportPlatformErrorOnce(stage);
 
@@ -0,0 +1,148 @@
+#include <pipGUI/Core/pipGUI.hpp>
+#include <pipGUI/Core/Internal/Scratch.hpp>
+
+namespace pipgui::detail
+{
+    namespace
+    {
+        constexpr uint32_t kMinClassBytes = 256;
+
+        // Rounds up to a quarter-octave size class (at most 25% slack) so buffers of nearby
+        // sizes share blocks instead of each carving a fresh one.
+        static inline uint32_t classBytes(uint32_t bytes) noexcept
+        {
+            if (bytes <= kMinClassBytes)
+                return kMinClassBytes;
+            const uint32_t top = 31u - (uint32_t)__builtin_clz(bytes);
+            const uint32_t step = 1u << (top - 2u);
+            return (bytes + step - 1u) & ~(step - 1u);
+        }
+    }
+
+    void ScratchPool::freeBlock(pipcore::Platform *plat, Block &block) noexcept
+    {
+        detail::free(plat, block.ptr);
+        _stats.heldBytes -= block.bytes;
+        block = Block();
+    }
+
+    void *ScratchPool::acquire(pipcore::Platform *plat, uint32_t bytes, pipcore::AllocCaps caps, bool exact) noexcept
+    {
+        if (bytes == 0)
+            return nullptr;
+        const uint32_t need = exact ? ((bytes + 3u) & ~3u) : classBytes(bytes);
+
+        Block *best = nullptr;
+        Block *empty = nullptr;
+        for (Block &block : _blocks)
+        {
+            if (!block.ptr)
+            {
+                if (!empty)
+                    empty = &block;
+                continue;
+            }
+            if (block.used || block.caps != caps || block.bytes < need)
+                continue;
+            if (!best || block.bytes < best->bytes)
+                best = &block;
+        }
+
+        if (!best)
+        {
+            // An idle block smaller than this request is superseded by the block about to be
+            // allocated, which can serve everything it did.
+            for (Block &block : _blocks)
+            {
+                if (block.ptr && !block.used && block.caps == caps)
+                {
+                    freeBlock(plat, block);
+                    if (!empty)
+                        empty = &block;
+                }
+            }
+            if (!empty)
+            {
+                for (Block &block : _blocks)
+                {
+                    if (block.ptr && !block.used && (!empty || block.bytes < empty->bytes))
+                        empty = &block;
+                }
+                if (!empty)
+                    return nullptr;
+                freeBlock(plat, *empty);
+            }
+
+            void *ptr = detail::alloc(plat, need, caps);
+            if (!ptr)
+            {
+                dropIdle(plat);
+                ptr = detail::alloc(plat, need, caps);
+                if (!ptr)
+                    return nullptr;
+            }
+
+            best = empty;
+            best->ptr = ptr;
+            best->bytes = need;
+            best->caps = caps;
+            best->exact = exact;
+            _stats.heldBytes += need;
+            if (_stats.heldBytes > _stats.peakHeldBytes)
+                _stats.peakHeldBytes = _stats.heldBytes;
+        }
+
+        best->used = true;
+        _stats.usedBytes += best->bytes;
+        if (_stats.usedBytes > _stats.peakUsedBytes)
+            _stats.peakUsedBytes = _stats.usedBytes;
+        return best->ptr;
+    }
+
+    void ScratchPool::release(pipcore::Platform *plat, void *ptr) noexcept
+    {
+        if (!ptr)
+            return;
+        for (Block &block : _blocks)
+        {
+            if (block.ptr == ptr && block.used)
+            {
+                block.used = false;
+                _stats.usedBytes -= block.bytes;
+                if (block.exact)
+                    freeBlock(plat, block);
+                return;
+            }
+        }
+    }
+
+    void ScratchPool::dropIdle(pipcore::Platform *plat) noexcept
+    {
+        for (Block &block : _blocks)
+        {
+            if (block.ptr && !block.used)
+                freeBlock(plat, block);
+        }
+    }
+
+    void ScratchPool::clear(pipcore::Platform *plat) noexcept
+    {
+        for (Block &block : _blocks)
+        {
+            if (block.ptr)
+            {
+                if (block.used)
+                    _stats.usedBytes -= block.bytes;
+                freeBlock(plat, block);
+            }
+        }
+    }
+}
+
+namespace pipgui
+{
+    void GUI::releaseScratch() noexcept
+    {
+        _scratch.dropIdle(platform());
+    }
+}
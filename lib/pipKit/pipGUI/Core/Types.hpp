@@ -1,6 +1,10 @@
 #pragma once
 
+#if defined(PIPCORE_HOST)
+#include <pipCore/Platforms/Host/Arduino.hpp>
+#else
 #include <Arduino.h>
+#endif
 #include <pipGUI/Core/Config/Select.hpp>
 #include <pipCore/Input/Button.hpp>
 #include <pipGUI/Core/UiLayout.hpp>
@@ -105,6 +109,13 @@ namespace pipgui
     inline constexpr ToastPos top = ToastPos::Top;
     inline constexpr ToastPos down = ToastPos::Down;
 
+    // Storage of an alpha layer: 8-bit coverage or a 1-bit mask.
+    enum class LayerAlpha : uint8_t
+    {
+        Gray8,
+        Mask1
+    };
+
     enum ScreenAnim : uint8_t
     {
         ScreenAnimNone,
@@ -1,4 +1,5 @@
 #include "Internal.hpp"
+#include <type_traits>
 
 namespace pipgui
 {
@@ -56,6 +57,13 @@ namespace pipgui
             if (cornerClipR < s.clipX || cornerClipX > s.clipR || cornerClipB < s.clipY || cornerClipY > s.clipB)
                 return;
 
+            const detail::ShapeMask mask = detail::shapeMask(detail::ShapeMaskKind::SquircleFill, radius);
+            if (mask.alpha && mask.size == clipW && mask.size == clipH)
+            {
+                blitShapeMask(s, c, mask, clipX, clipY, cornerClipR > cx, cornerClipB > cy);
+                return;
+            }
+
             Surface565 corner = s;
             corner.clipX = (cornerClipX > s.clipX) ? cornerClipX : s.clipX;
             corner.clipY = (cornerClipY > s.clipY) ? cornerClipY : s.clipY;
@@ -79,6 +87,13 @@ namespace pipgui
             if (cornerClipR < s.clipX || cornerClipX > s.clipR || cornerClipB < s.clipY || cornerClipY > s.clipB)
                 return;
 
+            const detail::ShapeMask mask = detail::shapeMask(detail::ShapeMaskKind::SquircleStroke, radius);
+            if (mask.alpha && mask.size == clipW && mask.size == clipH)
+            {
+                blitShapeMask(s, c, mask, clipX, clipY, cornerClipR > cx, cornerClipB > cy);
+                return;
+            }
+
             Surface565 corner = s;
             corner.clipX = (cornerClipX > s.clipX) ? cornerClipX : s.clipX;
             corner.clipY = (cornerClipY > s.clipY) ? cornerClipY : s.clipY;
@@ -87,113 +102,263 @@ namespace pipgui
             squircleRaster<false, AccT>(corner, c, cx, cy, radius, gamma, false);
         }
 
-        static inline float distanceSqToSegmentProjected(float dx, float dy,
-                                                         float ex, float ey,
-                                                         float invLen,
-                                                         float dot)
+        struct TriangleEdge
         {
-            float t = dot * invLen;
-            t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
-            dx -= ex * t;
-            dy -= ey * t;
-            return dx * dx + dy * dy;
-        }
+            int32_t vx2;
+            int32_t vy2;
+            int32_t ex;
+            int32_t ey;
+            int64_t len2x2;
+            uint32_t invLen;
+            int32_t reach;
+        };
 
-        struct DistSqAlphaLut
+        struct TriangleAlphaLut
         {
             uint8_t radius = 0xFF;
-            float minSq = 0.0f;
-            float maxSq = 1.0f;
-            float scale = 0.0f;
+            int32_t maxQ8 = 0;
+            uint32_t minSq = 0;
+            uint32_t maxSq = 0;
+            uint32_t maxW2 = 0;
+            uint32_t scale = 0;
             uint8_t table[513] = {};
         };
 
-        static inline uint8_t sampleDistSqAlpha(const DistSqAlphaLut &lut, float dSq)
+        static inline uint32_t edgeLengthQ4(uint32_t len2) noexcept
         {
-            if (dSq <= lut.minSq)
-                return lut.table[0];
-            if (dSq >= lut.maxSq)
-                return lut.table[512];
+            return (len2 < (1u << 24)) ? isqrt32(len2 << 8) : (isqrt32(len2) << 4);
+        }
 
-            int32_t idx = (int32_t)((dSq - lut.minSq) * lut.scale + 0.5f);
-            if (idx < 0)
-                idx = 0;
-            else if (idx > 512)
-                idx = 512;
-            return lut.table[idx];
+        template <typename AccT>
+        static inline AccT floorDiv(AccT a, AccT b) noexcept
+        {
+            AccT q = a / b;
+            if (q * b != a && ((a < 0) != (b < 0)))
+                --q;
+            return q;
+        }
+
+        // Edge functions are evaluated at doubled pixel centers (2 * px + 1), so the whole
+        // rasterizer stays in integers. Vertices are wound so the inside is where all three
+        // edge functions are >= 0; reach widens an edge by the AA band, in edge-function units.
+        static inline void setupTriangleEdges(TriangleEdge (&edges)[3],
+                                              int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                              int16_t x2, int16_t y2, int32_t reachQ8) noexcept
+        {
+            int32_t vx[3] = {x0, x1, x2};
+            int32_t vy[3] = {y0, y1, y2};
+            const int64_t cross = (int64_t)(x1 - x0) * (y2 - y0) - (int64_t)(x2 - x0) * (y1 - y0);
+            if (cross < 0)
+            {
+                std::swap(vx[1], vx[2]);
+                std::swap(vy[1], vy[2]);
+            }
+
+            for (uint8_t i = 0; i < 3; ++i)
+            {
+                const uint8_t n = (uint8_t)((i + 1) % 3);
+                TriangleEdge &e = edges[i];
+                e.vx2 = vx[i] * 2;
+                e.vy2 = vy[i] * 2;
+                e.ex = vx[n] - vx[i];
+                e.ey = vy[n] - vy[i];
+                const uint32_t len2 = (uint32_t)(e.ex * e.ex + e.ey * e.ey);
+                const uint32_t lenQ4 = edgeLengthQ4(len2);
+                e.len2x2 = (int64_t)len2 * 2;
+                e.invLen = len2 ? (uint32_t)(16777216.0f / sqrtf((float)len2) + 0.5f) : 0;
+                e.reach = (int32_t)(((int64_t)reachQ8 * lenQ4) >> 11) + 2;
+            }
+        }
+
+        // Narrows [lo, hi] to the pixels of row py2 where edge function + offset >= 0.
+        template <typename AccT>
+        static inline void clipTriangleEdgeRow(const TriangleEdge &e, int32_t py2, int32_t offset,
+                                               int32_t &lo, int32_t &hi) noexcept
+        {
+            const AccT a = (AccT)e.ex * (py2 - e.vy2) - (AccT)e.ey * (1 - e.vx2) + offset;
+            const AccT b = -2 * (AccT)e.ey;
+            if (b > 0)
+            {
+                const AccT first = -floorDiv<AccT>(a, b);
+                if (first > lo)
+                    lo = (first > hi) ? hi + 1 : (int32_t)first;
+            }
+            else if (b < 0)
+            {
+                const AccT last = floorDiv<AccT>(a, -b);
+                if (last < hi)
+                    hi = (last < lo) ? lo - 1 : (int32_t)last;
+            }
+            else if (a < 0)
+            {
+                lo = hi + 1;
+            }
+        }
+
+        // Distances stay squared (Q16 pixels^2) and the AA table is indexed by the squared distance,
+        // so no pixel needs a square root. maxW2 bounds the endpoint case in its own units (doubled
+        // coordinates, squared) before the shift into Q16 could overflow.
+        static inline uint32_t endpointDistanceSq(const TriangleAlphaLut &lut, int32_t dx2, int32_t dy2) noexcept
+        {
+            if (dx2 <= -1024 || dx2 >= 1024 || dy2 <= -1024 || dy2 >= 1024)
+                return UINT32_MAX;
+            const uint32_t w2 = (uint32_t)(dx2 * dx2 + dy2 * dy2);
+            return (w2 >= lut.maxW2) ? UINT32_MAX : (w2 << 14);
+        }
+
+        template <typename AccT>
+        static inline uint32_t triangleDistanceSq(const TriangleAlphaLut &lut, const TriangleEdge (&edges)[3],
+                                                  const AccT (&side)[3], const AccT (&dot)[3],
+                                                  int32_t px2, int32_t py2) noexcept
+        {
+            uint32_t best = UINT32_MAX;
+            for (uint8_t i = 0; i < 3; ++i)
+            {
+                if (side[i] >= 0)
+                    continue;
+                const TriangleEdge &e = edges[i];
+                uint32_t d;
+                if (dot[i] <= 0)
+                    d = endpointDistanceSq(lut, px2 - e.vx2, py2 - e.vy2);
+                else if (dot[i] >= (AccT)e.len2x2)
+                    d = endpointDistanceSq(lut, px2 - e.vx2 - e.ex * 2, py2 - e.vy2 - e.ey * 2);
+                else
+                {
+                    const uint64_t q = ((uint64_t)(typename std::make_unsigned<AccT>::type)(-side[i]) * e.invLen) >> 17;
+                    d = (q >= (uint64_t)lut.maxQ8) ? UINT32_MAX : (uint32_t)(q * q);
+                }
+                if (d < best)
+                    best = d;
+            }
+            return best;
+        }
+
+        static inline uint8_t sampleTriangleAlpha(const TriangleAlphaLut &lut, uint32_t dSq) noexcept
+        {
+            return lut.table[((uint64_t)(dSq - lut.minSq) * lut.scale + (1u << 31)) >> 32];
         }
 
         template <typename AlphaFn>
-        static inline const DistSqAlphaLut &buildRoundTriangleLut(DistSqAlphaLut &lut,
-                                                                  uint8_t radius,
-                                                                  float minRadius,
-                                                                  float maxRadius,
-                                                                  AlphaFn alphaFn)
+        static inline const TriangleAlphaLut &buildTriangleAlphaLut(TriangleAlphaLut &lut, uint8_t radius,
+                                                                     int32_t minQ8, int32_t maxQ8,
+                                                                     AlphaFn alphaFn)
         {
             if (lut.radius == radius)
                 return lut;
 
+            const uint8_t *gamma = gammaTable();
             lut.radius = radius;
-            lut.minSq = minRadius * minRadius;
-            lut.maxSq = maxRadius * maxRadius;
-            lut.scale = (lut.maxSq > lut.minSq) ? (512.0f / (lut.maxSq - lut.minSq)) : 0.0f;
-
-            const float step = (lut.maxSq - lut.minSq) * (1.0f / 512.0f);
+            lut.maxQ8 = maxQ8;
+            // maxQ8 reaches 65536 at radius 255, one past what a squared uint32 holds.
+            const uint64_t maxSq = (uint64_t)maxQ8 * maxQ8;
+            lut.minSq = (uint32_t)((uint64_t)minQ8 * minQ8);
+            lut.maxSq = (maxSq > UINT32_MAX) ? UINT32_MAX : (uint32_t)maxSq;
+            lut.maxW2 = (uint32_t)((maxSq + (1u << 14) - 1) >> 14);
+            lut.scale = (uint32_t)((512ull << 32) / (lut.maxSq - lut.minSq));
+            const float step = (float)(lut.maxSq - lut.minSq) * (1.0f / 512.0f);
             for (int32_t i = 0; i <= 512; ++i)
-            {
-                const float dSq = lut.minSq + step * i;
-                lut.table[i] = alphaFn(dSq);
-            }
+                lut.table[i] = gamma[alphaFn(sqrtf((float)lut.minSq + step * (float)i) * (1.0f / 256.0f))];
             return lut;
         }
 
-        static inline const DistSqAlphaLut &roundTriangleOutlineLut(uint8_t radius)
+        static inline const TriangleAlphaLut &roundTriangleOutlineLut(uint8_t radius)
         {
-            static DistSqAlphaLut lut;
-            const float bandMin = std::max(0.0f, radius - 1.0f);
-            const float bandMax = radius + 1.0f;
-            return buildRoundTriangleLut(
-                lut, radius, bandMin, bandMax,
-                [&](float dSq)
-                {
-                    const float edgeDist = fabsf(sqrtf(dSq) - radius) - 0.5f;
-                    return alphaSdfAA(edgeDist);
-                });
+            static TriangleAlphaLut lut;
+            const int32_t bandMin = (radius > 1) ? (int32_t)(radius - 1) * 256 : 0;
+            return buildTriangleAlphaLut(
+                lut, radius, bandMin, (int32_t)(radius + 1) * 256,
+                [&](float d)
+                { return alphaSdfAA(fabsf(d - radius) - 0.5f); });
         }
 
-        static inline const DistSqAlphaLut &roundTriangleFillLut(uint8_t radius)
+        static inline const TriangleAlphaLut &roundTriangleFillLut(uint8_t radius)
         {
-            static DistSqAlphaLut lut;
-            const float innerRadius = std::max(0.0f, radius - 0.5f);
-            const float outerRadius = radius + 1.0f;
-            return buildRoundTriangleLut(
-                lut, radius, innerRadius, outerRadius,
-                [&](float dSq)
-                { return alphaSdfAA(sqrtf(dSq) - radius); });
+            static TriangleAlphaLut lut;
+            return buildTriangleAlphaLut(
+                lut, radius, (int32_t)radius * 256 - 128, (int32_t)(radius + 1) * 256,
+                [&](float d)
+                { return alphaSdfAA(d - radius); });
         }
-    }
 
-    void GUI::fillEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color)
-    {
-        if (rx <= 0 || ry <= 0 || !_flags.spriteEnabled)
-            return;
+        // AccT holds the per-pixel edge and projection terms; int32_t is exact while the padded
+        // bounding box stays under 8192 px on each side, which covers every on-screen triangle.
+        template <bool Fill, typename AccT>
+        static inline void rasterRoundTriangle(const Surface565 &s, const Color565 &c,
+                                               const TriangleEdge (&edges)[3], const TriangleAlphaLut &lut,
+                                               int32_t xStart, int32_t xEnd, int32_t yStart, int32_t yEnd)
+        {
+            for (int32_t py = yStart; py <= yEnd; ++py)
+            {
+                const int32_t py2 = py * 2 + 1;
+                int32_t ox0 = xStart, ox1 = xEnd;
+                for (const TriangleEdge &e : edges)
+                    clipTriangleEdgeRow<AccT>(e, py2, e.reach, ox0, ox1);
+                if (ox0 > ox1)
+                    continue;
+
+                int32_t ix0 = ox0, ix1 = ox1;
+                for (const TriangleEdge &e : edges)
+                    clipTriangleEdgeRow<AccT>(e, py2, 0, ix0, ix1);
+
+                uint16_t *row = s.row(py);
+                auto edgePixels = [&](int32_t x0, int32_t x1)
+                {
+                    if (x0 > x1)
+                        return;
+                    int32_t px2 = x0 * 2 + 1;
+                    AccT side[3];
+                    AccT dot[3];
+                    for (uint8_t i = 0; i < 3; ++i)
+                    {
+                        const TriangleEdge &e = edges[i];
+                        const int32_t wx = px2 - e.vx2;
+                        const int32_t wy = py2 - e.vy2;
+                        side[i] = (AccT)e.ex * wy - (AccT)e.ey * wx;
+                        dot[i] = (AccT)e.ex * wx + (AccT)e.ey * wy;
+                    }
+                    for (int32_t px = x0; px <= x1; ++px)
+                    {
+                        const uint32_t d = triangleDistanceSq(lut, edges, side, dot, px2, py2);
+                        if (d < lut.maxSq)
+                        {
+                            if (d >= lut.minSq)
+                                blendStore(row + px, c, sampleTriangleAlpha(lut, d));
+                            else if (Fill)
+                                row[px] = c.fg;
+                        }
+                        px2 += 2;
+                        for (uint8_t i = 0; i < 3; ++i)
+                        {
+                            side[i] -= 2 * edges[i].ey;
+                            dot[i] += 2 * edges[i].ex;
+                        }
+                    }
+                };
 
-        auto spr = getDrawTarget();
-        Surface565 s;
-        if (!getSurface565(spr, s))
-            return;
-        if (cx + rx < s.clipX || cx - rx > s.clipR || cy + ry < s.clipY || cy - ry > s.clipB)
-            return;
+                if (ix0 > ix1)
+                {
+                    edgePixels(ox0, ox1);
+                    continue;
+                }
+                if (Fill)
+                    spanFill(row + ix0, (int16_t)(ix1 - ix0 + 1), c.fg, c.fg32);
+                edgePixels(ox0, ix0 - 1);
+                edgePixels(ix1 + 1, ox1);
+            }
+        }
 
-        const int64_t rx2 = (int64_t)rx * rx;
-        const int64_t ry2 = (int64_t)ry * ry;
-        const int64_t rhs = rx2 * ry2;
-        const Color565 c = makeColor565(color);
-        const uint8_t *gamma = gammaTable();
-        const bool noClip = (cx - rx - 1 >= s.clipX && cx + rx + 1 <= s.clipR &&
-                             cy - ry >= s.clipY && cy + ry <= s.clipB);
-        auto raster = [&](auto fillSpan, auto blendSide) __attribute__((always_inline))
+        // One solid span per row, closed on each side by a pixel whose coverage comes from the
+        // midpoint residual of that row.
+        template <typename FillSpanFn, typename BlendSideFn>
+        static __attribute__((always_inline)) inline void rasterFillEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry,
+                                             const uint8_t *gamma,
+                                             FillSpanFn fillSpan,
+                                             BlendSideFn blendSide)
         {
+            const int64_t rx2 = (int64_t)rx * rx;
+            const int64_t ry2 = (int64_t)ry * ry;
+            const int64_t rhs = rx2 * ry2;
+
             int32_t xi = rx;
             int64_t xTerm = (int64_t)xi * xi * ry2;
             int64_t yTerm = 0;
@@ -220,51 +385,16 @@ namespace pipgui
 
                 yTerm += (int64_t)(dy * 2 + 1) * rx2;
             }
-        };
-
-        if (noClip)
-            raster([&](int16_t py, int16_t x0, int16_t x1)
-                   { fillSpanFast(s, py, x0, x1, c); },
-                   [&](int16_t px, int16_t py, uint8_t alpha)
-                   {
-                       if (alpha)
-                           blendStore(s.buf + (int32_t)py * s.stride + px, c, alpha);
-                   });
-        else
-            raster([&](int16_t py, int16_t x0, int16_t x1)
-                   { fillSpanClip(s, py, x0, x1, c); },
-                   [&](int16_t px, int16_t py, uint8_t alpha)
-                   {
-                       if (alpha)
-                           plotBlendClip(s, c, px, py, alpha);
-                   });
-
-        if (_disp.display && !_flags.inSpritePass)
-            invalidateRect(cx - rx, cy - ry, rx * 2 + 1, ry * 2 + 1);
-    }
-
-    void GUI::drawEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color)
-    {
-        if (rx <= 0 || ry <= 0 || !_flags.spriteEnabled)
-            return;
-
-        auto spr = getDrawTarget();
-        Surface565 s;
-        if (!getSurface565(spr, s))
-            return;
-        if (cx + rx + 1 < s.clipX || cx - rx - 1 > s.clipR ||
-            cy + ry + 1 < s.clipY || cy - ry - 1 > s.clipB)
-            return;
+        }
 
-        const int64_t rx2 = (int64_t)rx * rx;
-        const int64_t ry2 = (int64_t)ry * ry;
-        const int64_t rhs = rx2 * ry2;
-        const Color565 c = makeColor565(color);
-        const uint8_t *gamma = gammaTable();
-        const bool noClip = (cx - rx - 1 >= s.clipX && cx + rx + 1 <= s.clipR &&
-                             cy - ry - 1 >= s.clipY && cy + ry + 1 <= s.clipB);
-        auto raster = [&](auto plot) __attribute__((always_inline))
+        template <typename PlotFn>
+        static __attribute__((always_inline)) inline void rasterDrawEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry,
+                                             const uint8_t *gamma, PlotFn plot)
         {
+            const int64_t rx2 = (int64_t)rx * rx;
+            const int64_t ry2 = (int64_t)ry * ry;
+            const int64_t rhs = rx2 * ry2;
+
             auto plot4 = [&](int16_t px0, int16_t px1, int16_t py0, int16_t py1, uint8_t alpha) __attribute__((always_inline))
             {
                 plot(px0, py0, alpha);
@@ -321,17 +451,116 @@ namespace pipgui
                 plot((int16_t)(px1 - 1), py1, a1);
                 yTerm += (int64_t)(dy * 2 + 1) * rx2;
             }
-        };
+        }
+    }
+
+    void GUI::fillEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color)
+    {
+        if (rx <= 0 || ry <= 0 || !_flags.spriteEnabled)
+            return;
+        const int16_t bx = (int16_t)(cx - rx - 1);
+        const int16_t by = (int16_t)(cy - ry - 1);
+        const int16_t bw = (int16_t)(rx * 2 + 3);
+        const int16_t bh = (int16_t)(ry * 2 + 3);
+        if (quickReject(bx, by, bw, bh))
+            return;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::FillEllipse, bx, by, bw, bh))
+            {
+                cmd->color = color;
+                cmd->v[0] = cx;
+                cmd->v[1] = cy;
+                cmd->v[2] = rx;
+                cmd->v[3] = ry;
+            }
+            return;
+        }
+
+        auto spr = getDrawTarget();
+        Surface565 s;
+        if (!getSurface565(spr, s))
+            return;
+        if (cx + rx + 1 < s.clipX || cx - rx - 1 > s.clipR || cy + ry + 1 < s.clipY || cy - ry - 1 > s.clipB)
+            return;
+
+        const Color565 c = makeColor565(color);
+        const uint8_t *gamma = gammaTable();
+        const bool noClip = (cx - rx - 1 >= s.clipX && cx + rx + 1 <= s.clipR &&
+                             cy - ry - 1 >= s.clipY && cy + ry + 1 <= s.clipB);
+        auto raster = [&](auto fillSpan, auto blendSide) __attribute__((always_inline))
+        { rasterFillEllipse(cx, cy, rx, ry, gamma, fillSpan, blendSide); };
+
+        if (noClip)
+            raster([&](int16_t py, int16_t x0, int16_t x1)
+                   { fillSpanFast(s, py, x0, x1, c); },
+                   [&](int16_t px, int16_t py, uint8_t alpha)
+                   {
+                       if (alpha)
+                           blendStore(s.row(py) + px, c, alpha);
+                   });
+        else
+            raster([&](int16_t py, int16_t x0, int16_t x1)
+                   { fillSpanClip(s, py, x0, x1, c); },
+                   [&](int16_t px, int16_t py, uint8_t alpha)
+                   {
+                       if (alpha)
+                           plotBlendClip(s, c, px, py, alpha);
+                   });
+
+        if (_disp.display && !_flags.inSpritePass)
+            invalidateRect(bx, by, bw, bh);
+    }
+
+    void GUI::drawEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color)
+    {
+        if (rx <= 0 || ry <= 0 || !_flags.spriteEnabled)
+            return;
+        const int16_t bx = (int16_t)(cx - rx - 1);
+        const int16_t by = (int16_t)(cy - ry - 1);
+        const int16_t bw = (int16_t)(rx * 2 + 3);
+        const int16_t bh = (int16_t)(ry * 2 + 3);
+        if (quickReject(bx, by, bw, bh))
+            return;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::DrawEllipse, bx, by, bw, bh))
+            {
+                cmd->color = color;
+                cmd->v[0] = cx;
+                cmd->v[1] = cy;
+                cmd->v[2] = rx;
+                cmd->v[3] = ry;
+            }
+            return;
+        }
+
+        auto spr = getDrawTarget();
+        Surface565 s;
+        if (!getSurface565(spr, s))
+            return;
+        if (cx + rx + 1 < s.clipX || cx - rx - 1 > s.clipR ||
+            cy + ry + 1 < s.clipY || cy - ry - 1 > s.clipB)
+            return;
+
+        const Color565 c = makeColor565(color);
+        const uint8_t *gamma = gammaTable();
+        const bool noClip = (cx - rx - 1 >= s.clipX && cx + rx + 1 <= s.clipR &&
+                             cy - ry - 1 >= s.clipY && cy + ry + 1 <= s.clipB);
+        auto raster = [&](auto plot) __attribute__((always_inline))
+        { rasterDrawEllipse(cx, cy, rx, ry, gamma, plot); };
 
         if (noClip)
             raster([&](int16_t px, int16_t py, uint8_t alpha)
-                   { blendStore(s.buf + (int32_t)py * s.stride + px, c, alpha); });
+                   { blendStore(s.row(py) + px, c, alpha); });
         else
             raster([&](int16_t px, int16_t py, uint8_t alpha)
                    { plotBlendClip(s, c, px, py, alpha); });
 
         if (_disp.display && !_flags.inSpritePass)
-            invalidateRect(cx - rx - 1, cy - ry - 1, rx * 2 + 3, ry * 2 + 3);
+            invalidateRect(bx, by, bw, bh);
     }
 
     void GUI::drawTriangle(int16_t x0, int16_t y0,
@@ -350,6 +579,29 @@ namespace pipgui
         if (!_flags.spriteEnabled)
             return;
 
+        const int16_t pad = 1;
+        const int16_t bx = (int16_t)(std::min({x0, x1, x2}) - pad);
+        const int16_t by = (int16_t)(std::min({y0, y1, y2}) - pad);
+        const int16_t bw = (int16_t)(std::max({x0, x1, x2}) + pad + 1 - bx);
+        const int16_t bh = (int16_t)(std::max({y0, y1, y2}) + pad + 1 - by);
+        if (quickReject(bx, by, bw, bh))
+            return;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::FillTriangle, bx, by, bw, bh))
+            {
+                cmd->color = color;
+                cmd->v[0] = x0;
+                cmd->v[1] = y0;
+                cmd->v[2] = x1;
+                cmd->v[3] = y1;
+                cmd->v[4] = x2;
+                cmd->v[5] = y2;
+            }
+            return;
+        }
+
         auto spr = getDrawTarget();
         Surface565 s;
         if (!getSurface565(spr, s))
@@ -471,103 +723,52 @@ namespace pipgui
         if (!_flags.spriteEnabled)
             return;
 
-        auto spr = getDrawTarget();
-        if (!spr)
+        const int16_t pad = (int16_t)(radius + 2);
+        const int16_t bx = (int16_t)(std::min({x0, x1, x2}) - pad);
+        const int16_t by = (int16_t)(std::min({y0, y1, y2}) - pad);
+        const int16_t bw = (int16_t)(std::max({x0, x1, x2}) + pad + 1 - bx);
+        const int16_t bh = (int16_t)(std::max({y0, y1, y2}) + pad + 1 - by);
+        if (quickReject(bx, by, bw, bh))
             return;
-        uint16_t *buf = (uint16_t *)spr->getBuffer();
-        if (!buf)
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::DrawRoundTriangle, bx, by, bw, bh))
+            {
+                cmd->color = color;
+                cmd->radius[0] = radius;
+                cmd->v[0] = x0;
+                cmd->v[1] = y0;
+                cmd->v[2] = x1;
+                cmd->v[3] = y1;
+                cmd->v[4] = x2;
+                cmd->v[5] = y2;
+            }
             return;
+        }
 
-        const int16_t stride = spr->width();
-        int32_t clipX = 0, clipY = 0, clipW = stride, clipH = spr->height();
-        spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
-        const int32_t clipR = clipX + clipW - 1, clipB = clipY + clipH - 1;
+        auto spr = getDrawTarget();
+        Surface565 s;
+        if (!getSurface565(spr, s))
+            return;
 
         const int16_t minX = std::min({x0, x1, x2}) - radius - 2;
         const int16_t maxX = std::max({x0, x1, x2}) + radius + 2;
         const int16_t minY = std::min({y0, y1, y2}) - radius - 2;
         const int16_t maxY = std::max({y0, y1, y2}) + radius + 2;
-        if (minX > clipR || maxX < clipX || minY > clipB || maxY < clipY)
+        if (minX > s.clipR || maxX < s.clipX || minY > s.clipB || maxY < s.clipY)
             return;
 
-        const float v0x = x0, v0y = y0, v1x = x1, v1y = y1, v2x = x2, v2y = y2;
-        const float e0x = v1x - v0x, e0y = v1y - v0y, inv_len0 = 1.0f / (e0x * e0x + e0y * e0y);
-        const float e1x = v2x - v1x, e1y = v2y - v1y, inv_len1 = 1.0f / (e1x * e1x + e1y * e1y);
-        const float e2x = v0x - v2x, e2y = v0y - v2y, inv_len2 = 1.0f / (e2x * e2x + e2y * e2y);
-        const float sign = (e0x * (v2y - v0y) - e0y * (v2x - v0x) < 0.0f) ? -1.0f : 1.0f;
-
         const Color565 c = makeColor565(color);
-        const uint8_t *gamma = gammaTable();
-        const int16_t xStart = (minX < clipX) ? (int16_t)clipX : minX;
-        const int16_t xEnd = (maxX > clipR) ? (int16_t)clipR : maxX;
-        const int16_t yStart = (minY < clipY) ? (int16_t)clipY : minY;
-        const int16_t yEnd = (maxY > clipB) ? (int16_t)clipB : maxY;
-        const DistSqAlphaLut &aaLut = roundTriangleOutlineLut(radius);
-        const float bandMin2 = aaLut.minSq;
-        const float bandMax2 = aaLut.maxSq;
-
-        for (int16_t py = yStart; py <= yEnd; ++py)
-        {
-            const float py_f = py + 0.5f;
-            const float pd0y = py_f - v0y, pd1y = py_f - v1y, pd2y = py_f - v2y;
-            uint16_t *row = buf + py * stride;
-            float pd0x = (float)xStart + 0.5f - v0x;
-            float pd1x = (float)xStart + 0.5f - v1x;
-            float pd2x = (float)xStart + 0.5f - v2x;
-            float c0 = e0x * pd0y - e0y * pd0x;
-            float c1 = e1x * pd1y - e1y * pd1x;
-            float c2 = e2x * pd2y - e2y * pd2x;
-            float dot0 = pd0x * e0x + pd0y * e0y;
-            float dot1 = pd1x * e1x + pd1y * e1y;
-            float dot2 = pd2x * e2x + pd2y * e2y;
-            for (int16_t px = xStart; px <= xEnd; ++px)
-            {
-                const float side0 = c0 * sign;
-                const float side1 = c1 * sign;
-                const float side2 = c2 * sign;
-                const bool inside = (side0 >= 0.0f) && (side1 >= 0.0f) && (side2 >= 0.0f);
-                if (!inside)
-                {
-                    float min_d_sq = 0.0f;
-                    bool hasDistance = false;
-                    if (side0 < 0.0f)
-                    {
-                        min_d_sq = distanceSqToSegmentProjected(pd0x, pd0y, e0x, e0y, inv_len0, dot0);
-                        hasDistance = true;
-                    }
-                    if (side1 < 0.0f)
-                    {
-                        const float d1_sq = distanceSqToSegmentProjected(pd1x, pd1y, e1x, e1y, inv_len1, dot1);
-                        if (!hasDistance || d1_sq < min_d_sq)
-                            min_d_sq = d1_sq;
-                        hasDistance = true;
-                    }
-                    if (side2 < 0.0f)
-                    {
-                        const float d2_sq = distanceSqToSegmentProjected(pd2x, pd2y, e2x, e2y, inv_len2, dot2);
-                        if (!hasDistance || d2_sq < min_d_sq)
-                            min_d_sq = d2_sq;
-                    }
-
-                    if (min_d_sq >= bandMin2 && min_d_sq <= bandMax2)
-                    {
-                        const uint8_t aa = sampleDistSqAlpha(aaLut, min_d_sq);
-                        if (aa > 0)
-                            blendStore(row + px, c, gamma[aa]);
-                    }
-                }
-
-                pd0x += 1.0f;
-                pd1x += 1.0f;
-                pd2x += 1.0f;
-                c0 -= e0y;
-                c1 -= e1y;
-                c2 -= e2y;
-                dot0 += e0x;
-                dot1 += e1x;
-                dot2 += e2x;
-            }
-        }
+        const TriangleAlphaLut &aaLut = roundTriangleOutlineLut(radius);
+        TriangleEdge edges[3];
+        setupTriangleEdges(edges, x0, y0, x1, y1, x2, y2, aaLut.maxQ8);
+        const int32_t xStart = (minX < s.clipX) ? s.clipX : minX, xEnd = (maxX > s.clipR) ? s.clipR : maxX;
+        const int32_t yStart = (minY < s.clipY) ? s.clipY : minY, yEnd = (maxY > s.clipB) ? s.clipB : maxY;
+        if (maxX - minX < 8192 && maxY - minY < 8192)
+            rasterRoundTriangle<false, int32_t>(s, c, edges, aaLut, xStart, xEnd, yStart, yEnd);
+        else
+            rasterRoundTriangle<false, int64_t>(s, c, edges, aaLut, xStart, xEnd, yStart, yEnd);
 
         if (_disp.display && !_flags.inSpritePass)
             invalidateRect(minX, minY, maxX - minX + 1, maxY - minY + 1);
@@ -586,113 +787,52 @@ namespace pipgui
         if (!_flags.spriteEnabled)
             return;
 
-        auto spr = getDrawTarget();
-        if (!spr)
+        const int16_t pad = (int16_t)(radius + 2);
+        const int16_t bx = (int16_t)(std::min({x0, x1, x2}) - pad);
+        const int16_t by = (int16_t)(std::min({y0, y1, y2}) - pad);
+        const int16_t bw = (int16_t)(std::max({x0, x1, x2}) + pad + 1 - bx);
+        const int16_t bh = (int16_t)(std::max({y0, y1, y2}) + pad + 1 - by);
+        if (quickReject(bx, by, bw, bh))
             return;
-        uint16_t *buf = (uint16_t *)spr->getBuffer();
-        if (!buf)
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::FillRoundTriangle, bx, by, bw, bh))
+            {
+                cmd->color = color;
+                cmd->radius[0] = radius;
+                cmd->v[0] = x0;
+                cmd->v[1] = y0;
+                cmd->v[2] = x1;
+                cmd->v[3] = y1;
+                cmd->v[4] = x2;
+                cmd->v[5] = y2;
+            }
             return;
+        }
 
-        const int16_t stride = spr->width();
-        int32_t clipX = 0, clipY = 0, clipW = stride, clipH = spr->height();
-        spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
-        const int32_t clipR = clipX + clipW - 1, clipB = clipY + clipH - 1;
+        auto spr = getDrawTarget();
+        Surface565 s;
+        if (!getSurface565(spr, s))
+            return;
 
         const int16_t minX = std::min({x0, x1, x2}) - radius - 1;
         const int16_t maxX = std::max({x0, x1, x2}) + radius + 1;
         const int16_t minY = std::min({y0, y1, y2}) - radius - 1;
         const int16_t maxY = std::max({y0, y1, y2}) + radius + 1;
-        if (minX > clipR || maxX < clipX || minY > clipB || maxY < clipY)
+        if (minX > s.clipR || maxX < s.clipX || minY > s.clipB || maxY < s.clipY)
             return;
 
-        const float v0x = x0, v0y = y0, v1x = x1, v1y = y1, v2x = x2, v2y = y2;
-        const float e0x = v1x - v0x, e0y = v1y - v0y, inv_len0 = 1.0f / (e0x * e0x + e0y * e0y);
-        const float e1x = v2x - v1x, e1y = v2y - v1y, inv_len1 = 1.0f / (e1x * e1x + e1y * e1y);
-        const float e2x = v0x - v2x, e2y = v0y - v2y, inv_len2 = 1.0f / (e2x * e2x + e2y * e2y);
-        const float sign = (e0x * (v2y - v0y) - e0y * (v2x - v0x) < 0.0f) ? -1.0f : 1.0f;
-
         const Color565 c = makeColor565(color);
-        const uint8_t *gamma = gammaTable();
-        const int16_t xStart = (minX < clipX) ? (int16_t)clipX : minX;
-        const int16_t xEnd = (maxX > clipR) ? (int16_t)clipR : maxX;
-        const int16_t yStart = (minY < clipY) ? (int16_t)clipY : minY;
-        const int16_t yEnd = (maxY > clipB) ? (int16_t)clipB : maxY;
-        const DistSqAlphaLut &aaLut = roundTriangleFillLut(radius);
-        const float innerRadius2 = aaLut.minSq;
-        const float outerRadius2 = aaLut.maxSq;
-
-        for (int16_t py = yStart; py <= yEnd; ++py)
-        {
-            const float py_f = py + 0.5f;
-            const float dy0 = py_f - v0y, dy1 = py_f - v1y, dy2 = py_f - v2y;
-            const int32_t row_offset = py * stride;
-            float dx0 = (float)xStart + 0.5f - v0x;
-            float dx1 = (float)xStart + 0.5f - v1x;
-            float dx2 = (float)xStart + 0.5f - v2x;
-            float c0 = e0x * dy0 - e0y * dx0;
-            float c1 = e1x * dy1 - e1y * dx1;
-            float c2 = e2x * dy2 - e2y * dx2;
-            float dot0 = dx0 * e0x + dy0 * e0y;
-            float dot1 = dx1 * e1x + dy1 * e1y;
-            float dot2 = dx2 * e2x + dy2 * e2y;
-
-            for (int16_t px = xStart; px <= xEnd; ++px)
-            {
-                const float side0 = c0 * sign;
-                const float side1 = c1 * sign;
-                const float side2 = c2 * sign;
-                if (side0 >= 0.0f && side1 >= 0.0f && side2 >= 0.0f)
-                {
-                    buf[row_offset + px] = c.fg;
-                }
-                else
-                {
-                    float d_sq = 0.0f;
-                    bool hasDistance = false;
-                    if (side0 < 0.0f)
-                    {
-                        d_sq = distanceSqToSegmentProjected(dx0, dy0, e0x, e0y, inv_len0, dot0);
-                        hasDistance = true;
-                    }
-                    if (side1 < 0.0f)
-                    {
-                        const float d1_sq = distanceSqToSegmentProjected(dx1, dy1, e1x, e1y, inv_len1, dot1);
-                        if (!hasDistance || d1_sq < d_sq)
-                            d_sq = d1_sq;
-                        hasDistance = true;
-                    }
-                    if (side2 < 0.0f)
-                    {
-                        const float d2_sq = distanceSqToSegmentProjected(dx2, dy2, e2x, e2y, inv_len2, dot2);
-                        if (!hasDistance || d2_sq < d_sq)
-                            d_sq = d2_sq;
-                    }
-
-                    if (d_sq <= innerRadius2)
-                    {
-                        buf[row_offset + px] = c.fg;
-                    }
-                    else if (d_sq <= outerRadius2)
-                    {
-                        const uint8_t a = sampleDistSqAlpha(aaLut, d_sq);
-                        if (a == 255)
-                            buf[row_offset + px] = c.fg;
-                        else if (a > 0)
-                            blendStore(buf + row_offset + px, c, gamma[a]);
-                    }
-                }
-
-                dx0 += 1.0f;
-                dx1 += 1.0f;
-                dx2 += 1.0f;
-                c0 -= e0y;
-                c1 -= e1y;
-                c2 -= e2y;
-                dot0 += e0x;
-                dot1 += e1x;
-                dot2 += e2x;
-            }
-        }
+        const TriangleAlphaLut &aaLut = roundTriangleFillLut(radius);
+        TriangleEdge edges[3];
+        setupTriangleEdges(edges, x0, y0, x1, y1, x2, y2, aaLut.maxQ8);
+        const int32_t xStart = (minX < s.clipX) ? s.clipX : minX, xEnd = (maxX > s.clipR) ? s.clipR : maxX;
+        const int32_t yStart = (minY < s.clipY) ? s.clipY : minY, yEnd = (maxY > s.clipB) ? s.clipB : maxY;
+        if (maxX - minX < 8192 && maxY - minY < 8192)
+            rasterRoundTriangle<true, int32_t>(s, c, edges, aaLut, xStart, xEnd, yStart, yEnd);
+        else
+            rasterRoundTriangle<true, int64_t>(s, c, edges, aaLut, xStart, xEnd, yStart, yEnd);
 
         if (_disp.display && !_flags.inSpritePass)
             invalidateRect(minX, minY, maxX - minX + 1, maxY - minY + 1);
@@ -707,9 +847,26 @@ namespace pipgui
                                uint8_t radiusTL, uint8_t radiusTR, uint8_t radiusBR, uint8_t radiusBL,
                                uint16_t color)
     {
-        if (!_flags.spriteEnabled || w <= 0 || h <= 0)
+        if (!_flags.spriteEnabled || quickReject(x, y, w, h))
             return;
 
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::FillSquircleRect, x, y, w, h))
+            {
+                cmd->color = color;
+                cmd->radius[0] = radiusTL;
+                cmd->radius[1] = radiusTR;
+                cmd->radius[2] = radiusBR;
+                cmd->radius[3] = radiusBL;
+                cmd->v[0] = x;
+                cmd->v[1] = y;
+                cmd->v[2] = w;
+                cmd->v[3] = h;
+            }
+            return;
+        }
+
         auto spr = getDrawTarget();
         Surface565 s;
         if (!getSurface565(spr, s))
@@ -738,7 +895,21 @@ namespace pipgui
             const int16_t cy = static_cast<int16_t>(y + r);
             const bool noClip = (cx - r - 1 >= s.clipX && cx + r + 1 <= s.clipR &&
                                  cy - r - 1 >= s.clipY && cy + r + 1 <= s.clipB);
-            squircleRaster<true, uint32_t>(s, c, cx, cy, r, gamma, noClip);
+            const detail::ShapeMask mask = detail::shapeMask(detail::ShapeMaskKind::SquircleFill, rTL);
+            if (mask.alpha)
+            {
+                blitShapeMask(s, c, mask, x, y, false, false);
+                blitShapeMask(s, c, mask, static_cast<int16_t>(cx + 1), y, true, false);
+                blitShapeMask(s, c, mask, x, static_cast<int16_t>(cy + 1), false, true);
+                blitShapeMask(s, c, mask, static_cast<int16_t>(cx + 1), static_cast<int16_t>(cy + 1), true, true);
+                fillSurfaceRect(s, c, x, cy, w, 1);
+                fillSurfaceRect(s, c, cx, y, 1, r);
+                fillSurfaceRect(s, c, cx, static_cast<int16_t>(cy + 1), 1, r);
+            }
+            else
+            {
+                squircleRaster<true, uint32_t>(s, c, cx, cy, r, gamma, noClip);
+            }
             if (_disp.display && !_flags.inSpritePass)
                 invalidateRect(cx - r - 1, cy - r - 1, r * 2 + 3, r * 2 + 3);
             return;
@@ -796,8 +967,25 @@ namespace pipgui
                                uint8_t radiusTL, uint8_t radiusTR, uint8_t radiusBR, uint8_t radiusBL,
                                uint16_t color)
     {
-        if (!_flags.spriteEnabled || w <= 0 || h <= 0)
+        if (!_flags.spriteEnabled || quickReject(x, y, w, h))
+            return;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::DrawSquircleRect, x, y, w, h))
+            {
+                cmd->color = color;
+                cmd->radius[0] = radiusTL;
+                cmd->radius[1] = radiusTR;
+                cmd->radius[2] = radiusBR;
+                cmd->radius[3] = radiusBL;
+                cmd->v[0] = x;
+                cmd->v[1] = y;
+                cmd->v[2] = w;
+                cmd->v[3] = h;
+            }
             return;
+        }
 
         auto spr = getDrawTarget();
         Surface565 s;
@@ -7,9 +7,6 @@ namespace pipgui
     {
         constexpr float kArcDegToRad = 0.01745329252f;
         constexpr float kArcRadToDeg = 57.2957795f;
-        constexpr int kArcSubSamples = 2;
-        constexpr int kArcSubSampleCount = kArcSubSamples * kArcSubSamples;
-        constexpr float kArcCrossEpsilon = 0.0001f;
 
         struct ArcSweepInfo
         {
@@ -64,19 +61,84 @@ namespace pipgui
             return info;
         }
 
-        static inline bool pointInArcSweep(const ArcSweepInfo &info, float dx, float dy) noexcept
+        // Signed distance (pixels, negative inside) to the angular wedge; the start and end rays are
+        // half-planes through the centre, intersected for sweeps up to 180 degrees and united above.
+        static inline float arcSweepDistance(const ArcSweepInfo &info, float dx, float dy) noexcept
         {
-            if (info.full)
-                return true;
-
             const float px = dx;
             const float py = -dy;
             const float crossStart = info.startDirX * py - info.startDirY * px;
             const float crossEnd = px * info.endDirY - py * info.endDirX;
-
             if (!info.wide)
-                return crossStart <= kArcCrossEpsilon && crossEnd <= kArcCrossEpsilon;
-            return crossStart <= kArcCrossEpsilon || crossEnd <= kArcCrossEpsilon;
+                return crossStart > crossEnd ? crossStart : crossEnd;
+            return crossStart < crossEnd ? crossStart : crossEnd;
+        }
+
+        static inline uint8_t sdfCoverage(float sd) noexcept
+        {
+            if (sd <= -0.5f)
+                return 255;
+            if (sd >= 0.5f)
+                return 0;
+            return static_cast<uint8_t>((0.5f - sd) * 255.0f + 0.5f);
+        }
+
+        static inline float fastAtan2Deg(float y, float x) noexcept
+        {
+            const float ax = fabsf(x);
+            const float ay = fabsf(y);
+            const float mx = ax > ay ? ax : ay;
+            if (mx <= 0.0f)
+                return 0.0f;
+            const float a = (ax < ay ? ax : ay) / mx;
+            const float s = a * a;
+            float r = ((-0.0464964749f * s + 0.15931422f) * s - 0.327622764f) * s * a + a;
+            if (ay > ax)
+                r = 1.57079637f - r;
+            if (x < 0.0f)
+                r = 3.14159274f - r;
+            if (y < 0.0f)
+                r = -r;
+            return r * kArcRadToDeg;
+        }
+
+        static inline bool clampRowSpan(const Surface565 &s, float xl, float xr, int32_t &x0, int32_t &x1) noexcept
+        {
+            x0 = static_cast<int32_t>(floorf(xl));
+            x1 = static_cast<int32_t>(ceilf(xr));
+            if (x0 < s.clipX)
+                x0 = s.clipX;
+            if (x1 > s.clipR)
+                x1 = s.clipR;
+            return x0 <= x1;
+        }
+
+        // Walks [x0, x1] of one row, blending edge pixels and filling fully covered runs in one go.
+        template <typename CoverageFn>
+        static inline void rasterCoverageRow(const Surface565 &s, const Color565 &c, const uint8_t *gamma,
+                                             int32_t py, int32_t x0, int32_t x1, CoverageFn coverageAt)
+        {
+            uint16_t *row = s.row(py);
+            int32_t runStart = -1;
+            for (int32_t px = x0; px <= x1; ++px)
+            {
+                const uint8_t a = coverageAt(px);
+                if (a == 255)
+                {
+                    if (runStart < 0)
+                        runStart = px;
+                    continue;
+                }
+                if (runStart >= 0)
+                {
+                    spanFill(row + runStart, static_cast<int16_t>(px - runStart), c.fg, c.fg32);
+                    runStart = -1;
+                }
+                if (a)
+                    blendStore(row + px, c, gamma[a]);
+            }
+            if (runStart >= 0)
+                spanFill(row + runStart, static_cast<int16_t>(x1 + 1 - runStart), c.fg, c.fg32);
         }
 
         template <typename ColorFunc>
@@ -99,67 +161,108 @@ namespace pipgui
 
             const float outerR = static_cast<float>(r) + 0.5f;
             const float innerR = static_cast<float>(r - thickness) + 0.5f;
-            const float outerR2 = outerR * outerR;
-            const float innerR2 = innerR > 0.0f ? innerR * innerR : 0.0f;
-            const int16_t outerBound = static_cast<int16_t>(ceilf(outerR)) + 1;
-            int32_t minX = static_cast<int32_t>(cx - outerBound);
-            int32_t maxX = static_cast<int32_t>(cx + outerBound);
-            int32_t minY = static_cast<int32_t>(cy - outerBound);
-            int32_t maxY = static_cast<int32_t>(cy + outerBound);
-            if (minX < s.clipX)
-                minX = s.clipX;
-            if (maxX > s.clipR)
-                maxX = s.clipR;
+            const bool hasHole = innerR > 0.5f;
+            const float reachR = outerR + 0.5f;
+            const float reachR2 = reachR * reachR;
+            const float holeR = hasHole ? innerR - 0.5f : 0.0f;
+            const float holeR2 = holeR * holeR;
+            const float solidOuter = outerR - 0.5f;
+            const float solidOuter2 = solidOuter * solidOuter;
+            const float solidInner = hasHole ? innerR + 0.5f : 0.0f;
+            const float solidInner2 = solidInner * solidInner;
+
+            int32_t minY = static_cast<int32_t>(floorf(static_cast<float>(cy) - reachR));
+            int32_t maxY = static_cast<int32_t>(ceilf(static_cast<float>(cy) + reachR));
             if (minY < s.clipY)
                 minY = s.clipY;
             if (maxY > s.clipB)
                 maxY = s.clipB;
-            if (minX > maxX || minY > maxY)
+            if (minY > maxY)
                 return;
 
-            const float subStep = 1.0f / static_cast<float>(kArcSubSamples);
-            const float subBias = 0.5f * subStep;
             const uint8_t *gamma = gammaTable();
             const ArcSweepInfo sweepInfo = makeArcSweepInfo(fullRing, startDeg, endDeg);
+            const bool shaded = needsColorAngle && !sweepInfo.full;
+            const Color565 solid = makeColor565(colorAtAngle(0.0f));
+            const float fcx = static_cast<float>(cx);
 
-            for (int32_t py = minY; py <= maxY; ++py)
+            auto coverageAt = [&](float dx, float dy, float d2) -> uint8_t
             {
-                for (int32_t px = minX; px <= maxX; ++px)
+                float sd;
+                if (d2 <= solidOuter2 && d2 >= solidInner2)
                 {
-                    int covered = 0;
-                    for (int sy = 0; sy < kArcSubSamples; ++sy)
-                    {
-                        const float dy = (static_cast<float>(py - cy) - 0.5f) + subBias + static_cast<float>(sy) * subStep;
-                        for (int sx = 0; sx < kArcSubSamples; ++sx)
-                        {
-                            const float dx = (static_cast<float>(px - cx) - 0.5f) + subBias + static_cast<float>(sx) * subStep;
-                            const float d2 = dx * dx + dy * dy;
-                            if (d2 > outerR2 || d2 < innerR2)
-                                continue;
-                            if (!pointInArcSweep(sweepInfo, dx, dy))
-                                continue;
-                            ++covered;
-                        }
-                    }
+                    if (sweepInfo.full)
+                        return 255;
+                    sd = -0.5f;
+                }
+                else
+                {
+                    const float d = sqrtf(d2);
+                    const float outerSd = d - outerR;
+                    const float innerSd = hasHole ? innerR - d : -d;
+                    sd = outerSd > innerSd ? outerSd : innerSd;
+                }
+                if (!sweepInfo.full)
+                {
+                    const float wedgeSd = arcSweepDistance(sweepInfo, dx, dy);
+                    if (wedgeSd > sd)
+                        sd = wedgeSd;
+                }
+                return sdfCoverage(sd);
+            };
 
-                    if (covered == 0)
-                        continue;
+            auto rasterSpan = [&](int32_t py, float dy, int32_t x0, int32_t x1)
+            {
+                const float dy2 = dy * dy;
+                if (!shaded)
+                {
+                    rasterCoverageRow(s, solid, gamma, py, x0, x1, [&](int32_t px) -> uint8_t
+                                      {
+                                          const float dx = static_cast<float>(px - cx);
+                                          return coverageAt(dx, dy, dx * dx + dy2); });
+                    return;
+                }
 
-                    float colorDeg = 0.0f;
-                    if (needsColorAngle && !sweepInfo.full)
-                    {
-                        colorDeg = normalizeArcDeg(atan2f(static_cast<float>(py - cy), static_cast<float>(px - cx)) * kArcRadToDeg + 90.0f);
-                        if (!angleInArcSweep(colorDeg, sweepInfo.startDeg, sweepInfo.endDeg))
-                            colorDeg = normalizeArcDeg((sweepInfo.startDeg + sweepInfo.sweepDeg * 0.5f));
-                    }
+                uint16_t *row = s.row(py);
+                for (int32_t px = x0; px <= x1; ++px)
+                {
+                    const float dx = static_cast<float>(px - cx);
+                    const uint8_t a = coverageAt(dx, dy, dx * dx + dy2);
+                    if (!a)
+                        continue;
 
+                    float colorDeg = normalizeArcDeg(fastAtan2Deg(dy, dx) + 90.0f);
+                    if (!angleInArcSweep(colorDeg, sweepInfo.startDeg, sweepInfo.endDeg))
+                        colorDeg = normalizeArcDeg((sweepInfo.startDeg + sweepInfo.sweepDeg * 0.5f));
                     const Color565 c = makeColor565(colorAtAngle(colorDeg));
-                    uint16_t *dst = s.buf + static_cast<int32_t>(py) * s.stride + px;
-                    if (covered >= kArcSubSampleCount)
-                        *dst = c.fg;
+                    if (a == 255)
+                        row[px] = c.fg;
                     else
-                        blendStore(dst, c, gamma[(covered * 255) / kArcSubSampleCount]);
+                        blendStore(row + px, c, gamma[a]);
+                }
+            };
+
+            for (int32_t py = minY; py <= maxY; ++py)
+            {
+                const float dy = static_cast<float>(py - cy);
+                const float dy2 = dy * dy;
+                if (dy2 > reachR2)
+                    continue;
+
+                const float xo = sqrtf(reachR2 - dy2);
+                const float xi = (hasHole && dy2 < holeR2) ? sqrtf(holeR2 - dy2) : 0.0f;
+                int32_t x0 = 0;
+                int32_t x1 = 0;
+                if (xi <= 1.0f)
+                {
+                    if (clampRowSpan(s, fcx - xo, fcx + xo, x0, x1))
+                        rasterSpan(py, dy, x0, x1);
+                    continue;
                 }
+                if (clampRowSpan(s, fcx - xo, fcx - xi, x0, x1))
+                    rasterSpan(py, dy, x0, x1);
+                if (clampRowSpan(s, fcx + xi, fcx + xo, x0, x1))
+                    rasterSpan(py, dy, x0, x1);
             }
         }
 
@@ -175,51 +278,43 @@ namespace pipgui
             if (!getSurface565(spr, s))
                 return;
 
-            int32_t minX = static_cast<int32_t>(floorf(cx - radius - 1.0f));
-            int32_t maxX = static_cast<int32_t>(ceilf(cx + radius + 1.0f));
-            int32_t minY = static_cast<int32_t>(floorf(cy - radius - 1.0f));
-            int32_t maxY = static_cast<int32_t>(ceilf(cy + radius + 1.0f));
-            if (minX < s.clipX)
-                minX = s.clipX;
-            if (maxX > s.clipR)
-                maxX = s.clipR;
+            const float reach = radius + 0.5f;
+            const float reach2 = reach * reach;
+            const float solid = radius - 0.5f;
+            const float solid2 = solid > 0.0f ? solid * solid : -1.0f;
+            int32_t minY = static_cast<int32_t>(floorf(cy - reach));
+            int32_t maxY = static_cast<int32_t>(ceilf(cy + reach));
             if (minY < s.clipY)
                 minY = s.clipY;
             if (maxY > s.clipB)
                 maxY = s.clipB;
-            if (minX > maxX || minY > maxY)
+            if (minY > maxY)
                 return;
-            const float radius2 = radius * radius;
-            const float subStep = 1.0f / static_cast<float>(kArcSubSamples);
-            const float subBias = 0.5f * subStep;
+
             const uint8_t *gamma = gammaTable();
             const Color565 c = makeColor565(color);
 
             for (int32_t py = minY; py <= maxY; ++py)
             {
-                for (int32_t px = minX; px <= maxX; ++px)
-                {
-                    int covered = 0;
-                    for (int sy = 0; sy < kArcSubSamples; ++sy)
-                    {
-                        const float dy = (static_cast<float>(py) - cy - 0.5f) + subBias + static_cast<float>(sy) * subStep;
-                        for (int sx = 0; sx < kArcSubSamples; ++sx)
-                        {
-                            const float dx = (static_cast<float>(px) - cx - 0.5f) + subBias + static_cast<float>(sx) * subStep;
-                            if (dx * dx + dy * dy <= radius2)
-                                ++covered;
-                        }
-                    }
-
-                    if (covered == 0)
-                        continue;
-
-                    uint16_t *dst = s.buf + static_cast<int32_t>(py) * s.stride + px;
-                    if (covered >= kArcSubSampleCount)
-                        *dst = c.fg;
-                    else
-                        blendStore(dst, c, gamma[(covered * 255) / kArcSubSampleCount]);
-                }
+                const float dy = static_cast<float>(py) - cy;
+                const float dy2 = dy * dy;
+                if (dy2 > reach2)
+                    continue;
+                const float half = sqrtf(reach2 - dy2);
+                int32_t x0 = 0;
+                int32_t x1 = 0;
+                if (!clampRowSpan(s, cx - half, cx + half, x0, x1))
+                    continue;
+
+                rasterCoverageRow(s, c, gamma, py, x0, x1, [&](int32_t px) -> uint8_t
+                                  {
+                                      const float dx = static_cast<float>(px) - cx;
+                                      const float d2 = dx * dx + dy2;
+                                      if (d2 <= solid2)
+                                          return 255;
+                                      if (d2 >= reach2)
+                                          return 0;
+                                      return sdfCoverage(sqrtf(d2) - radius); });
             }
         }
 
@@ -278,145 +373,113 @@ namespace pipgui
                 radius -= 0.125f;
             if (radius < 0.5f)
                 radius = 0.5f;
-            const float radius2 = radius * radius;
-            int32_t minX = static_cast<int32_t>(floorf((x0 < x1 ? x0 : x1) - radius - 1.0f));
-            int32_t maxX = static_cast<int32_t>(ceilf((x0 > x1 ? x0 : x1) + radius + 1.0f));
-            int32_t minY = static_cast<int32_t>(floorf((y0 < y1 ? y0 : y1) - radius - 1.0f));
-            int32_t maxY = static_cast<int32_t>(ceilf((y0 > y1 ? y0 : y1) + radius + 1.0f));
-            if (minX < s.clipX)
-                minX = s.clipX;
-            if (maxX > s.clipR)
-                maxX = s.clipR;
-            if (minY < s.clipY)
-                minY = s.clipY;
-            if (maxY > s.clipB)
-                maxY = s.clipB;
-            if (minX > maxX || minY > maxY)
-                return;
 
-            const float vx = static_cast<float>(x1 - x0);
-            const float vy = static_cast<float>(y1 - y0);
+            const float fx0 = static_cast<float>(x0);
+            const float fy0 = static_cast<float>(y0);
+            const float fx1 = static_cast<float>(x1);
+            const float fy1 = static_cast<float>(y1);
+            const float vx = fx1 - fx0;
+            const float vy = fy1 - fy0;
             const float len2 = vx * vx + vy * vy;
             if (len2 <= 0.0f)
             {
-                rasterArcCapAA(spr, static_cast<float>(x0), static_cast<float>(y0), radius, color565);
+                rasterArcCapAA(spr, fx0, fy0, radius, color565);
                 return;
             }
-            const float invLen2 = 1.0f / len2;
 
-            const float subStep = 1.0f / static_cast<float>(kArcSubSamples);
-            const float subBias = 0.5f * subStep;
+            const float len = sqrtf(len2);
+            const float ux = vx / len;
+            const float uy = vy / len;
+            const float reach = radius + 0.5f;
+            const float reach2 = reach * reach;
+            const float solid = radius - 0.5f;
+            const float solid2 = solid > 0.0f ? solid * solid : -1.0f;
+
+            int32_t minY = static_cast<int32_t>(floorf((fy0 < fy1 ? fy0 : fy1) - reach));
+            int32_t maxY = static_cast<int32_t>(ceilf((fy0 > fy1 ? fy0 : fy1) + reach));
+            if (minY < s.clipY)
+                minY = s.clipY;
+            if (maxY > s.clipB)
+                maxY = s.clipB;
+            if (minY > maxY)
+                return;
+
             const uint8_t *gamma = gammaTable();
             const Color565 c = makeColor565(color565);
 
-            for (int32_t py = minY; py <= maxY; ++py)
+            // Rows only visit the capsule of radius `reach`: its extent on a row comes from the end discs
+            // and the two side edges, which is exact because the capsule is convex.
+            const float nx = -uy * reach;
+            const float ny = ux * reach;
+            auto capsuleRowExtent = [&](float py, float &xl, float &xr)
             {
-                for (int32_t px = minX; px <= maxX; ++px)
+                auto take = [&](float x)
                 {
-                    int covered = 0;
-                    for (int sy = 0; sy < kArcSubSamples; ++sy)
-                    {
-                        const float sampleY = (static_cast<float>(py) - 0.5f) + subBias + static_cast<float>(sy) * subStep;
-                        for (int sx = 0; sx < kArcSubSamples; ++sx)
-                        {
-                            const float sampleX = (static_cast<float>(px) - 0.5f) + subBias + static_cast<float>(sx) * subStep;
-                            float t = ((sampleX - static_cast<float>(x0)) * vx + (sampleY - static_cast<float>(y0)) * vy) * invLen2;
-                            if (t < 0.0f)
-                            {
-                                if (!roundStart)
-                                    continue;
-                                t = 0.0f;
-                            }
-                            else if (t > 1.0f)
-                            {
-                                if (!roundEnd)
-                                    continue;
-                                t = 1.0f;
-                            }
-                            const float dx = sampleX - (static_cast<float>(x0) + vx * t);
-                            const float dy = sampleY - (static_cast<float>(y0) + vy * t);
-                            if (dx * dx + dy * dy <= radius2)
-                                ++covered;
-                        }
-                    }
-
-                    if (covered == 0)
-                        continue;
-
-                    uint16_t *dst = s.buf + static_cast<int32_t>(py) * s.stride + px;
-                    if (covered >= kArcSubSampleCount)
-                        *dst = c.fg;
-                    else
-                        blendStore(dst, c, gamma[(covered * 255) / kArcSubSampleCount]);
-                }
-            }
-        }
-        template <bool Fill>
-        static inline const uint8_t *tinyCircleMask(uint8_t r, uint8_t &outSize)
-        {
-            static uint8_t *fillMasks[6] = {};
-            static uint8_t *drawMasks[6] = {};
-            static bool ready[2][6] = {};
-
-            if (r == 0 || r > 5)
-            {
-                outSize = 0;
-                return nullptr;
-            }
-
-            uint8_t **masks = Fill ? fillMasks : drawMasks;
-            bool *state = ready[Fill ? 1 : 0];
-            if (!state[r])
-            {
-                if (!masks[r])
+                    if (x < xl)
+                        xl = x;
+                    if (x > xr)
+                        xr = x;
+                };
+                auto disc = [&](float ex, float ey)
                 {
-                    masks[r] = static_cast<uint8_t *>(malloc(11 * 11));
-                    if (!masks[r])
+                    const float dy = py - ey;
+                    if (dy * dy <= reach2)
                     {
-                        outSize = 0;
-                        return nullptr;
+                        const float h = sqrtf(reach2 - dy * dy);
+                        take(ex - h);
+                        take(ex + h);
                     }
-                }
-                constexpr int kSub = 8;
-                constexpr float kInvSubArea = 255.0f / (float)(kSub * kSub);
-                const int size = r * 2 + 1;
-                const float outerR = (float)r + 0.5f;
-                const float innerR = Fill ? -1.0f : std::max(0.0f, (float)r - 0.5f);
-                const float subStep = 1.0f / (float)kSub;
-                const float subBias = 0.5f * subStep;
-
-                for (int py = 0; py < size; ++py)
+                };
+                auto side = [&](float ax, float ay, float bx, float by)
                 {
-                    for (int px = 0; px < size; ++px)
-                    {
-                        int covered = 0;
-                        for (int sy = 0; sy < kSub; ++sy)
-                        {
-                            const float y = ((float)py - (float)r - 0.5f) + subBias + (float)sy * subStep;
-                            for (int sx = 0; sx < kSub; ++sx)
-                            {
-                                const float x = ((float)px - (float)r - 0.5f) + subBias + (float)sx * subStep;
-                                const float d2 = x * x + y * y;
-                                if constexpr (Fill)
-                                {
-                                    if (d2 <= outerR * outerR)
-                                        ++covered;
-                                }
-                                else
-                                {
-                                    if (d2 <= outerR * outerR && d2 >= innerR * innerR)
-                                        ++covered;
-                                }
-                            }
-                        }
-                        masks[r][py * 11 + px] = (uint8_t)(covered * kInvSubArea + 0.5f);
-                    }
-                }
-                state[r] = true;
-            }
+                    const float dy = by - ay;
+                    if (fabsf(dy) < 1e-6f)
+                        return;
+                    const float t = (py - ay) / dy;
+                    if (t >= 0.0f && t <= 1.0f)
+                        take(ax + (bx - ax) * t);
+                };
+                disc(fx0, fy0);
+                disc(fx1, fy1);
+                side(fx0 + nx, fy0 + ny, fx1 + nx, fy1 + ny);
+                side(fx0 - nx, fy0 - ny, fx1 - nx, fy1 - ny);
+            };
 
-            outSize = (uint8_t)(r * 2 + 1);
-            return masks[r];
+            for (int32_t py = minY; py <= maxY; ++py)
+            {
+                const float fpy = static_cast<float>(py);
+                float xl = 1e9f;
+                float xr = -1e9f;
+                capsuleRowExtent(fpy, xl, xr);
+                int32_t rx0 = 0;
+                int32_t rx1 = 0;
+                if (xl > xr || !clampRowSpan(s, xl, xr, rx0, rx1))
+                    continue;
+
+                const float qy = fpy - fy0;
+                rasterCoverageRow(s, c, gamma, py, rx0, rx1, [&](int32_t px) -> uint8_t
+                                  {
+                                      const float qx = static_cast<float>(px) - fx0;
+                                      const float along = qx * ux + qy * uy;
+                                      const float perp = fabsf(qy * ux - qx * uy);
+                                      if (along < 0.0f || along > len)
+                                      {
+                                          const bool round = along < 0.0f ? roundStart : roundEnd;
+                                          const float over = along < 0.0f ? -along : along - len;
+                                          if (!round)
+                                          {
+                                              const float perpSd = perp - radius;
+                                              return sdfCoverage(perpSd > over ? perpSd : over);
+                                          }
+                                          const float d2 = over * over + perp * perp;
+                                          if (d2 <= solid2)
+                                              return 255;
+                                          if (d2 >= reach2)
+                                              return 0;
+                                          return sdfCoverage(sqrtf(d2) - radius);
+                                      }
+                                      return sdfCoverage(perp - radius); });
+            }
         }
     }
 
@@ -432,6 +495,30 @@ namespace pipgui
         if (!_flags.spriteEnabled)
             return;
 
+        const int16_t pad = (int16_t)(thickness / 2 + 2);
+        const int16_t bx = (int16_t)(std::min(x0, x1) - pad);
+        const int16_t by = (int16_t)(std::min(y0, y1) - pad);
+        const int16_t bw = (int16_t)(std::abs(x1 - x0) + pad * 2 + 1);
+        const int16_t bh = (int16_t)(std::abs(y1 - y0) + pad * 2 + 1);
+        if (quickReject(bx, by, bw, bh))
+            return;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::Line, bx, by, bw, bh))
+            {
+                cmd->color = color;
+                cmd->thickness = thickness;
+                cmd->radius[0] = roundStart;
+                cmd->radius[1] = roundEnd;
+                cmd->v[0] = x0;
+                cmd->v[1] = y0;
+                cmd->v[2] = x1;
+                cmd->v[3] = y1;
+            }
+            return;
+        }
+
         auto spr = getDrawTarget();
         if (!spr)
             return;
@@ -475,6 +562,7 @@ namespace pipgui
         if (!buf)
             return;
         const int16_t stride = spr->width();
+        const int16_t bufY = spr->bufferY();
         if (stride <= 0 || spr->height() <= 0)
             return;
 
@@ -544,7 +632,7 @@ namespace pipgui
         auto blendFastClip = [&](int px, int py, uint8_t alpha) __attribute__((always_inline))
         {
             if (px >= clipX && px <= clipR && py >= clipY && py <= clipB)
-                blendFastPtr(buf + py * stride + px, alpha);
+                blendFastPtr(buf + (py - bufY) * stride + px, alpha);
         };
         if (steep)
         {
@@ -552,7 +640,7 @@ namespace pipgui
             if (noClip)
                 rasterAALine<true>(y0, y1, x0, step, w256, curve, gamma,
                                    [&](int32_t px, int32_t py, uint8_t alpha)
-                                   { blendFastPtr(buf + py * stride + px, alpha); });
+                                   { blendFastPtr(buf + (py - bufY) * stride + px, alpha); });
             else
                 rasterAALine<true>(y0, y1, x0, step, w256, curve, gamma, blendFastClip);
         }
@@ -562,7 +650,7 @@ namespace pipgui
             if (noClip)
                 rasterAALine<false>(x0, x1, y0, step, w256, curve, gamma,
                                     [&](int32_t px, int32_t py, uint8_t alpha)
-                                    { blendFastPtr(buf + py * stride + px, alpha); });
+                                    { blendFastPtr(buf + (py - bufY) * stride + px, alpha); });
             else
                 rasterAALine<false>(x0, x1, y0, step, w256, curve, gamma, blendFastClip);
         }
@@ -578,8 +666,21 @@ namespace pipgui
             x = AutoX(w);
         if (y == -1)
             y = AutoY(h);
-        if (w <= 0 || h <= 0 || !_flags.spriteEnabled)
+        if (!_flags.spriteEnabled || quickReject(x, y, w, h))
+            return;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::FillRect, x, y, w, h))
+            {
+                cmd->color = color;
+                cmd->v[0] = x;
+                cmd->v[1] = y;
+                cmd->v[2] = w;
+                cmd->v[3] = h;
+            }
             return;
+        }
 
         auto spr = getDrawTarget();
         if (!spr || !spr->getBuffer())
@@ -624,8 +725,23 @@ namespace pipgui
 
     void GUI::fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color565)
     {
+        if (r <= 0 || !_flags.spriteEnabled ||
+            quickReject((int16_t)(cx - r - 1), (int16_t)(cy - r - 1), (int16_t)(r * 2 + 3), (int16_t)(r * 2 + 3)))
+            return;
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::FillCircle, (int16_t)(cx - r - 1), (int16_t)(cy - r - 1),
+                                                         (int16_t)(r * 2 + 3), (int16_t)(r * 2 + 3)))
+            {
+                cmd->color = color565;
+                cmd->v[0] = cx;
+                cmd->v[1] = cy;
+                cmd->v[2] = r;
+            }
+            return;
+        }
         auto spr = getDrawTarget();
-        if (!_flags.spriteEnabled || r <= 0 || !spr)
+        if (!spr)
             return;
         Surface565 s;
         if (!getSurface565(spr, s))
@@ -634,36 +750,13 @@ namespace pipgui
             return;
         const Color565 c = makeColor565(color565);
         const bool noClip = (cx - r >= s.clipX && cx + r <= s.clipR && cy - r >= s.clipY && cy + r <= s.clipB);
-        const uint8_t *gamma = gammaTable();
 
         if (r <= 5)
         {
-            uint8_t maskSize = 0;
-            const uint8_t *mask = tinyCircleMask<true>((uint8_t)r, maskSize);
-            if (mask)
+            const detail::ShapeMask mask = detail::shapeMask(detail::ShapeMaskKind::CircleFill, (uint8_t)r);
+            if (mask.alpha)
             {
-                const int16_t x0 = (int16_t)(cx - r);
-                const int16_t y0 = (int16_t)(cy - r);
-                for (uint8_t py = 0; py < maskSize; ++py)
-                {
-                    const int16_t y = (int16_t)(y0 + py);
-                    if (y < s.clipY || y > s.clipB)
-                        continue;
-                    uint16_t *row = s.buf + (int32_t)y * s.stride;
-                    for (uint8_t px = 0; px < maskSize; ++px)
-                    {
-                        const uint8_t alpha = mask[(uint16_t)py * 11 + px];
-                        if (!alpha)
-                            continue;
-                        const int16_t x = (int16_t)(x0 + px);
-                        if (x < s.clipX || x > s.clipR)
-                            continue;
-                        if (alpha == 255)
-                            row[x] = c.fg;
-                        else
-                            blendStore(row + x, c, gamma[alpha]);
-                    }
-                }
+                blitShapeMask(s, c, mask, (int16_t)(cx - r), (int16_t)(cy - r), false, false);
                 if (_disp.display && _flags.spriteEnabled && !_flags.inSpritePass)
                     invalidateRect((int16_t)(cx - r), (int16_t)(cy - r),
                                    (int16_t)(r * 2 + 1), (int16_t)(r * 2 + 1));
@@ -678,7 +771,7 @@ namespace pipgui
 
         if (noClip)
             rasterAAFillRoundCore(cx, cy, r, 0, 0, [&](int16_t px, int16_t py, uint8_t alpha)
-                                  { blendStore(s.buf + (int32_t)py * s.stride + px, c, alpha); }, [&](int16_t py, int16_t x0, int16_t x1)
+                                  { blendStore(s.row(py) + px, c, alpha); }, [&](int16_t py, int16_t x0, int16_t x1)
                                   { fillSpanFast(s, py, x0, x1, c); });
         else
             rasterAAFillRoundCore(cx, cy, r, 0, 0, [&](int16_t px, int16_t py, uint8_t alpha)
@@ -692,40 +785,30 @@ namespace pipgui
 
     void GUI::drawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color)
     {
-        if (r <= 0)
+        if (r <= 0 ||
+            quickReject((int16_t)(cx - r - 1), (int16_t)(cy - r - 1), (int16_t)(r * 2 + 3), (int16_t)(r * 2 + 3)))
+            return;
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::DrawCircle, (int16_t)(cx - r - 1), (int16_t)(cy - r - 1),
+                                                         (int16_t)(r * 2 + 3), (int16_t)(r * 2 + 3)))
+            {
+                cmd->color = color;
+                cmd->v[0] = cx;
+                cmd->v[1] = cy;
+                cmd->v[2] = r;
+            }
             return;
+        }
         auto spr = getDrawTarget();
         Surface565 s;
         if (spr && getSurface565(spr, s) && r <= 5)
         {
-            uint8_t maskSize = 0;
-            const uint8_t *mask = tinyCircleMask<false>((uint8_t)r, maskSize);
-            if (mask)
+            const detail::ShapeMask mask = detail::shapeMask(detail::ShapeMaskKind::CircleStroke, (uint8_t)r);
+            if (mask.alpha)
             {
                 const Color565 c = makeColor565(color);
-                const uint8_t *gamma = gammaTable();
-                const int16_t x0 = (int16_t)(cx - r);
-                const int16_t y0 = (int16_t)(cy - r);
-                for (uint8_t py = 0; py < maskSize; ++py)
-                {
-                    const int16_t y = (int16_t)(y0 + py);
-                    if (y < s.clipY || y > s.clipB)
-                        continue;
-                    uint16_t *row = s.buf + (int32_t)y * s.stride;
-                    for (uint8_t px = 0; px < maskSize; ++px)
-                    {
-                        const uint8_t alpha = mask[(uint16_t)py * 11 + px];
-                        if (!alpha)
-                            continue;
-                        const int16_t x = (int16_t)(x0 + px);
-                        if (x < s.clipX || x > s.clipR)
-                            continue;
-                        if (alpha == 255)
-                            row[x] = c.fg;
-                        else
-                            blendStore(row + x, c, gamma[alpha]);
-                    }
-                }
+                blitShapeMask(s, c, mask, (int16_t)(cx - r), (int16_t)(cy - r), false, false);
                 if (_disp.display && _flags.spriteEnabled && !_flags.inSpritePass)
                     invalidateRect((int16_t)(cx - r), (int16_t)(cy - r),
                                    (int16_t)(r * 2 + 1), (int16_t)(r * 2 + 1));
@@ -741,8 +824,25 @@ namespace pipgui
                             uint8_t radiusTL, uint8_t radiusTR,
                             uint8_t radiusBR, uint8_t radiusBL, uint16_t color565)
     {
-        if (!_flags.spriteEnabled || w <= 0 || h <= 0)
+        if (!_flags.spriteEnabled || quickReject(x, y, w, h))
+            return;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::FillRoundRect, x, y, w, h))
+            {
+                cmd->color = color565;
+                cmd->radius[0] = radiusTL;
+                cmd->radius[1] = radiusTR;
+                cmd->radius[2] = radiusBR;
+                cmd->radius[3] = radiusBL;
+                cmd->v[0] = x;
+                cmd->v[1] = y;
+                cmd->v[2] = w;
+                cmd->v[3] = h;
+            }
             return;
+        }
 
         const int16_t maxR = (w < h ? w : h) / 2;
         const uint8_t rTL = (radiusTL > maxR) ? (uint8_t)maxR : radiusTL;
@@ -799,7 +899,7 @@ namespace pipgui
 
             if (noClip)
                 rasterAAFillRoundCore(xx, yy, rr, ww, hx, [&](int16_t px, int16_t py, uint8_t alpha)
-                                      { blendStore(s.buf + (int32_t)py * s.stride + px, c, alpha); }, fillSpan);
+                                      { blendStore(s.row(py) + px, c, alpha); }, fillSpan);
             else
                 rasterAAFillRoundCore(xx, yy, rr, ww, hx, [&](int16_t px, int16_t py, uint8_t alpha)
                                       { plotBlendClip(s, c, px, py, alpha); }, fillSpan);
@@ -854,7 +954,7 @@ namespace pipgui
 
             for (int16_t py = py0; py <= py1; ++py)
             {
-                uint16_t *row = s.buf + (int32_t)py * s.stride;
+                uint16_t *row = s.row(py);
                 int16_t solid_x0 = x, solid_x1 = x + w - 1;
 
                 if (leftEdge.topRadius && py <= leftEdge.topEndY)
@@ -884,8 +984,25 @@ namespace pipgui
                             uint8_t radiusTL, uint8_t radiusTR,
                             uint8_t radiusBR, uint8_t radiusBL, uint16_t color565)
     {
-        if (!_flags.spriteEnabled || w <= 0 || h <= 0)
+        if (!_flags.spriteEnabled || quickReject(x, y, w, h))
             return;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::DrawRoundRect, x, y, w, h))
+            {
+                cmd->color = color565;
+                cmd->radius[0] = radiusTL;
+                cmd->radius[1] = radiusTR;
+                cmd->radius[2] = radiusBR;
+                cmd->radius[3] = radiusBL;
+                cmd->v[0] = x;
+                cmd->v[1] = y;
+                cmd->v[2] = w;
+                cmd->v[3] = h;
+            }
+            return;
+        }
         if (w <= 2 || h <= 2)
         {
             fillRect(x, y, w, h, color565);
@@ -947,7 +1064,7 @@ namespace pipgui
 
             if (noClip)
                 rasterAARingRoundCore(x0, y0, r, ww, hh, t, [&](int16_t px, int16_t py, uint8_t alpha)
-                                      { blendStore(s.buf + (int32_t)py * s.stride + px, c, gamma[alpha]); }, fillSpan, fillVLine);
+                                      { blendStore(s.row(py) + px, c, gamma[alpha]); }, fillSpan, fillVLine);
             else
                 rasterAARingRoundCore(x0, y0, r, ww, hh, t, [&](int16_t px, int16_t py, uint8_t alpha)
                                       { plotBlendClipGamma(s, c, gamma, px, py, alpha); }, fillSpan, fillVLine);
@@ -977,7 +1094,7 @@ namespace pipgui
 
                 for (int16_t py = py_s; py <= py_e; ++py)
                 {
-                    uint16_t *row = s.buf + (int32_t)py * s.stride;
+                    uint16_t *row = s.row(py);
                     const float dy2 = (float)((ccy - py) * (ccy - py));
 
                     for (int16_t px = px_s; px <= px_e; ++px)
@@ -1044,6 +1161,24 @@ namespace pipgui
                       uint8_t thickness,
                       float startDeg, float endDeg, uint16_t color)
     {
+        if (r <= 0 || !_flags.spriteEnabled ||
+            quickReject((int16_t)(cx - r - 2), (int16_t)(cy - r - 2), (int16_t)(r * 2 + 5), (int16_t)(r * 2 + 5)))
+            return;
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::Arc, (int16_t)(cx - r - 2), (int16_t)(cy - r - 2),
+                                                         (int16_t)(r * 2 + 5), (int16_t)(r * 2 + 5)))
+            {
+                cmd->color = color;
+                cmd->thickness = thickness;
+                cmd->v[0] = cx;
+                cmd->v[1] = cy;
+                cmd->v[2] = r;
+                cmd->deg[0] = startDeg;
+                cmd->deg[1] = endDeg;
+            }
+            return;
+        }
         drawArcShaded(cx, cy, r, thickness, startDeg, endDeg, solidArcColorAtAngle, &color, false, true);
     }
 
@@ -1055,7 +1190,8 @@ namespace pipgui
                             bool needsColorAngle,
                             bool invalidate)
     {
-        if (r <= 0 || !_flags.spriteEnabled || !shader)
+        if (r <= 0 || !_flags.spriteEnabled || !shader ||
+            quickReject((int16_t)(cx - r - 2), (int16_t)(cy - r - 2), (int16_t)(r * 2 + 5), (int16_t)(r * 2 + 5)))
             return;
 
         const float rawSweep = fabsf(endDeg - startDeg);
@@ -0,0 +1,326 @@
+#include "Blend.hpp"
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace pipgui
+{
+    namespace detail
+    {
+        namespace
+        {
+            constexpr uint32_t kLaneLo8 = 0x00FF00FFu;
+            constexpr uint32_t kLane5 = 0x001F001Fu;
+            constexpr uint32_t kLane6 = 0x003F003Fu;
+
+            struct CoverageColor
+            {
+                uint16_t native;
+                uint32_t native32;
+                uint32_t rb;
+                uint32_t g;
+                uint32_t r2;
+                uint32_t g2;
+                uint32_t b2;
+            };
+
+            static inline uint16_t swapPixel(uint16_t v) noexcept
+            {
+                return (uint16_t)((v << 8) | (v >> 8));
+            }
+
+            static inline uint32_t swapPair(uint32_t w) noexcept
+            {
+                return ((w & kLaneLo8) << 8) | ((w >> 8) & kLaneLo8);
+            }
+
+            static inline uint32_t lanePair(uint32_t v) noexcept
+            {
+                return v | (v << 16);
+            }
+
+            // Pixel pairs go through memcpy rather than a uint32_t* so the uint16_t rows are never
+            // aliased; after the one-pixel peel the pair is 4-byte aligned and this is one word access.
+            static inline uint32_t loadPair(const uint16_t *p) noexcept
+            {
+                uint32_t w;
+                memcpy(&w, p, sizeof(w));
+                return w;
+            }
+
+            static inline void storePair(uint16_t *p, uint32_t w) noexcept
+            {
+                memcpy(p, &w, sizeof(w));
+            }
+
+            static inline CoverageColor makeCoverageColor(uint16_t color565) noexcept
+            {
+                const uint16_t native = swapPixel(color565);
+                return {native,
+                        lanePair(native),
+                        ((color565 & 0xF800u) << 5) | (color565 & 0x001Fu),
+                        color565 & 0x07E0u,
+                        lanePair((color565 >> 11) & 0x1Fu),
+                        lanePair((color565 >> 5) & 0x3Fu),
+                        lanePair(color565 & 0x1Fu)};
+            }
+
+            static inline uint16_t coverPixel(uint16_t dst, const CoverageColor &c, uint32_t a) noexcept
+            {
+                const uint16_t bg = swapPixel(dst);
+                const uint32_t inv = 255u - a;
+                const uint32_t bgRb = ((uint32_t)(bg & 0xF800u) << 5) | (bg & 0x001Fu);
+                const uint32_t bgG = bg & 0x07E0u;
+                const uint32_t rb = ((c.rb * a + bgRb * inv) >> 8) & 0x001F001Fu;
+                const uint32_t g = ((c.g * a + bgG * inv) >> 8) & 0x000007E0u;
+                return swapPixel((uint16_t)((rb >> 5) | rb | g));
+            }
+
+            // Two pixels sharing one alpha: every channel gets its own 16-bit lane per pixel, and
+            // 63 * 255 still fits a lane, so one multiply covers both pixels.
+            static inline uint32_t coverPair(uint32_t dst, const CoverageColor &c, uint32_t a) noexcept
+            {
+                const uint32_t bg = swapPair(dst);
+                const uint32_t inv = 255u - a;
+                const uint32_t b = ((c.b2 * a + (bg & kLane5) * inv) >> 8) & kLane5;
+                const uint32_t g = ((c.g2 * a + ((bg >> 5) & kLane6) * inv) >> 8) & kLane6;
+                const uint32_t r = ((c.r2 * a + ((bg >> 11) & kLane5) * inv) >> 8) & kLane5;
+                return swapPair((r << 11) | (g << 5) | b);
+            }
+
+            static inline void coverScalar(uint16_t *dst, const uint8_t *coverage, int32_t n,
+                                           const CoverageColor &c) noexcept
+            {
+                if (n > 0 && ((uintptr_t)dst & 2))
+                {
+                    const uint8_t a = *coverage++;
+                    if (a == 255)
+                        *dst = c.native;
+                    else if (a)
+                        *dst = coverPixel(*dst, c, a);
+                    ++dst;
+                    --n;
+                }
+
+                for (; n >= 2; n -= 2, coverage += 2, dst += 2)
+                {
+                    const uint8_t a0 = coverage[0];
+                    const uint8_t a1 = coverage[1];
+                    if ((a0 | a1) == 0)
+                        continue;
+                    if ((a0 & a1) == 255)
+                    {
+                        storePair(dst, c.native32);
+                        continue;
+                    }
+                    if (a0 == a1)
+                    {
+                        storePair(dst, coverPair(loadPair(dst), c, a0));
+                        continue;
+                    }
+
+                    if (a0 == 255)
+                        dst[0] = c.native;
+                    else if (a0)
+                        dst[0] = coverPixel(dst[0], c, a0);
+                    if (a1 == 255)
+                        dst[1] = c.native;
+                    else if (a1)
+                        dst[1] = coverPixel(dst[1], c, a1);
+                }
+
+                if (n)
+                {
+                    const uint8_t a = *coverage;
+                    if (a == 255)
+                        *dst = c.native;
+                    else if (a)
+                        *dst = coverPixel(*dst, c, a);
+                }
+            }
+
+            static inline uint16_t overPixel(uint16_t dst, uint16_t src, uint32_t a, uint32_t inv) noexcept
+            {
+                const uint16_t bg = swapPixel(dst);
+                const uint16_t fg = swapPixel(src);
+                const uint32_t b = ((fg & 0x1Fu) * a + (bg & 0x1Fu) * inv) >> 8;
+                const uint32_t g = (((fg >> 5) & 0x3Fu) * a + ((bg >> 5) & 0x3Fu) * inv) >> 8;
+                const uint32_t r = ((uint32_t)(fg >> 11) * a + (uint32_t)(bg >> 11) * inv) >> 8;
+                return swapPixel((uint16_t)((r << 11) | (g << 5) | b));
+            }
+
+            static inline uint32_t overPair(uint32_t dst, uint32_t src, uint32_t a, uint32_t inv) noexcept
+            {
+                const uint32_t bg = swapPair(dst);
+                const uint32_t fg = swapPair(src);
+                const uint32_t b = (((fg & kLane5) * a + (bg & kLane5) * inv) >> 8) & kLane5;
+                const uint32_t g = ((((fg >> 5) & kLane6) * a + ((bg >> 5) & kLane6) * inv) >> 8) & kLane6;
+                const uint32_t r = ((((fg >> 11) & kLane5) * a + ((bg >> 11) & kLane5) * inv) >> 8) & kLane5;
+                return swapPair((r << 11) | (g << 5) | b);
+            }
+
+            static inline void overScalar(uint16_t *dst, const uint16_t *src, int32_t n,
+                                          uint32_t a, uint32_t inv) noexcept
+            {
+                if (n > 0 && ((uintptr_t)dst & 2))
+                {
+                    *dst = overPixel(*dst, *src++, a, inv);
+                    ++dst;
+                    --n;
+                }
+
+                for (; n >= 2; n -= 2, src += 2, dst += 2)
+                    storePair(dst, overPair(loadPair(dst), loadPair(src), a, inv));
+
+                if (n)
+                    *dst = overPixel(*dst, *src, a, inv);
+            }
+
+#if defined(__AVX2__)
+            using Vec = __m256i;
+            constexpr int32_t kVecPx = 16;
+
+            static inline Vec vset(uint16_t v) noexcept { return _mm256_set1_epi16((short)v); }
+            static inline Vec vload(const uint16_t *p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+            static inline void vstore(uint16_t *p, Vec v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+            static inline Vec vloadCoverage(const uint8_t *p) noexcept { return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))); }
+            static inline Vec vand(Vec a, Vec b) noexcept { return _mm256_and_si256(a, b); }
+            static inline Vec vor(Vec a, Vec b) noexcept { return _mm256_or_si256(a, b); }
+            static inline Vec vandnot(Vec mask, Vec b) noexcept { return _mm256_andnot_si256(mask, b); }
+            static inline Vec vadd(Vec a, Vec b) noexcept { return _mm256_add_epi16(a, b); }
+            static inline Vec vsub(Vec a, Vec b) noexcept { return _mm256_sub_epi16(a, b); }
+            static inline Vec vmul(Vec a, Vec b) noexcept { return _mm256_mullo_epi16(a, b); }
+            static inline Vec veq(Vec a, Vec b) noexcept { return _mm256_cmpeq_epi16(a, b); }
+            template <int S> static inline Vec vshl(Vec a) noexcept { return _mm256_slli_epi16(a, S); }
+            template <int S> static inline Vec vshr(Vec a) noexcept { return _mm256_srli_epi16(a, S); }
+#elif defined(__SSE2__)
+            using Vec = __m128i;
+            constexpr int32_t kVecPx = 8;
+
+            static inline Vec vset(uint16_t v) noexcept { return _mm_set1_epi16((short)v); }
+            static inline Vec vload(const uint16_t *p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+            static inline void vstore(uint16_t *p, Vec v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+            static inline Vec vloadCoverage(const uint8_t *p) noexcept { return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p)), _mm_setzero_si128()); }
+            static inline Vec vand(Vec a, Vec b) noexcept { return _mm_and_si128(a, b); }
+            static inline Vec vor(Vec a, Vec b) noexcept { return _mm_or_si128(a, b); }
+            static inline Vec vandnot(Vec mask, Vec b) noexcept { return _mm_andnot_si128(mask, b); }
+            static inline Vec vadd(Vec a, Vec b) noexcept { return _mm_add_epi16(a, b); }
+            static inline Vec vsub(Vec a, Vec b) noexcept { return _mm_sub_epi16(a, b); }
+            static inline Vec vmul(Vec a, Vec b) noexcept { return _mm_mullo_epi16(a, b); }
+            static inline Vec veq(Vec a, Vec b) noexcept { return _mm_cmpeq_epi16(a, b); }
+            template <int S> static inline Vec vshl(Vec a) noexcept { return _mm_slli_epi16(a, S); }
+            template <int S> static inline Vec vshr(Vec a) noexcept { return _mm_srli_epi16(a, S); }
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__)
+            static inline Vec vswap(Vec v) noexcept
+            {
+                return vor(vshl<8>(v), vshr<8>(v));
+            }
+
+            static inline Vec vblend(Vec fgB, Vec fgG, Vec fgR, Vec bg, Vec a, Vec inv) noexcept
+            {
+                const Vec m5 = vset(0x1F);
+                const Vec m6 = vset(0x3F);
+                const Vec b = vshr<8>(vadd(vmul(fgB, a), vmul(vand(bg, m5), inv)));
+                const Vec g = vshr<8>(vadd(vmul(fgG, a), vmul(vand(vshr<5>(bg), m6), inv)));
+                const Vec r = vshr<8>(vadd(vmul(fgR, a), vmul(vshr<11>(bg), inv)));
+                return vor(vor(vshl<11>(r), vshl<5>(g)), b);
+            }
+
+            static inline bool coverageIs(const uint8_t *p, uint8_t v) noexcept
+            {
+                uint64_t lanes[kVecPx / 8];
+                memcpy(lanes, p, sizeof(lanes));
+                const uint64_t want = v ? ~0ull : 0ull;
+                for (uint64_t lane : lanes)
+                {
+                    if (lane != want)
+                        return false;
+                }
+                return true;
+            }
+#endif
+        }
+
+        void blendCoverageSpan565(uint16_t *dst, const uint8_t *coverage, int32_t n, uint16_t color565) noexcept
+        {
+            if (!dst || !coverage || n <= 0)
+                return;
+
+            const CoverageColor c = makeCoverageColor(color565);
+
+#if defined(__AVX2__) || defined(__SSE2__)
+            if (n >= kVecPx)
+            {
+                const Vec zero = vset(0);
+                const Vec k255 = vset(255);
+                const Vec fgN = vset(c.native);
+                const Vec fgB = vset(color565 & 0x1Fu);
+                const Vec fgG = vset((color565 >> 5) & 0x3Fu);
+                const Vec fgR = vset(color565 >> 11);
+                for (; n >= kVecPx; n -= kVecPx, dst += kVecPx, coverage += kVecPx)
+                {
+                    if (coverageIs(coverage, 0))
+                        continue;
+                    if (coverageIs(coverage, 255))
+                    {
+                        vstore(dst, fgN);
+                        continue;
+                    }
+
+                    const Vec a = vloadCoverage(coverage);
+                    const Vec d = vload(dst);
+                    Vec out = vswap(vblend(fgB, fgG, fgR, vswap(d), a, vsub(k255, a)));
+                    const Vec full = veq(a, k255);
+                    const Vec none = veq(a, zero);
+                    out = vor(vand(full, fgN), vandnot(full, out));
+                    out = vor(vand(none, d), vandnot(none, out));
+                    vstore(dst, out);
+                }
+            }
+#endif
+
+            coverScalar(dst, coverage, n, c);
+        }
+
+        void blendSpan565(uint16_t *dst, const uint16_t *src, int32_t n, uint8_t alpha) noexcept
+        {
+            if (!dst || !src || n <= 0 || alpha == 0)
+                return;
+            if (alpha == 255)
+            {
+                memmove(dst, src, (size_t)n * sizeof(uint16_t));
+                return;
+            }
+
+            const uint32_t a = alpha + (alpha >> 7);
+            const uint32_t inv = 256u - a;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+            if (n >= kVecPx)
+            {
+                const Vec aV = vset((uint16_t)a);
+                const Vec invV = vset((uint16_t)inv);
+                const Vec m5 = vset(0x1F);
+                const Vec m6 = vset(0x3F);
+                for (; n >= kVecPx; n -= kVecPx, dst += kVecPx, src += kVecPx)
+                {
+                    const Vec fg = vswap(vload(src));
+                    const Vec out = vblend(vand(fg, m5),
+                                           vand(vshr<5>(fg), m6),
+                                           vshr<11>(fg),
+                                           vswap(vload(dst)), aV, invV);
+                    vstore(dst, vswap(out));
+                }
+            }
+#endif
+
+            overScalar(dst, src, n, a, inv);
+        }
+    }
+}
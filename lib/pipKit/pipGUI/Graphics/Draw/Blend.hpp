@@ -24,6 +24,12 @@ namespace pipgui
             240, 241, 241, 242, 242, 243, 243, 244, 244, 245, 245, 246, 246, 247, 247, 248,
             248, 249, 249, 249, 250, 250, 251, 251, 252, 252, 253, 253, 254, 254, 255, 255,
         };
+
+        // Span kernels over sprite rows in native (byte-swapped) order. Both match the per-pixel
+        // paths bit for bit: coverage blends as (fg * a + bg * (255 - a)) >> 8 like the text and
+        // icon renderers, span-over blends like detail::blend565.
+        void blendCoverageSpan565(uint16_t *dst, const uint8_t *coverage, int32_t n, uint16_t color565) noexcept;
+        void blendSpan565(uint16_t *dst, const uint16_t *src, int32_t n, uint8_t alpha) noexcept;
     }
 
     inline uint32_t isqrt32(uint32_t n) noexcept
@@ -6,7 +6,10 @@ namespace pipgui
 
     namespace
     {
-        constexpr int16_t kDirtyMergeGapPx = 5;
+        // One CASET/RASET/RAMWR transaction, in pixels of SPI time.
+        constexpr int32_t kDirtyRectSetupPx = 160;
+        constexpr int32_t kDirtyRectCostMaxPx = 320 * 240;
+        constexpr float kDirtyCostDecay = 0.95f;
 
         struct RectBounds
         {
@@ -31,15 +34,6 @@ namespace pipgui
             return static_cast<int32_t>(rect.w) * rect.h;
         }
 
-        static inline int32_t intervalGap(int32_t a1, int32_t a2, int32_t b1, int32_t b2)
-        {
-            if (a2 < b1)
-                return b1 - a2;
-            if (b2 < a1)
-                return a1 - b2;
-            return 0;
-        }
-
         static inline bool containsDirtyRect(const detail::DirtyRect &outer, const detail::DirtyRect &inner)
         {
             const RectBounds outerBounds = getRectBounds(outer);
@@ -64,74 +58,92 @@ namespace pipgui
             };
         }
 
-        static inline bool shouldMergeDirtyRects(const detail::DirtyRect &a, const detail::DirtyRect &b)
+        static inline bool overlapDirtyRects(const detail::DirtyRect &a, const detail::DirtyRect &b)
         {
             const RectBounds aBounds = getRectBounds(a);
             const RectBounds bBounds = getRectBounds(b);
-            const int32_t gapX = intervalGap(aBounds.x1, aBounds.x2, bBounds.x1, bBounds.x2);
-            const int32_t gapY = intervalGap(aBounds.y1, aBounds.y2, bBounds.y1, bBounds.y2);
+            return aBounds.x1 < bBounds.x2 && bBounds.x1 < aBounds.x2 &&
+                   aBounds.y1 < bBounds.y2 && bBounds.y1 < aBounds.y2;
+        }
 
-            if (gapX == 0 && gapY == 0)
-                return true;
+        // Every rect costs one present transaction plus one clipped screen pass (cost.rectCostPx);
+        // a union pays off when its extra pixels are cheaper.
+        static inline int32_t mergePenalty(const detail::DirtyState &dirty,
+                                           const detail::DirtyRect &a, const detail::DirtyRect &b)
+        {
+            return rectArea(unionDirtyRects(a, b)) - rectArea(a) - rectArea(b) - dirty.cost.rectCostPx;
+        }
 
-            return (gapX <= kDirtyMergeGapPx && gapY == 0) ||
-                   (gapY <= kDirtyMergeGapPx && gapX == 0);
+        static inline void removeDirtyRect(detail::DirtyState &dirty, uint8_t index)
+        {
+            dirty.rects[index] = dirty.rects[--dirty.count];
         }
 
-        static void compactDirtyRects(detail::DirtyState &dirty)
+        static detail::DirtyRect absorbDirtyRects(detail::DirtyState &dirty, detail::DirtyRect rect)
         {
-            bool merged = false;
-            do
+            uint8_t i = 0;
+            while (i < dirty.count)
             {
-                merged = false;
-                for (uint8_t i = 0; i < dirty.count && !merged; ++i)
+                // Overlapping rects are always merged so no pixel is drawn twice.
+                if (!overlapDirtyRects(dirty.rects[i], rect) && mergePenalty(dirty, dirty.rects[i], rect) > 0)
                 {
-                    for (uint8_t j = i + 1; j < dirty.count; ++j)
-                    {
-                        if (containsDirtyRect(dirty.rects[i], dirty.rects[j]))
-                        {
-                            dirty.rects[j] = dirty.rects[--dirty.count];
-                            merged = true;
-                            break;
-                        }
-
-                        if (containsDirtyRect(dirty.rects[j], dirty.rects[i]))
-                        {
-                            dirty.rects[i] = dirty.rects[j];
-                            dirty.rects[j] = dirty.rects[--dirty.count];
-                            merged = true;
-                            break;
-                        }
-
-                        if (!shouldMergeDirtyRects(dirty.rects[i], dirty.rects[j]))
-                            continue;
-
-                        dirty.rects[i] = unionDirtyRects(dirty.rects[i], dirty.rects[j]);
-                        dirty.rects[j] = dirty.rects[--dirty.count];
-                        merged = true;
-                        break;
-                    }
+                    ++i;
+                    continue;
                 }
-            } while (merged);
+                rect = unionDirtyRects(dirty.rects[i], rect);
+                removeDirtyRect(dirty, i);
+                i = 0;
+            }
+            return rect;
         }
 
-        static uint8_t findBestDirtyMergeTarget(const detail::DirtyState &dirty, const detail::DirtyRect &rect)
+        static void insertDirtyRect(detail::DirtyState &dirty, const detail::DirtyRect &rect)
         {
-            uint8_t bestIndex = 0;
-            int32_t bestCost = 0x7FFFFFFF;
+            const detail::DirtyRect merged = absorbDirtyRects(dirty, rect);
+            if (dirty.count < detail::DIRTY_RECT_MAX)
+            {
+                dirty.rects[dirty.count++] = merged;
+                return;
+            }
 
+            uint8_t bestA = 0;
+            uint8_t bestB = detail::DIRTY_RECT_MAX;
+            int32_t bestPenalty = 0x7FFFFFFF;
             for (uint8_t i = 0; i < dirty.count; ++i)
             {
-                const detail::DirtyRect merged = unionDirtyRects(dirty.rects[i], rect);
-                const int32_t cost = rectArea(merged) - rectArea(dirty.rects[i]);
-                if (cost < bestCost)
+                const int32_t penalty = mergePenalty(dirty, dirty.rects[i], merged);
+                if (penalty < bestPenalty)
                 {
-                    bestCost = cost;
-                    bestIndex = i;
+                    bestPenalty = penalty;
+                    bestA = i;
+                    bestB = detail::DIRTY_RECT_MAX;
                 }
+                for (uint8_t j = i + 1; j < dirty.count; ++j)
+                {
+                    const int32_t pairPenalty = mergePenalty(dirty, dirty.rects[i], dirty.rects[j]);
+                    if (pairPenalty < bestPenalty)
+                    {
+                        bestPenalty = pairPenalty;
+                        bestA = i;
+                        bestB = j;
+                    }
+                }
+            }
+
+            if (bestB < detail::DIRTY_RECT_MAX)
+            {
+                // The pair's union can reach into other rects; absorb them before re-adding both.
+                const detail::DirtyRect pair = unionDirtyRects(dirty.rects[bestA], dirty.rects[bestB]);
+                removeDirtyRect(dirty, bestB);
+                removeDirtyRect(dirty, bestA);
+                dirty.rects[dirty.count++] = absorbDirtyRects(dirty, pair);
+                dirty.rects[dirty.count++] = absorbDirtyRects(dirty, merged);
+                return;
             }
 
-            return bestIndex;
+            const detail::DirtyRect grown = unionDirtyRects(dirty.rects[bestA], merged);
+            removeDirtyRect(dirty, bestA);
+            dirty.rects[dirty.count++] = absorbDirtyRects(dirty, grown);
         }
     }
 
@@ -170,12 +182,24 @@ namespace pipgui
 
     pipcore::Sprite *GUI::getDrawTarget()
     {
+        if (_displayList.recording)
+        {
+            _displayList.unsupported = true;
+            return nullptr;
+        }
+
         pipcore::Sprite *spr = (_flags.inSpritePass && _flags.spriteEnabled)
                                    ? (_render.activeSprite ? _render.activeSprite : &_render.sprite)
                                    : &_render.sprite;
         if (!spr)
             return nullptr;
 
+        if (spr == &_render.sprite && spr->banded() && !_flags.bandPass)
+        {
+            applyClipState(spr, true, 0, 0, 0, 0);
+            return spr;
+        }
+
         const int16_t baseW = (int16_t)std::min<int32_t>(_render.screenWidth, spr->width());
         const int16_t baseH = (int16_t)std::min<int32_t>(_render.screenHeight, spr->height());
 
@@ -237,6 +261,48 @@ namespace pipgui
         _clip.h = 0;
     }
 
+    bool GUI::pushClip(int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+        detail::ClipStack &st = _clipStack;
+        if (st.depth >= detail::CLIP_STACK_DEPTH)
+        {
+            // Nothing is left to restore from, so the clip stays as it is and the matching pop
+            // only unwinds the count.
+            if (st.overflow < 0xFF)
+                ++st.overflow;
+            return false;
+        }
+        st.saved[st.depth++] = _clip;
+        applyClip(x, y, w, h);
+        return true;
+    }
+
+    void GUI::popClip()
+    {
+        detail::ClipStack &st = _clipStack;
+        if (st.overflow)
+        {
+            --st.overflow;
+            return;
+        }
+        if (st.depth)
+            _clip = st.saved[--st.depth];
+    }
+
+    bool GUI::quickReject(int16_t x, int16_t y, int16_t w, int16_t h) const noexcept
+    {
+        if (w <= 0 || h <= 0)
+            return true;
+        const int32_t x1 = (int32_t)x + w;
+        const int32_t y1 = (int32_t)y + h;
+        if (x1 <= 0 || y1 <= 0 || x >= _render.screenWidth || y >= _render.screenHeight)
+            return true;
+        if (!_clip.enabled)
+            return false;
+        return x1 <= _clip.x || y1 <= _clip.y ||
+               x >= (int32_t)_clip.x + _clip.w || y >= (int32_t)_clip.y + _clip.h;
+    }
+
     int16_t GUI::AutoX(int32_t contentWidth) const
     {
         int16_t availW = _render.screenWidth;
@@ -264,6 +330,14 @@ namespace pipgui
         if (!_flags.spriteEnabled)
             return;
 
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::Clear, 0, 0,
+                                                         (int16_t)_render.screenWidth, (int16_t)_render.screenHeight))
+                cmd->color = color;
+            return;
+        }
+
         pipcore::Sprite *spr = getDrawTarget();
         if (!spr || !spr->getBuffer())
             return;
@@ -287,7 +361,7 @@ namespace pipgui
 
     void GUI::invalidateRect(int16_t x, int16_t y, int16_t w, int16_t h)
     {
-        if (!_disp.display || !_flags.spriteEnabled || w <= 0 || h <= 0)
+        if (!_disp.display || !_flags.spriteEnabled || _flags.bandPass || w <= 0 || h <= 0)
             return;
 
         int32_t x2 = static_cast<int32_t>(x) + w;
@@ -307,6 +381,9 @@ namespace pipgui
         if (w <= 0 || h <= 0)
             return;
 
+        if (!_blurCache.hold)
+            markBlurCacheDirty(x, y, w, h);
+
         if (logicalRotationActive() && !_flags.inSpritePass)
         {
             _flags.needRedraw = 1;
@@ -321,21 +398,45 @@ namespace pipgui
                 return;
         }
 
-        if (_dirty.count < DIRTY_RECT_MAX)
-        {
-            _dirty.rects[_dirty.count++] = rect;
-            compactDirtyRects(_dirty);
+        insertDirtyRect(_dirty, rect);
+    }
+
+    void GUI::recordDirtyPassCost(uint32_t pixels, uint32_t us) noexcept
+    {
+        detail::DirtyCostModel &m = _dirty.cost;
+        const float x = (float)pixels;
+        const float y = (float)us;
+        m.weight = m.weight * kDirtyCostDecay + 1.0f;
+        m.sumPx = m.sumPx * kDirtyCostDecay + x;
+        m.sumUs = m.sumUs * kDirtyCostDecay + y;
+        m.sumPxPx = m.sumPxPx * kDirtyCostDecay + x * x;
+        m.sumPxUs = m.sumPxUs * kDirtyCostDecay + x * y;
+
+        // Passes of one size only say nothing about the fixed part; keep the last estimate.
+        const float det = m.weight * m.sumPxPx - m.sumPx * m.sumPx;
+        if (m.weight < 4.0f || det <= m.weight * m.sumPxPx * 1e-3f)
             return;
-        }
+        const float usPerPx = (m.weight * m.sumPxUs - m.sumPx * m.sumUs) / det;
+        const float fixedUs = (m.sumUs - usPerPx * m.sumPx) / m.weight;
+        const float pixelUs = usPerPx + m.presentUsPerPx;
+        if (usPerPx <= 0.0f || fixedUs <= 0.0f)
+            return;
+        const float costPx = (float)kDirtyRectSetupPx + fixedUs / pixelUs;
+        m.rectCostPx = (costPx < (float)kDirtyRectCostMaxPx) ? (int32_t)costPx : kDirtyRectCostMaxPx;
+    }
 
-        const uint8_t bestIndex = findBestDirtyMergeTarget(_dirty, rect);
-        _dirty.rects[bestIndex] = unionDirtyRects(_dirty.rects[bestIndex], rect);
-        compactDirtyRects(_dirty);
+    void GUI::recordPresentCost(uint32_t pixels, uint32_t us) noexcept
+    {
+        if (pixels == 0)
+            return;
+        detail::DirtyCostModel &m = _dirty.cost;
+        const float usPerPx = (float)us / (float)pixels;
+        m.presentUsPerPx = (m.presentUsPerPx > 0.0f) ? m.presentUsPerPx + (usPerPx - m.presentUsPerPx) * 0.125f : usPerPx;
     }
 
     void GUI::flushDirty()
     {
-        if (_dirty.count == 0)
+        if (_dirty.count == 0 || _flags.bandPass)
             return;
         if (_flags.screenTransition || _rotationAnim.active || _flags.errorActive || _flags.notifActive || _flags.toastActive)
         {
@@ -350,11 +451,12 @@ namespace pipgui
             return;
         }
 
+        DebugProbe probe(DebugPhase::Present);
         const int16_t sw = _render.sprite.width();
         const int16_t sh = _render.sprite.height();
         uint16_t *buf = (uint16_t *)_render.sprite.getBuffer();
         const int32_t stride = sw;
-        const bool debugDirty = Debug::dirtyRectEnabled();
+        const bool debugDirty = Debug::dirtyRectEnabled() && !_render.sprite.banded();
 
         if (logicalRotationActive())
         {
@@ -409,6 +511,10 @@ namespace pipgui
             }
         }
 
+        const bool batch = !_present.async;
+        if (batch)
+            _disp.display->beginBatch();
+
         for (uint8_t i = 0; i < _dirty.count; ++i)
         {
             int16_t x0 = 0;
@@ -424,6 +530,9 @@ namespace pipgui
             presentSprite(x0, y0, w, h, "present");
         }
 
+        if (batch)
+            _disp.display->endBatch();
+
         _dirty.count = 0;
 
         Debug::clearRects();
@@ -9,9 +9,46 @@ namespace pipgui
 {
     namespace
     {
-        static inline uint16_t quantize565Swapped(Color888 color, int16_t x, int16_t y)
+        constexpr uint8_t kDitherPeriod = 32;
+
+        // Blue-noise thresholds of one sprite row, pre-rotated per channel so every channel is
+        // indexed by x & 31 and stored as 255 - thr: quantize565 rounds up exactly when
+        // (c << bits) + (255 - thr) carries into bit 8.
+        struct DitherRow
+        {
+            uint8_t r[kDitherPeriod];
+            uint8_t g[kDitherPeriod];
+            uint8_t b[kDitherPeriod];
+        };
+
+        static inline void loadDitherRow(DitherRow &row, int16_t py)
         {
-            return pipcore::Sprite::swap16(detail::quantize565(color, x, y));
+            const uint8_t *nr = detail::blueNoiseLut32x32 + ((uint16_t)(py & 31) << 5);
+            const uint8_t *ng = detail::blueNoiseLut32x32 + ((uint16_t)((py + 7) & 31) << 5);
+            const uint8_t *nb = detail::blueNoiseLut32x32 + ((uint16_t)((py + 3) & 31) << 5);
+            for (uint8_t i = 0; i < kDitherPeriod; ++i)
+            {
+                row.r[i] = (uint8_t)(255U - nr[i]);
+                row.g[i] = (uint8_t)(255U - ng[(i + 5) & 31]);
+                row.b[i] = (uint8_t)(255U - nb[(i + 11) & 31]);
+            }
+        }
+
+        static inline uint16_t ditherPixel(uint8_t r, uint8_t g, uint8_t b, const DitherRow &row, uint8_t idx)
+        {
+            uint32_t r5 = ((uint32_t)r * 32U + row.r[idx]) >> 8;
+            uint32_t g6 = ((uint32_t)g * 64U + row.g[idx]) >> 8;
+            uint32_t b5 = ((uint32_t)b * 32U + row.b[idx]) >> 8;
+            r5 -= r5 >> 5;
+            g6 -= g6 >> 6;
+            b5 -= b5 >> 5;
+            return pipcore::Sprite::swap16((uint16_t)((r5 << 11) | (g6 << 5) | b5));
+        }
+
+        static inline void buildPattern32(uint16_t *pattern, Color888 c, const DitherRow &row)
+        {
+            for (uint8_t idx = 0; idx < kDitherPeriod; ++idx)
+                pattern[idx] = ditherPixel(c.r, c.g, c.b, row, idx);
         }
 
         static inline void fillPattern32(uint16_t *dst, int16_t x, int16_t count, const uint16_t *pattern)
@@ -46,7 +83,7 @@ namespace pipgui
         if (y == -1)
             y = AutoY(h);
 
-        if (w <= 0 || h <= 0 || !_flags.spriteEnabled)
+        if (!_flags.spriteEnabled || quickReject(x, y, w, h))
             return;
 
         auto spr = getDrawTarget();
@@ -57,6 +94,7 @@ namespace pipgui
             return;
 
         const int16_t stride = spr->width();
+        const int16_t bufY = spr->bufferY();
         int32_t clipX = 0, clipY = 0, clipW = stride, clipH = spr->height();
         spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
 
@@ -80,14 +118,26 @@ namespace pipgui
         int32_t cg = (g1 << 16) + dg * doff;
         int32_t cb = (b1 << 16) + db * doff;
 
+        // A row only depends on its color and py & 31, so a row repeating the color from 32 rows
+        // above is copied instead of re-dithered.
+        const size_t rowBytes = sizeof(uint16_t) * (size_t)(x1 - x0);
+        Color888 rowColor[kDitherPeriod];
+        DitherRow dither;
+        uint16_t pattern[kDitherPeriod];
         for (int16_t py = y0; py < y1; ++py, cr += dr, cg += dg, cb += db)
         {
             const Color888 c888 = {(uint8_t)(cr >> 16), (uint8_t)(cg >> 16), (uint8_t)(cb >> 16)};
-            uint16_t pattern[32];
-            for (uint8_t idx = 0; idx < 32; ++idx)
-                pattern[idx] = quantize565Swapped(c888, idx, py);
+            uint16_t *dst = buf + (py - bufY) * stride + x0;
+            Color888 &prev = rowColor[py & 31];
+            if (py - y0 >= kDitherPeriod && prev.r == c888.r && prev.g == c888.g && prev.b == c888.b)
+            {
+                std::memcpy(dst, dst - kDitherPeriod * stride, rowBytes);
+                continue;
+            }
+            prev = c888;
 
-            uint16_t *dst = buf + py * stride + x0;
+            loadDitherRow(dither, py);
+            buildPattern32(pattern, c888, dither);
             fillPattern32(dst, x0, (int16_t)(x1 - x0), pattern);
         }
 
@@ -102,7 +152,7 @@ namespace pipgui
         if (y == -1)
             y = AutoY(h);
 
-        if (w <= 0 || h <= 0 || !_flags.spriteEnabled)
+        if (!_flags.spriteEnabled || quickReject(x, y, w, h))
             return;
 
         auto spr = getDrawTarget();
@@ -113,6 +163,7 @@ namespace pipgui
             return;
 
         const int16_t stride = spr->width();
+        const int16_t bufY = spr->bufferY();
         int32_t clipX = 0, clipY = 0, clipW = stride, clipH = spr->height();
         spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
 
@@ -135,15 +186,23 @@ namespace pipgui
         const int32_t cg0 = (g1 << 16) + dg * (x0 - x);
         const int32_t cb0 = (b1 << 16) + db * (x0 - x);
 
-        for (int16_t py = y0; py < y1; ++py)
+        // Every row has the same colors, so the dither repeats every 32 rows: only the first 32
+        // rows are quantized and the rest are copies.
+        const size_t rowBytes = sizeof(uint16_t) * (size_t)(x1 - x0);
+        const int16_t ditherEnd = (int16_t)std::min<int32_t>(y1, (int32_t)y0 + kDitherPeriod);
+        DitherRow dither;
+        for (int16_t py = y0; py < ditherEnd; ++py)
         {
-            uint16_t *dst = buf + py * stride + x0;
+            loadDitherRow(dither, py);
+            uint16_t *dst = buf + (py - bufY) * stride + x0;
             int32_t cr = cr0, cg = cg0, cb = cb0;
             for (int16_t px = x0; px < x1; ++px, ++dst, cr += dr, cg += dg, cb += db)
-            {
-                const Color888 c = {(uint8_t)(cr >> 16), (uint8_t)(cg >> 16), (uint8_t)(cb >> 16)};
-                *dst = quantize565Swapped(c, px, py);
-            }
+                *dst = ditherPixel((uint8_t)(cr >> 16), (uint8_t)(cg >> 16), (uint8_t)(cb >> 16), dither, (uint8_t)(px & 31));
+        }
+        for (int16_t py = ditherEnd; py < y1; ++py)
+        {
+            uint16_t *dst = buf + (py - bufY) * stride + x0;
+            std::memcpy(dst, dst - kDitherPeriod * stride, rowBytes);
         }
 
         if (_disp.display && _flags.spriteEnabled && !_flags.inSpritePass)
@@ -157,7 +216,7 @@ namespace pipgui
         if (y == -1)
             y = AutoY(h);
 
-        if (w <= 0 || h <= 0 || !_flags.spriteEnabled)
+        if (!_flags.spriteEnabled || quickReject(x, y, w, h))
             return;
 
         auto spr = getDrawTarget();
@@ -168,6 +227,7 @@ namespace pipgui
             return;
 
         const int16_t stride = spr->width();
+        const int16_t bufY = spr->bufferY();
         int32_t clipX = 0, clipY = 0, clipW = stride, clipH = spr->height();
         spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
 
@@ -178,6 +238,17 @@ namespace pipgui
         if (x0 >= x1 || y0 >= y1)
             return;
 
+        if (c00 == c10 && c01 == c11)
+        {
+            fillRectGradientVertical(x, y, w, h, c00, c01);
+            return;
+        }
+        if (c00 == c01 && c10 == c11)
+        {
+            fillRectGradientHorizontal(x, y, w, h, c00, c10);
+            return;
+        }
+
         const int32_t r00 = (c00 >> 16) & 0xFF, g00 = (c00 >> 8) & 0xFF, b00 = c00 & 0xFF;
         const int32_t r10 = (c10 >> 16) & 0xFF, g10 = (c10 >> 8) & 0xFF, b10 = c10 & 0xFF;
         const int32_t r01 = (c01 >> 16) & 0xFF, g01 = (c01 >> 8) & 0xFF, b01 = c01 & 0xFF;
@@ -194,8 +265,10 @@ namespace pipgui
         int32_t crL = (r00 << 16) + drL * dy, cgL = (g00 << 16) + dgL * dy, cbL = (b00 << 16) + dbL * dy;
         int32_t crR = (r10 << 16) + drR * dy, cgR = (g10 << 16) + dgR * dy, cbR = (b10 << 16) + dbR * dy;
 
+        DitherRow dither;
         for (int16_t py = y0; py < y1; ++py)
         {
+            loadDitherRow(dither, py);
             const int32_t dr_row = (crR - crL) / divX;
             const int32_t dg_row = (cgR - cgL) / divX;
             const int32_t db_row = (cbR - cbL) / divX;
@@ -204,12 +277,9 @@ namespace pipgui
             int32_t cg = cgL + dg_row * dx;
             int32_t cb = cbL + db_row * dx;
 
-            uint16_t *dst = buf + py * stride + x0;
+            uint16_t *dst = buf + (py - bufY) * stride + x0;
             for (int16_t px = x0; px < x1; ++px, ++dst, cr += dr_row, cg += dg_row, cb += db_row)
-            {
-                const Color888 c888 = {(uint8_t)(cr >> 16), (uint8_t)(cg >> 16), (uint8_t)(cb >> 16)};
-                *dst = quantize565Swapped(c888, px, py);
-            }
+                *dst = ditherPixel((uint8_t)(cr >> 16), (uint8_t)(cg >> 16), (uint8_t)(cb >> 16), dither, (uint8_t)(px & 31));
 
             crL += drL;
             cgL += dgL;
@@ -230,7 +300,7 @@ namespace pipgui
         if (y == -1)
             y = AutoY(h);
 
-        if (w <= 0 || h <= 0 || !_flags.spriteEnabled)
+        if (!_flags.spriteEnabled || quickReject(x, y, w, h))
             return;
 
         auto spr = getDrawTarget();
@@ -241,6 +311,7 @@ namespace pipgui
             return;
 
         const int16_t stride = spr->width();
+        const int16_t bufY = spr->bufferY();
         int32_t clipX = 0, clipY = 0, clipW = stride, clipH = spr->height();
         spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
 
@@ -264,15 +335,14 @@ namespace pipgui
         int32_t rg0 = (g1 << 16) + dg * base;
         int32_t rb0 = (b1 << 16) + db * base;
 
+        DitherRow dither;
         for (int16_t py = y0; py < y1; ++py, rr0 += dr, rg0 += dg, rb0 += db)
         {
-            uint16_t *dst = buf + py * stride + x0;
+            loadDitherRow(dither, py);
+            uint16_t *dst = buf + (py - bufY) * stride + x0;
             int32_t cr = rr0, cg = rg0, cb = rb0;
             for (int16_t px = x0; px < x1; ++px, ++dst, cr += dr, cg += dg, cb += db)
-            {
-                const Color888 c888 = {(uint8_t)(cr >> 16), (uint8_t)(cg >> 16), (uint8_t)(cb >> 16)};
-                *dst = quantize565Swapped(c888, px, py);
-            }
+                *dst = ditherPixel((uint8_t)(cr >> 16), (uint8_t)(cg >> 16), (uint8_t)(cb >> 16), dither, (uint8_t)(px & 31));
         }
 
         if (_disp.display && _flags.spriteEnabled && !_flags.inSpritePass)
@@ -286,7 +356,7 @@ namespace pipgui
         if (y == -1)
             y = AutoY(h);
 
-        if (w <= 0 || h <= 0 || !_flags.spriteEnabled)
+        if (!_flags.spriteEnabled || quickReject(x, y, w, h))
             return;
 
         auto spr = getDrawTarget();
@@ -297,6 +367,7 @@ namespace pipgui
             return;
 
         const int16_t stride = spr->width();
+        const int16_t bufY = spr->bufferY();
         int32_t clipX = 0, clipY = 0, clipW = stride, clipH = spr->height();
         spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
 
@@ -314,48 +385,47 @@ namespace pipgui
         const int32_t dr = (int32_t)((outerColor >> 16) & 0xFF) - ri;
         const int32_t dg = (int32_t)((outerColor >> 8) & 0xFF) - gi;
         const int32_t db = (int32_t)(outerColor & 0xFF) - bi;
-        const Color888 outer888 = {
-            (uint8_t)((outerColor >> 16) & 0xFF),
-            (uint8_t)((outerColor >> 8) & 0xFF),
-            (uint8_t)(outerColor & 0xFF)};
 
-        const int32_t r256 = radius;
-        const int32_t radiusSq = r256 * r256;
+        Color888 ramp[257];
+        for (int32_t t = 0; t <= 256; ++t)
+            ramp[t] = {(uint8_t)(ri + ((dr * t) >> 8)), (uint8_t)(gi + ((dg * t) >> 8)), (uint8_t)(bi + ((db * t) >> 8))};
+        const Color888 outer888 = ramp[256];
 
+        const int32_t radiusSq = (int32_t)radius * radius;
+
+        DitherRow dither;
+        uint16_t outerPattern[kDitherPeriod];
         for (int16_t py = y0; py < y1; ++py)
         {
             const int32_t ddy = (int32_t)(py - cy);
             const int32_t dy2 = ddy * ddy;
-            uint16_t *dst = buf + py * stride + x0;
+            uint16_t *dst = buf + (py - bufY) * stride + x0;
             int32_t ddx = (int32_t)(x0 - cx);
             int32_t d2 = ddx * ddx + dy2;
             int32_t dStep = ddx * 2 + 1;
-            uint16_t outerPattern[32];
-            for (uint8_t idx = 0; idx < 32; ++idx)
-                outerPattern[idx] = quantize565Swapped(outer888, idx, py);
+            loadDitherRow(dither, py);
+            buildPattern32(outerPattern, outer888, dither);
 
+            // d2 falls then rises along the row, so the integer distance is tracked in small
+            // steps after one isqrt on entering the disc.
+            int32_t dist = -1;
             for (int16_t px = x0; px < x1; ++px, ++dst)
             {
-                int32_t t;
-                if (d2 == 0)
-                {
-                    t = 0;
-                }
-                else if (d2 >= radiusSq)
+                if (d2 >= radiusSq)
                 {
-                    t = 256;
+                    *dst = outerPattern[px & 31];
                 }
                 else
                 {
-                    const int32_t dist = (int32_t)isqrt32((uint32_t)d2);
-                    t = (dist << 8) / r256;
+                    if (dist < 0)
+                        dist = (int32_t)isqrt32((uint32_t)d2);
+                    while (dist * dist > d2)
+                        --dist;
+                    while ((dist + 1) * (dist + 1) <= d2)
+                        ++dist;
+                    const Color888 &c = ramp[(dist << 8) / radius];
+                    *dst = ditherPixel(c.r, c.g, c.b, dither, (uint8_t)(px & 31));
                 }
-
-                const Color888 c888 = {
-                    (uint8_t)(ri + ((dr * t) >> 8)),
-                    (uint8_t)(gi + ((dg * t) >> 8)),
-                    (uint8_t)(bi + ((db * t) >> 8))};
-                *dst = quantize565Swapped(c888, px, py);
                 d2 += dStep;
                 dStep += 2;
 
@@ -4,6 +4,7 @@
 #include <pipCore/Graphics/Sprite.hpp>
 #include <math.h>
 #include "Blend.hpp"
+#include "ShapeMask.hpp"
 
 namespace pipgui
 {
@@ -43,6 +44,10 @@ namespace pipgui
         int32_t clipY;
         int32_t clipR;
         int32_t clipB;
+        int32_t bufY = 0;
+
+        // buf starts at row bufY: a band or hot-row sprite holds only part of the screen.
+        [[nodiscard]] uint16_t *row(int32_t py) const noexcept { return buf + (py - bufY) * stride; }
     };
 
     struct Color565
@@ -68,6 +73,7 @@ namespace pipgui
             return false;
         s.buf = (uint16_t *)spr->getBuffer();
         s.stride = spr->width();
+        s.bufY = spr->bufferY();
         const int32_t maxH = spr->height();
         if (!s.buf || s.stride <= 0 || maxH <= 0)
             return false;
@@ -351,7 +357,7 @@ namespace pipgui
     {
         if (px < s.clipX || px > s.clipR || py < s.clipY || py > s.clipB)
             return;
-        blendStore(s.buf + py * s.stride + px, c, alpha);
+        blendStore(s.row(py) + px, c, alpha);
     }
 
     static __attribute__((always_inline)) inline void plotBlendClipGamma(const Surface565 &s, const Color565 &c,
@@ -360,14 +366,14 @@ namespace pipgui
     {
         if (px < s.clipX || px > s.clipR || py < s.clipY || py > s.clipB)
             return;
-        blendStoreGamma(s.buf + py * s.stride + px, c, gamma, alpha);
+        blendStoreGamma(s.row(py) + px, c, gamma, alpha);
     }
 
     static __attribute__((always_inline)) inline void fillSpanFast(const Surface565 &s, int32_t py,
                                                                    int32_t x0, int32_t x1, const Color565 &c)
     {
         if (x0 <= x1)
-            spanFill(s.buf + py * s.stride + x0, (int16_t)(x1 - x0 + 1), c.fg, c.fg32);
+            spanFill(s.row(py) + x0, (int16_t)(x1 - x0 + 1), c.fg, c.fg32);
     }
 
     static __attribute__((always_inline)) inline void fillSpanClip(const Surface565 &s, int32_t py,
@@ -387,7 +393,7 @@ namespace pipgui
     {
         if (py0 > py1)
             return;
-        uint16_t *dst = s.buf + py0 * s.stride + px;
+        uint16_t *dst = s.row(py0) + px;
         for (int32_t c = py1 - py0 + 1; c--;)
         {
             *dst = fg;
@@ -407,6 +413,48 @@ namespace pipgui
         fillVLineFast(s, px, py0, py1, fg);
     }
 
+    static inline void blitShapeMask(const Surface565 &s, const Color565 &c, const detail::ShapeMask &mask,
+                                     int16_t x, int16_t y, bool flipX, bool flipY)
+    {
+        const int32_t n = mask.size;
+        const int32_t y0 = (y > s.clipY) ? y : s.clipY;
+        const int32_t y1 = (y + n - 1 < s.clipB) ? y + n - 1 : s.clipB;
+        if (x > s.clipR || x + n - 1 < s.clipX || y0 > y1)
+            return;
+
+        auto blendRange = [&](uint16_t *row, const uint8_t *src, int32_t i0, int32_t i1)
+        {
+            for (int32_t i = i0; i < i1; ++i)
+            {
+                const int32_t px = flipX ? (x + n - 1 - i) : (x + i);
+                if (px >= s.clipX && px <= s.clipR)
+                    blendStore(row + px, c, src[i]);
+            }
+        };
+
+        for (int32_t py = y0; py <= y1; ++py)
+        {
+            const int32_t my = flipY ? (y + n - 1 - py) : (py - y);
+            const detail::ShapeMaskRow &span = mask.rows[my];
+            const uint8_t *src = mask.alpha + my * n;
+            uint16_t *row = s.row(py);
+
+            blendRange(row, src, span.lead, span.solidStart);
+            if (span.solidEnd > span.solidStart)
+            {
+                int32_t sx0 = flipX ? (x + n - span.solidEnd) : (x + span.solidStart);
+                int32_t sx1 = flipX ? (x + n - 1 - span.solidStart) : (x + span.solidEnd - 1);
+                if (sx0 < s.clipX)
+                    sx0 = s.clipX;
+                if (sx1 > s.clipR)
+                    sx1 = s.clipR;
+                if (sx0 <= sx1)
+                    spanFill(row + sx0, (int16_t)(sx1 - sx0 + 1), c.fg, c.fg32);
+            }
+            blendRange(row, src, span.solidEnd, span.trail);
+        }
+    }
+
     template <bool Fill, typename AccT>
     static inline void squircleRaster(const Surface565 &s, const Color565 &c,
                                       int16_t cx, int16_t cy, int16_t r,
@@ -421,7 +469,7 @@ namespace pipgui
                                          { fillVLineFast(s, px, py0, py1, c.fg); }, [&](int16_t px, int16_t py, uint8_t alpha)
                                          {
                                              if (alpha)
-                                                 blendStore(s.buf + (int32_t)py * s.stride + px, c, alpha); });
+                                                 blendStore(s.row(py) + px, c, alpha); });
             }
             else
             {
@@ -429,7 +477,7 @@ namespace pipgui
                                          { fillVLineClip(s, px, py0, py1, c.fg); }, [&](int16_t px, int16_t py, uint8_t alpha)
                                          {
                                              if (alpha && px >= s.clipX && px <= s.clipR && py >= s.clipY && py <= s.clipB)
-                                                 blendStore(s.buf + (int32_t)py * s.stride + px, c, alpha); });
+                                                 blendStore(s.row(py) + px, c, alpha); });
             }
         }
         else
@@ -440,7 +488,7 @@ namespace pipgui
                                          [&](int16_t px, int16_t py, uint8_t alpha)
                                          {
                                              if (alpha)
-                                                 blendStore(s.buf + (int32_t)py * s.stride + px, c, alpha);
+                                                 blendStore(s.row(py) + px, c, alpha);
                                          });
             }
             else
@@ -449,7 +497,7 @@ namespace pipgui
                                          [&](int16_t px, int16_t py, uint8_t alpha)
                                          {
                                              if (alpha && px >= s.clipX && px <= s.clipR && py >= s.clipY && py <= s.clipB)
-                                                 blendStore(s.buf + (int32_t)py * s.stride + px, c, alpha);
+                                                 blendStore(s.row(py) + px, c, alpha);
                                          });
             }
         }
@@ -0,0 +1,332 @@
+#include <pipGUI/Core/pipGUI.hpp>
+#include <pipGUI/Graphics/Effects/Internal.hpp>
+#include "Blend.hpp"
+
+namespace pipgui
+{
+    namespace
+    {
+        // Reads the finished RGB565 pass of an alpha layer into its typed buffer and frees the
+        // sprite: from here on the layer costs only the coverage or mask bytes.
+        template <typename Format>
+        bool storeLayerAlpha(pipcore::PixelBuffer<Format> &buf, pipcore::Sprite &spr, const detail::DirtyRect &rect,
+                             pipcore::Platform *plat)
+        {
+            if (buf.width() != rect.w || buf.height() != rect.h)
+            {
+                buf.setPlatform(plat);
+                if (!buf.create(rect.w, rect.h))
+                {
+                    spr.deleteSprite();
+                    return false;
+                }
+            }
+
+            const uint16_t *src = (const uint16_t *)spr.getBuffer();
+            const int32_t srcStride = spr.width();
+            for (int16_t y = 0; y < rect.h; ++y)
+            {
+                uint8_t *row = buf.row(y);
+                const uint16_t *s = src + (int32_t)y * srcStride;
+                for (int16_t x = 0; x < rect.w; ++x)
+                    Format::store(row, x, Format::fromRgb565(pipcore::Sprite::swap16(s[x])));
+            }
+            spr.deleteSprite();
+            return true;
+        }
+
+        struct LayerTarget
+        {
+            uint16_t *buf;
+            int32_t stride;
+            int32_t bufY;
+            int32_t rx0, ry0, rx1, ry1;
+        };
+
+        // Clips the layer rect at (x0, y0) against the target sprite.
+        bool layerTarget(pipcore::Sprite *spr, int32_t x0, int32_t y0, int16_t w, int16_t h, LayerTarget &t)
+        {
+            t.buf = (uint16_t *)spr->getBuffer();
+            if (!t.buf)
+                return false;
+            t.stride = spr->width();
+            t.bufY = spr->bufferY();
+            int32_t clipX = 0;
+            int32_t clipY = 0;
+            int32_t clipW = t.stride;
+            int32_t clipH = spr->height();
+            spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
+
+            t.rx0 = std::max<int32_t>(x0, clipX);
+            t.ry0 = std::max<int32_t>(y0, clipY);
+            t.rx1 = std::min<int32_t>(x0 + w, clipX + clipW);
+            t.ry1 = std::min<int32_t>(y0 + h, clipY + clipH);
+            return t.rx1 > t.rx0 && t.ry1 > t.ry0;
+        }
+    }
+
+    bool GUI::beginLayer(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h, int32_t keyColor)
+    {
+        if (layer >= detail::LAYER_MAX)
+            return false;
+        return beginLayerSlot(layer, x, y, w, h, keyColor);
+    }
+
+    bool GUI::beginLayerSlot(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h, int32_t keyColor)
+    {
+        if (layer >= detail::LAYER_SLOTS || _layers.active != detail::INVALID_LAYER_ID ||
+            w <= 0 || h <= 0 || !_flags.spriteEnabled)
+            return false;
+
+        // Layer contents live outside the screen sprite, so a display list cannot rebuild them.
+        if (_displayList.recording)
+        {
+            _displayList.unsupported = true;
+            return false;
+        }
+
+        detail::LayerSlot &slot = _layers.slots[layer];
+        slot.ready = false;
+        if (!slot.sprite.getBuffer() || slot.sprite.width() < w || slot.sprite.height() < h)
+        {
+            slot.sprite.deleteSprite();
+            slot.sprite.setPlatform(platform());
+            if (!slot.sprite.createSprite(w, h))
+                return false;
+        }
+
+        slot.rect = {x, y, w, h};
+        slot.alpha = false;
+        slot.keyed = keyColor >= 0;
+        const uint16_t fill565 = detail::resolveOptionalColor565(keyColor, _render.bgColor565);
+        slot.key = pipcore::Sprite::swap16(fill565);
+        slot.sprite.setClipRect(0, 0, w, h);
+        slot.sprite.fillRect(0, 0, w, h, fill565);
+
+        _layers.active = layer;
+        _layers.prevInSpritePass = _flags.inSpritePass;
+        _layers.prevActive = _render.activeSprite;
+        _layers.prevClip = _clip;
+
+        _flags.inSpritePass = 1;
+        _render.activeSprite = &slot.sprite;
+        _clip = {true, 0, 0, w, h};
+        return true;
+    }
+
+    bool GUI::beginAlphaLayer(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h, LayerAlpha format)
+    {
+        if (layer >= detail::LAYER_MAX)
+            return false;
+        return beginAlphaLayerSlot(layer, x, y, w, h, format);
+    }
+
+    // Content is drawn on black and its luma becomes the alpha, so anything drawn in white
+    // keeps its own anti-aliasing as coverage.
+    bool GUI::beginAlphaLayerSlot(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h, LayerAlpha format)
+    {
+        if (!beginLayerSlot(layer, x, y, w, h, 0x0000))
+            return false;
+        detail::LayerSlot &slot = _layers.slots[layer];
+        slot.alpha = true;
+        slot.keyed = false;
+        slot.alphaFormat = format;
+        return true;
+    }
+
+    void GUI::endLayer()
+    {
+        if (_layers.active == detail::INVALID_LAYER_ID)
+            return;
+
+        detail::LayerSlot &slot = _layers.slots[_layers.active];
+        if (!slot.alpha)
+        {
+            slot.coverage.release();
+            slot.mask.release();
+            slot.ready = true;
+        }
+        else if (slot.alphaFormat == LayerAlpha::Gray8)
+        {
+            slot.mask.release();
+            slot.ready = storeLayerAlpha(slot.coverage, slot.sprite, slot.rect, platform());
+        }
+        else
+        {
+            slot.coverage.release();
+            slot.ready = storeLayerAlpha(slot.mask, slot.sprite, slot.rect, platform());
+        }
+        _layers.active = detail::INVALID_LAYER_ID;
+        _flags.inSpritePass = _layers.prevInSpritePass;
+        _render.activeSprite = _layers.prevActive;
+        _clip = _layers.prevClip;
+    }
+
+    bool GUI::layerReady(uint8_t layer) const noexcept
+    {
+        return layer < detail::LAYER_MAX && _layers.slots[layer].ready;
+    }
+
+    void GUI::releaseLayer(uint8_t layer)
+    {
+        if (layer >= detail::LAYER_MAX || layer == _layers.active)
+            return;
+        detail::LayerSlot &slot = _layers.slots[layer];
+        slot.sprite.deleteSprite();
+        slot.coverage.release();
+        slot.mask.release();
+        slot.ready = false;
+    }
+
+    void GUI::freeLayers() noexcept
+    {
+        for (detail::LayerSlot &slot : _layers.slots)
+        {
+            slot.sprite.deleteSprite();
+            slot.coverage.release();
+            slot.mask.release();
+            slot.ready = false;
+        }
+        _layers.active = detail::INVALID_LAYER_ID;
+    }
+
+    void GUI::compositeLayer(uint8_t layer, uint8_t opacity, int16_t dx, int16_t dy)
+    {
+        if (layer < detail::LAYER_MAX)
+            compositeLayerSlot(layer, opacity, dx, dy);
+    }
+
+    void GUI::compositeLayerSlot(uint8_t layer, uint8_t opacity, int16_t dx, int16_t dy)
+    {
+        if (layer >= detail::LAYER_SLOTS || opacity == 0 || !_flags.spriteEnabled)
+            return;
+        const detail::LayerSlot &slot = _layers.slots[layer];
+        if (!slot.ready || slot.alpha)
+            return;
+
+        const int32_t x0 = (int32_t)slot.rect.x + dx;
+        const int32_t y0 = (int32_t)slot.rect.y + dy;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::Layer, (int16_t)x0, (int16_t)y0,
+                                                         slot.rect.w, slot.rect.h))
+            {
+                cmd->radius[0] = layer;
+                cmd->thickness = opacity;
+                cmd->v[0] = dx;
+                cmd->v[1] = dy;
+            }
+            return;
+        }
+
+        pipcore::Sprite *spr = getDrawTarget();
+        const uint16_t *src = (const uint16_t *)slot.sprite.getBuffer();
+        LayerTarget t;
+        if (!spr || spr == &slot.sprite || !src || !layerTarget(spr, x0, y0, slot.rect.w, slot.rect.h, t))
+            return;
+
+        const int32_t srcStride = slot.sprite.width();
+        const int32_t n = t.rx1 - t.rx0;
+        const uint16_t key = slot.key;
+        for (int32_t y = t.ry0; y < t.ry1; ++y)
+        {
+            const uint16_t *s = src + (y - y0) * srcStride + (t.rx0 - x0);
+            uint16_t *d = t.buf + (y - t.bufY) * t.stride + t.rx0;
+            if (!slot.keyed)
+            {
+                detail::blendSpan565(d, s, n, opacity);
+                continue;
+            }
+
+            int32_t i = 0;
+            while (i < n)
+            {
+                while (i < n && s[i] == key)
+                    ++i;
+                const int32_t start = i;
+                while (i < n && s[i] != key)
+                    ++i;
+                if (i > start)
+                    detail::blendSpan565(d + start, s + start, i - start, opacity);
+            }
+        }
+
+        if (_disp.display && !_flags.inSpritePass)
+            invalidateRect((int16_t)t.rx0, (int16_t)t.ry0, (int16_t)n, (int16_t)(t.ry1 - t.ry0));
+    }
+
+    void GUI::compositeAlphaLayer(uint8_t layer, uint16_t color565, uint8_t opacity, int16_t dx, int16_t dy)
+    {
+        if (layer < detail::LAYER_MAX)
+            compositeAlphaLayerSlot(layer, color565, opacity, dx, dy);
+    }
+
+    void GUI::compositeAlphaLayerSlot(uint8_t layer, uint16_t color565, uint8_t opacity, int16_t dx, int16_t dy)
+    {
+        if (layer >= detail::LAYER_SLOTS || opacity == 0 || !_flags.spriteEnabled)
+            return;
+        const detail::LayerSlot &slot = _layers.slots[layer];
+        if (!slot.ready || !slot.alpha)
+            return;
+
+        const int32_t x0 = (int32_t)slot.rect.x + dx;
+        const int32_t y0 = (int32_t)slot.rect.y + dy;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::AlphaLayer, (int16_t)x0, (int16_t)y0,
+                                                         slot.rect.w, slot.rect.h))
+            {
+                cmd->color = color565;
+                cmd->radius[0] = layer;
+                cmd->thickness = opacity;
+                cmd->v[0] = dx;
+                cmd->v[1] = dy;
+            }
+            return;
+        }
+
+        pipcore::Sprite *spr = getDrawTarget();
+        LayerTarget t;
+        if (!spr || !layerTarget(spr, x0, y0, slot.rect.w, slot.rect.h, t))
+            return;
+
+        // Coverage goes through the same span kernel as text and icons. Partial opacity and the
+        // 1-bit mask are expanded a chunk at a time into a scaled coverage row first.
+        constexpr int32_t kChunk = 64;
+        uint8_t cover[kChunk];
+        const bool gray = slot.alphaFormat == LayerAlpha::Gray8;
+        const int32_t n = t.rx1 - t.rx0;
+        const int32_t sx = t.rx0 - x0;
+        for (int32_t y = t.ry0; y < t.ry1; ++y)
+        {
+            uint16_t *d = t.buf + (y - t.bufY) * t.stride + t.rx0;
+            const uint8_t *row = gray ? slot.coverage.row((int16_t)(y - y0)) : slot.mask.row((int16_t)(y - y0));
+            if (gray && opacity == 255)
+            {
+                detail::blendCoverageSpan565(d, row + sx, n, color565);
+                continue;
+            }
+
+            for (int32_t i = 0; i < n; i += kChunk)
+            {
+                const int32_t m = std::min<int32_t>(kChunk, n - i);
+                if (gray)
+                {
+                    for (int32_t k = 0; k < m; ++k)
+                        cover[k] = (uint8_t)((row[sx + i + k] * (opacity + 1u)) >> 8);
+                }
+                else
+                {
+                    for (int32_t k = 0; k < m; ++k)
+                        cover[k] = pipcore::PixelMask1::load(row, sx + i + k) ? opacity : 0;
+                }
+                detail::blendCoverageSpan565(d + i, cover, m, color565);
+            }
+        }
+
+        if (_disp.display && !_flags.inSpritePass)
+            invalidateRect((int16_t)t.rx0, (int16_t)t.ry0, (int16_t)n, (int16_t)(t.ry1 - t.ry0));
+    }
+}
@@ -0,0 +1,211 @@
+#include "Internal.hpp"
+#include <pipGUI/Core/Internal/LruSlots.hpp>
+#include <cstring>
+
+namespace pipgui
+{
+    namespace detail
+    {
+        namespace
+        {
+            constexpr uint8_t kShapeMaskSlots = 32;
+            constexpr uint8_t kCircleMaskMaxRadius = 5;
+            constexpr int kCircleMaskSub = 8;
+
+            struct ShapeMaskSlot
+            {
+                uint8_t *data = nullptr;
+                uint32_t stamp = 0;
+                uint32_t bytes = 0;
+                uint16_t size = 0;
+                ShapeMaskKind kind = ShapeMaskKind::SquircleFill;
+                uint8_t radius = 0;
+            };
+
+            ShapeMaskSlot g_slots[kShapeMaskSlots];
+            uint32_t g_bytes = 0;
+            uint32_t g_stamp = 0;
+
+            static inline uint16_t maskSize(ShapeMaskKind kind, uint8_t radius) noexcept
+            {
+                switch (kind)
+                {
+                case ShapeMaskKind::SquircleFill:
+                    return radius;
+                case ShapeMaskKind::SquircleStroke:
+                    return (uint16_t)(radius + 1);
+                default:
+                    return (radius > kCircleMaskMaxRadius) ? 0 : (uint16_t)(radius * 2 + 1);
+                }
+            }
+
+            static inline void releaseSlot(ShapeMaskSlot &slot) noexcept
+            {
+                if (!slot.data)
+                    return;
+                detail::free(nullptr, slot.data);
+                g_bytes -= slot.bytes;
+                slot = ShapeMaskSlot();
+            }
+
+            static inline uint32_t rowsOffset(uint16_t n) noexcept
+            {
+                return ((uint32_t)n * n + 1u) & ~1u;
+            }
+
+            static inline ShapeMask slotMask(const ShapeMaskSlot &slot) noexcept
+            {
+                return {slot.data, reinterpret_cast<const ShapeMaskRow *>(slot.data + rowsOffset(slot.size)), slot.size};
+            }
+
+            static void buildRows(const uint8_t *mask, ShapeMaskRow *rows, uint16_t n) noexcept
+            {
+                for (uint16_t y = 0; y < n; ++y)
+                {
+                    const uint8_t *src = mask + (uint32_t)y * n;
+                    uint16_t lead = 0;
+                    while (lead < n && !src[lead])
+                        ++lead;
+                    uint16_t trail = n;
+                    while (trail > lead && !src[trail - 1])
+                        --trail;
+                    uint16_t solidStart = lead;
+                    while (solidStart < trail && src[solidStart] != 255)
+                        ++solidStart;
+                    uint16_t solidEnd = solidStart;
+                    while (solidEnd < trail && src[solidEnd] == 255)
+                        ++solidEnd;
+                    if (solidStart == trail)
+                        solidEnd = trail;
+                    rows[y] = {lead, solidStart, solidEnd, trail};
+                }
+            }
+
+            static inline void accumulate(uint8_t &m, uint8_t a) noexcept
+            {
+                if (a == 0 || m == 255)
+                    return;
+                if (a == 255)
+                {
+                    m = 255;
+                    return;
+                }
+                m = (uint8_t)(m + ((uint32_t)a * (255u - m) + 127u) / 255u);
+            }
+
+            static void buildSquircle(uint8_t *mask, uint16_t n, uint8_t r, bool fill) noexcept
+            {
+                const uint8_t *gamma = gammaTable();
+                const uint32_t r4 = pow4i<uint32_t>(r);
+                auto blendPixel = [&](int16_t px, int16_t py, uint8_t alpha)
+                {
+                    if (px >= 0 && py >= 0 && px < (int16_t)n && py < (int16_t)n)
+                        accumulate(mask[(uint32_t)py * n + px], alpha);
+                };
+
+                if (fill)
+                {
+                    rasterFillSquircle<uint32_t>(r, r, r, r4, gamma, [&](int16_t px, int16_t py0, int16_t py1)
+                                                 {
+                                                     if (px < 0 || px >= (int16_t)n)
+                                                         return;
+                                                     if (py0 < 0)
+                                                         py0 = 0;
+                                                     if (py1 >= (int16_t)n)
+                                                         py1 = (int16_t)(n - 1);
+                                                     for (int16_t py = py0; py <= py1; ++py)
+                                                         mask[(uint32_t)py * n + px] = 255; }, blendPixel);
+                }
+                else
+                {
+                    rasterDrawSquircle<uint32_t>(r, r, r, r4, gamma, blendPixel);
+                }
+            }
+
+            static void buildCircle(uint8_t *mask, uint16_t n, uint8_t r, bool fill) noexcept
+            {
+                const uint8_t *gamma = gammaTable();
+                constexpr float kInvSubArea = 255.0f / (float)(kCircleMaskSub * kCircleMaskSub);
+                const float outerR = (float)r + 0.5f;
+                const float innerR = fill ? -1.0f : ((float)r - 0.5f > 0.0f ? (float)r - 0.5f : 0.0f);
+                const float subStep = 1.0f / (float)kCircleMaskSub;
+                const float subBias = 0.5f * subStep;
+
+                for (int py = 0; py < n; ++py)
+                {
+                    for (int px = 0; px < n; ++px)
+                    {
+                        int covered = 0;
+                        for (int sy = 0; sy < kCircleMaskSub; ++sy)
+                        {
+                            const float y = ((float)py - (float)r - 0.5f) + subBias + (float)sy * subStep;
+                            for (int sx = 0; sx < kCircleMaskSub; ++sx)
+                            {
+                                const float x = ((float)px - (float)r - 0.5f) + subBias + (float)sx * subStep;
+                                const float d2 = x * x + y * y;
+                                if (d2 <= outerR * outerR && (fill || d2 >= innerR * innerR))
+                                    ++covered;
+                            }
+                        }
+                        mask[py * n + px] = gamma[(uint8_t)(covered * kInvSubArea + 0.5f)];
+                    }
+                }
+            }
+        }
+
+        ShapeMask shapeMask(ShapeMaskKind kind, uint8_t radius) noexcept
+        {
+            const uint16_t n = maskSize(kind, radius);
+            const uint32_t bytes = rowsOffset(n) + (uint32_t)n * sizeof(ShapeMaskRow);
+            if (radius == 0 || n == 0 || bytes > (uint32_t)PIPGUI_SHAPE_MASK_CACHE_BYTES)
+                return {nullptr, nullptr, 0};
+
+            ++g_stamp;
+            for (ShapeMaskSlot &slot : g_slots)
+            {
+                if (slot.data && slot.kind == kind && slot.radius == radius)
+                {
+                    slot.stamp = g_stamp;
+                    return slotMask(slot);
+                }
+            }
+
+            ShapeMaskSlot *victim = makeRoomLru(g_slots, g_bytes, bytes, (uint32_t)PIPGUI_SHAPE_MASK_CACHE_BYTES,
+                                                [](ShapeMaskSlot &slot)
+                                                { releaseSlot(slot); });
+            if (!victim)
+                return {nullptr, nullptr, 0};
+
+            uint8_t *data = static_cast<uint8_t *>(detail::alloc(nullptr, bytes, pipcore::AllocCaps::PreferInternal));
+            if (!data)
+                return {nullptr, nullptr, 0};
+            memset(data, 0, (size_t)n * n);
+
+            if (kind == ShapeMaskKind::SquircleFill || kind == ShapeMaskKind::SquircleStroke)
+                buildSquircle(data, n, radius, kind == ShapeMaskKind::SquircleFill);
+            else
+                buildCircle(data, n, radius, kind == ShapeMaskKind::CircleFill);
+            buildRows(data, reinterpret_cast<ShapeMaskRow *>(data + rowsOffset(n)), n);
+
+            victim->data = data;
+            victim->stamp = g_stamp;
+            victim->bytes = bytes;
+            victim->size = n;
+            victim->kind = kind;
+            victim->radius = radius;
+            g_bytes += bytes;
+            return slotMask(*victim);
+        }
+
+        void clearShapeMaskCache() noexcept
+        {
+            for (ShapeMaskSlot &slot : g_slots)
+                releaseSlot(slot);
+        }
+
+        uint32_t shapeMaskCacheBytes() noexcept
+        {
+            return g_bytes;
+        }
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+namespace pipgui
+{
+    namespace detail
+    {
+        enum class ShapeMaskKind : uint8_t
+        {
+            SquircleFill = 0,
+            SquircleStroke,
+            CircleFill,
+            CircleStroke
+        };
+
+        // Mask columns [lead, solidStart) and [solidEnd, trail) need blending, [solidStart, solidEnd)
+        // is fully covered and everything else is empty.
+        struct ShapeMaskRow
+        {
+            uint16_t lead;
+            uint16_t solidStart;
+            uint16_t solidEnd;
+            uint16_t trail;
+        };
+
+        // Gamma-applied 8-bit coverage, size x size, row-major. Squircle kinds hold the top-left
+        // corner box (radius wide for fills, radius + 1 for strokes); circle kinds hold the whole
+        // 2r+1 disc. The pointers stay valid until the next shapeMask() call.
+        struct ShapeMask
+        {
+            const uint8_t *alpha;
+            const ShapeMaskRow *rows;
+            uint16_t size;
+        };
+
+        [[nodiscard]] ShapeMask shapeMask(ShapeMaskKind kind, uint8_t radius) noexcept;
+        void clearShapeMaskCache() noexcept;
+        [[nodiscard]] uint32_t shapeMaskCacheBytes() noexcept;
+    }
+}
@@ -1,8 +1,12 @@
 #include "Internal.hpp"
+#include <pipGUI/Graphics/Draw/Blend.hpp>
+#include <pipGUI/Core/Debug.hpp>
 namespace pipgui
 {
     namespace
     {
+        constexpr int16_t kBlurSpanPx = 64;
+
         static inline bool intersectRectWithClip(int16_t &x, int16_t &y, int16_t &w, int16_t &h,
                                                  int32_t clipX, int32_t clipY, int32_t clipW, int32_t clipH)
         {
@@ -34,138 +38,256 @@ namespace pipgui
             return true;
         }
 
-        static const uint32_t inv16[257] = {
-            0,
-            65536, 32768, 21845, 16384, 13107, 10923, 9362, 8192, 7282, 6554,
-            5958, 5461, 5041, 4681, 4369, 4096, 3855, 3641, 3449, 3277,
-            3121, 2979, 2849, 2731, 2621, 2521, 2427, 2341, 2260, 2185,
-            2114, 2048, 1986, 1928, 1872, 1820, 1771, 1724, 1680, 1638,
-            1598, 1560, 1524, 1489, 1456, 1425, 1394, 1365, 1337, 1311,
-            1285, 1260, 1237, 1214, 1192, 1170, 1150, 1130, 1111, 1092,
-            1074, 1057, 1040, 1024, 1008, 993, 978, 964, 950, 936,
-            923, 910, 897, 885, 873, 862, 851, 840, 829, 819,
-            809, 799, 789, 780, 771, 762, 753, 745, 736, 728,
-            720, 712, 705, 697, 690, 683, 676, 669, 662, 655,
-            649, 643, 636, 630, 624, 618, 612, 607, 601, 596,
-            590, 585, 580, 575, 570, 565, 560, 555, 551, 546,
-            542, 537, 533, 529, 524, 520, 516, 512, 508, 504,
-            500, 496, 493, 489, 485, 482, 478, 475, 471, 468,
-            465, 462, 458, 455, 452, 449, 446, 443, 440, 437,
-            434, 431, 428, 426, 423, 420, 418, 415, 412, 410,
-            407, 405, 402, 400, 397, 395, 392, 390, 388, 385,
-            383, 381, 379, 377, 374, 372, 370, 368, 366, 364,
-            362, 360, 358, 356, 354, 352, 350, 349, 347, 345,
-            343, 341, 340, 338, 336, 335, 333, 331, 330, 328,
-            327, 325, 323, 322, 320, 319, 317, 316, 314, 313,
-            312, 310, 309, 307, 306, 305, 303, 302, 301, 299,
-            298, 297, 295, 294, 293, 292, 290, 289, 288, 287,
-            286, 284, 283, 282, 281, 280, 279, 278, 277, 275,
-            274, 273, 272, 271, 270, 269, 268, 267, 266, 265,
-            264, 263, 262, 261, 260};
-
         static inline size_t alignLookupOffset(size_t offset, size_t align) noexcept
         {
             const size_t mask = align - 1;
             return (offset + mask) & ~mask;
         }
+
+        constexpr int16_t kBlurTileRows = 8;
+        constexpr uint8_t kStackBlurShift = 24;
+
+        // One stack-blur pass along the rows of src: a triangle kernel of the given radius with the
+        // edge pixels repeated, equal to two box passes of half the radius. The result goes out
+        // transposed (dst[x * h + y]), so the second pass also walks contiguous rows. Rows are done
+        // kBlurTileRows at a time and leave the tile as short column runs.
+        static void stackBlurRowsT(const uint16_t *src, uint16_t *dst, int16_t w, int16_t h, uint16_t radius,
+                                   uint16_t *stack, uint16_t *tile) noexcept
+        {
+            const uint16_t div = (uint16_t)(radius * 2 + 1);
+            const uint32_t weight = (uint32_t)(radius + 1) * (uint32_t)(radius + 1);
+            const uint32_t mul = ((1UL << kStackBlurShift) + weight - 1) / weight;
+            const int32_t last = w - 1;
+
+            for (int16_t y0 = 0; y0 < h; y0 = (int16_t)(y0 + kBlurTileRows))
+            {
+                const int16_t rows = min<int16_t>(kBlurTileRows, (int16_t)(h - y0));
+                for (int16_t r = 0; r < rows; ++r)
+                {
+                    const uint16_t *line = src + (uint32_t)(y0 + r) * (uint32_t)w;
+                    uint16_t *out = tile + (uint32_t)r * (uint32_t)w;
+                    uint32_t sumR = 0, sumG = 0, sumB = 0;
+                    uint32_t inR = 0, inG = 0, inB = 0;
+                    uint32_t outR = 0, outG = 0, outB = 0;
+
+                    for (int32_t i = -(int32_t)radius; i <= (int32_t)radius; ++i)
+                    {
+                        const uint16_t c = line[i < 0 ? 0 : (i > last ? last : i)];
+                        stack[i + radius] = c;
+                        const uint32_t cr = c >> 11, cg = (c >> 5) & 0x3F, cb = c & 0x1F;
+                        const uint32_t k = (uint32_t)(radius + 1 - (i < 0 ? -i : i));
+                        sumR += cr * k;
+                        sumG += cg * k;
+                        sumB += cb * k;
+                        if (i <= 0)
+                        {
+                            outR += cr;
+                            outG += cg;
+                            outB += cb;
+                        }
+                        else
+                        {
+                            inR += cr;
+                            inG += cg;
+                            inB += cb;
+                        }
+                    }
+
+                    uint16_t sp = radius;
+                    for (int32_t x = 0; x < w; ++x)
+                    {
+                        out[x] = (uint16_t)((((sumR * mul) >> kStackBlurShift) << 11) |
+                                            (((sumG * mul) >> kStackBlurShift) << 5) |
+                                            ((sumB * mul) >> kStackBlurShift));
+                        sumR -= outR;
+                        sumG -= outG;
+                        sumB -= outB;
+
+                        uint16_t slot = (uint16_t)(sp + radius + 1);
+                        if (slot >= div)
+                            slot = (uint16_t)(slot - div);
+                        uint16_t c = stack[slot];
+                        outR -= c >> 11;
+                        outG -= (c >> 5) & 0x3F;
+                        outB -= c & 0x1F;
+
+                        c = line[x + radius + 1 > last ? last : x + radius + 1];
+                        stack[slot] = c;
+                        inR += c >> 11;
+                        inG += (c >> 5) & 0x3F;
+                        inB += c & 0x1F;
+                        sumR += inR;
+                        sumG += inG;
+                        sumB += inB;
+
+                        if (++sp == div)
+                            sp = 0;
+                        c = stack[sp];
+                        const uint32_t cr = c >> 11, cg = (c >> 5) & 0x3F, cb = c & 0x1F;
+                        outR += cr;
+                        outG += cg;
+                        outB += cb;
+                        inR -= cr;
+                        inG -= cg;
+                        inB -= cb;
+                    }
+                }
+
+                for (int16_t x = 0; x < w; ++x)
+                {
+                    uint16_t *col = dst + (uint32_t)x * (uint32_t)h + y0;
+                    const uint16_t *in = tile + x;
+                    for (int16_t r = 0; r < rows; ++r)
+                        col[r] = in[(uint32_t)r * (uint32_t)w];
+                }
+            }
+        }
     }
 
-    bool GUI::ensureBlurWorkBuffers(uint32_t smallLen, int16_t sw, int16_t sh, int16_t w, int16_t h) noexcept
+    bool GUI::ensureBlurWorkBuffers(uint32_t smallLen, int16_t sw, int16_t sh, int16_t w, int16_t h, uint16_t kernelRadius) noexcept
     {
         if (smallLen == 0 || sw <= 0 || sh <= 0 || w <= 0 || h <= 0)
             return false;
 
-        pipcore::Platform *plat = platform();
+        // All work buffers share one scratch block that is handed back when the pass ends.
+        size_t bytes = (size_t)smallLen * sizeof(uint16_t) * 2u;
+        const size_t stackOff = bytes;
+        bytes += ((size_t)kernelRadius * 2u + 1u) * sizeof(uint16_t);
+        const size_t tileOff = bytes;
+        bytes += (size_t)kBlurTileRows * (size_t)max<int16_t>(sw, sh) * sizeof(uint16_t);
+        // The stack holds an odd number of entries; the lookup tables below hold 32-bit entries
+        // and drawBlurRegion lays them out relative to this offset.
+        bytes = alignLookupOffset(bytes, alignof(uint32_t));
+        const size_t lookupOff = bytes;
+        bytes += (size_t)sw * sizeof(int16_t) * 2u;
+        bytes = alignLookupOffset(bytes, alignof(int32_t));
+        bytes += (size_t)sh * sizeof(int32_t) * 2u;
+        bytes = alignLookupOffset(bytes, alignof(uint16_t));
+        bytes += (size_t)w * sizeof(uint16_t);
+        bytes = alignLookupOffset(bytes, alignof(uint32_t));
+        bytes += (size_t)h * sizeof(uint32_t);
+        bytes = alignLookupOffset(bytes, alignof(uint8_t));
+        bytes += (size_t)max<int16_t>(w, h) * sizeof(uint8_t);
+
+        releaseBlurWorkBuffers();
+        uint8_t *work = static_cast<uint8_t *>(_scratch.acquire(platform(), (uint32_t)bytes));
+        if (!work)
+            return false;
 
-        auto alloc565Pair = [&](uint16_t *&a, uint16_t *&b, size_t n) -> bool
-        {
-            void *na = detail::alloc(plat, n * sizeof(uint16_t), pipcore::AllocCaps::Default);
-            void *nb = detail::alloc(plat, n * sizeof(uint16_t), pipcore::AllocCaps::Default);
-            if (!na || !nb)
-            {
-                detail::free(plat, na);
-                detail::free(plat, nb);
-                return false;
-            }
-            detail::free(plat, a);
-            detail::free(plat, b);
-            a = (uint16_t *)na;
-            b = (uint16_t *)nb;
-            return true;
-        };
+        _blur.work = work;
+        _blur.smallIn = reinterpret_cast<uint16_t *>(work);
+        _blur.smallTmp = _blur.smallIn + smallLen;
+        _blur.stack = reinterpret_cast<uint16_t *>(work + stackOff);
+        _blur.tile = reinterpret_cast<uint16_t *>(work + tileOff);
+        _blur.lookup = work + lookupOff;
+        return true;
+    }
+
+    detail::BlurCacheSlot *GUI::findBlurCache(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t radius,
+                                              int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH) noexcept
+    {
+        if (detail::BLUR_CACHE_SLOTS == 0)
+            return nullptr;
 
-        auto alloc32Triple = [&](uint32_t *&a, uint32_t *&b, uint32_t *&c, size_t n) -> bool
+        detail::BlurCacheSlot *victim = nullptr;
+        for (uint8_t i = 0; i < detail::BLUR_CACHE_SLOTS; ++i)
         {
-            void *na = detail::alloc(plat, n * sizeof(uint32_t), pipcore::AllocCaps::Default);
-            void *nb = detail::alloc(plat, n * sizeof(uint32_t), pipcore::AllocCaps::Default);
-            void *nc = detail::alloc(plat, n * sizeof(uint32_t), pipcore::AllocCaps::Default);
-            if (!na || !nb || !nc)
+            detail::BlurCacheSlot &slot = _blurCache.slots[i];
+            if (slot.out && slot.x == x && slot.y == y && slot.w == w && slot.h == h && slot.radius == radius &&
+                slot.clipX == clipX && slot.clipY == clipY && slot.clipW == clipW && slot.clipH == clipH)
             {
-                detail::free(plat, na);
-                detail::free(plat, nb);
-                detail::free(plat, nc);
-                return false;
+                slot.lastUse = ++_blurCache.useCounter;
+                return &slot;
             }
-            detail::free(plat, a);
-            detail::free(plat, b);
-            detail::free(plat, c);
-            a = (uint32_t *)na;
-            b = (uint32_t *)nb;
-            c = (uint32_t *)nc;
-            return true;
-        };
+            if (!victim || !slot.out || (victim->out && slot.lastUse < victim->lastUse))
+                victim = &slot;
+        }
 
-        auto ensureLookup = [&](int16_t needSw, int16_t needSh, int16_t needW, int16_t needH) -> bool
+        const int16_t sw = (int16_t)((w + radius * 2 + 1) >> 1);
+        const int16_t sh = (int16_t)((h + radius * 2 + 1) >> 1);
+        const uint32_t len = (uint32_t)sw * (uint32_t)sh;
+        if (victim->cap < len)
         {
-            if (_blur.lookup && _blur.lookupSw >= needSw && _blur.lookupSh >= needSh &&
-                _blur.lookupW >= needW && _blur.lookupH >= needH)
-                return true;
-
-            size_t bytes = 0;
-            bytes = alignLookupOffset(bytes, alignof(int16_t));
-            bytes += (size_t)needSw * sizeof(int16_t) * 2u;
-            bytes = alignLookupOffset(bytes, alignof(int32_t));
-            bytes += (size_t)needSh * sizeof(int32_t) * 2u;
-            bytes = alignLookupOffset(bytes, alignof(uint16_t));
-            bytes += (size_t)needW * sizeof(uint16_t);
-            bytes = alignLookupOffset(bytes, alignof(uint32_t));
-            bytes += (size_t)needH * sizeof(uint32_t);
-            bytes = alignLookupOffset(bytes, alignof(uint16_t));
-            bytes += ((size_t)needSw * 2u + (size_t)needSh * 2u) * sizeof(uint16_t);
-            bytes = alignLookupOffset(bytes, alignof(uint32_t));
-            bytes += ((size_t)needSw + (size_t)needSh) * sizeof(uint32_t);
-            bytes = alignLookupOffset(bytes, alignof(uint8_t));
-            bytes += (size_t)max<int16_t>(needW, needH) * sizeof(uint8_t);
-
-            void *lookup = detail::alloc(plat, bytes, pipcore::AllocCaps::Default);
-            if (!lookup)
-                return false;
-
-            detail::free(plat, _blur.lookup);
-            _blur.lookup = static_cast<uint8_t *>(lookup);
-            _blur.lookupSw = (uint16_t)needSw;
-            _blur.lookupSh = (uint16_t)needSh;
-            _blur.lookupW = (uint16_t)needW;
-            _blur.lookupH = (uint16_t)needH;
-            return true;
-        };
+            pipcore::Platform *plat = platform();
+            if (victim->out)
+                detail::free(plat, victim->out);
+            victim->out = static_cast<uint16_t *>(detail::alloc(plat, (size_t)len * sizeof(uint16_t), pipcore::AllocCaps::Default));
+            victim->cap = victim->out ? len : 0;
+            if (!victim->out)
+                return nullptr;
+        }
 
-        if ((!_blur.smallIn || !_blur.smallTmp || _blur.workLen < smallLen) &&
-            !alloc565Pair(_blur.smallIn, _blur.smallTmp, smallLen))
-            return false;
-        _blur.workLen = smallLen;
+        victim->x = x;
+        victim->y = y;
+        victim->w = w;
+        victim->h = h;
+        victim->radius = radius;
+        victim->clipX = clipX;
+        victim->clipY = clipY;
+        victim->clipW = clipW;
+        victim->clipH = clipH;
+        victim->sampleX = (int16_t)(x - radius);
+        victim->sampleY = (int16_t)(y - radius);
+        victim->sw = sw;
+        victim->sh = sh;
+        victim->ready = false;
+        victim->lastUse = ++_blurCache.useCounter;
+        return victim;
+    }
 
-        if ((_blur.rowCap < (uint16_t)(sw + 1) || !_blur.rowR || !_blur.rowG || !_blur.rowB) &&
-            !alloc32Triple(_blur.rowR, _blur.rowG, _blur.rowB, (size_t)(sw + 1)))
-            return false;
-        _blur.rowCap = (uint16_t)(sw + 1);
+    void GUI::markBlurCacheDirty(int16_t x, int16_t y, int16_t w, int16_t h) noexcept
+    {
+        for (uint8_t i = 0; i < detail::BLUR_CACHE_SLOTS; ++i)
+        {
+            detail::BlurCacheSlot &slot = _blurCache.slots[i];
+            if (!slot.ready)
+                continue;
+            const int32_t sx0 = max<int32_t>(((int32_t)x - slot.sampleX) >> 1, 0);
+            const int32_t sy0 = max<int32_t>(((int32_t)y - slot.sampleY) >> 1, 0);
+            const int32_t sx1 = min<int32_t>(((int32_t)x + w - 1 - slot.sampleX) >> 1, slot.sw - 1);
+            const int32_t sy1 = min<int32_t>(((int32_t)y + h - 1 - slot.sampleY) >> 1, slot.sh - 1);
+            if (sx0 > sx1 || sy0 > sy1)
+                continue;
+            if (slot.dirtyX0 > slot.dirtyX1)
+            {
+                slot.dirtyX0 = (int16_t)sx0;
+                slot.dirtyY0 = (int16_t)sy0;
+                slot.dirtyX1 = (int16_t)sx1;
+                slot.dirtyY1 = (int16_t)sy1;
+                continue;
+            }
+            slot.dirtyX0 = (int16_t)min<int32_t>(slot.dirtyX0, sx0);
+            slot.dirtyY0 = (int16_t)min<int32_t>(slot.dirtyY0, sy0);
+            slot.dirtyX1 = (int16_t)max<int32_t>(slot.dirtyX1, sx1);
+            slot.dirtyY1 = (int16_t)max<int32_t>(slot.dirtyY1, sy1);
+        }
+    }
 
-        if ((_blur.colCap < (uint16_t)(sh + 1) || !_blur.colR || !_blur.colG || !_blur.colB) &&
-            !alloc32Triple(_blur.colR, _blur.colG, _blur.colB, (size_t)(sh + 1)))
-            return false;
-        _blur.colCap = (uint16_t)(sh + 1);
+    void GUI::invalidateBlurCache() noexcept
+    {
+        // A slot nobody drew since the previous full render belongs to a region that is gone.
+        for (uint8_t i = 0; i < detail::BLUR_CACHE_SLOTS; ++i)
+        {
+            detail::BlurCacheSlot &slot = _blurCache.slots[i];
+            if (slot.ready || !slot.out)
+            {
+                slot.ready = false;
+                continue;
+            }
+            detail::free(platform(), slot.out);
+            slot = detail::BlurCacheSlot();
+        }
+    }
 
-        return ensureLookup(sw, sh, w, h);
+    void GUI::freeBlurCache(pipcore::Platform *plat) noexcept
+    {
+        for (uint8_t i = 0; i < detail::BLUR_CACHE_SLOTS; ++i)
+        {
+            detail::BlurCacheSlot &slot = _blurCache.slots[i];
+            if (slot.out)
+                detail::free(plat, slot.out);
+            slot = detail::BlurCacheSlot();
+        }
     }
 
     void GUI::drawBlurRegion(int16_t x, int16_t y, int16_t w, int16_t h,
@@ -176,8 +298,8 @@ namespace pipgui
             return;
         if (radius < 1)
             radius = 1;
-        _blur.lastUseMs = nowMs();
 
+        DebugProbe probe(DebugPhase::Blur);
         if (_flags.spriteEnabled && _disp.display && !_flags.inSpritePass)
         {
             updateBlurRegion(x, y, w, h, radius, dir, gradient, materialStrength, materialColor);
@@ -192,11 +314,14 @@ namespace pipgui
         int32_t clipW = spr->width();
         int32_t clipH = spr->height();
         spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
+        const int16_t fullW = w, fullH = h;
         if (!intersectRectWithClip(x, y, w, h, clipX, clipY, clipW, clipH))
             return;
+        const bool clipCoversRegion = (w == fullW && h == fullH);
 
         uint16_t *screenBuf = (uint16_t *)spr->getBuffer();
         const int16_t stride = spr->width();
+        const int32_t bufY = spr->bufferY();
         if (!screenBuf || stride <= 0)
             return;
 
@@ -219,12 +344,11 @@ namespace pipgui
         const int16_t sw = (int16_t)((sampleW + 1) >> 1);
         const int16_t sh = (int16_t)((sampleH + 1) >> 1);
         const uint32_t smallLen = (uint32_t)sw * (uint32_t)sh;
-        if (!smallLen || !ensureBlurWorkBuffers(smallLen, sw, sh, w, h))
+        const uint16_t kernelRadius = (uint16_t)(((radius + 1) >> 1) * 2);
+        if (!smallLen || !ensureBlurWorkBuffers(smallLen, sw, sh, w, h, kernelRadius))
             return;
 
         uint16_t *smallIn = _blur.smallIn, *smallTmp = _blur.smallTmp;
-        uint32_t *rowR = _blur.rowR, *rowG = _blur.rowG, *rowB = _blur.rowB;
-        uint32_t *colR = _blur.colR, *colG = _blur.colG, *colB = _blur.colB;
         uint8_t *lookup = _blur.lookup;
         size_t lookupOff = 0;
         lookupOff = alignLookupOffset(lookupOff, alignof(int16_t));
@@ -243,20 +367,6 @@ namespace pipgui
         lookupOff = alignLookupOffset(lookupOff, alignof(uint32_t));
         uint32_t *sampleYLookup = reinterpret_cast<uint32_t *>(lookup + lookupOff);
         lookupOff += (size_t)h * sizeof(uint32_t);
-        lookupOff = alignLookupOffset(lookupOff, alignof(uint16_t));
-        uint16_t *blurXa = reinterpret_cast<uint16_t *>(lookup + lookupOff);
-        lookupOff += (size_t)sw * sizeof(uint16_t);
-        uint16_t *blurXb = reinterpret_cast<uint16_t *>(lookup + lookupOff);
-        lookupOff += (size_t)sw * sizeof(uint16_t);
-        uint16_t *blurYa = reinterpret_cast<uint16_t *>(lookup + lookupOff);
-        lookupOff += (size_t)sh * sizeof(uint16_t);
-        uint16_t *blurYb = reinterpret_cast<uint16_t *>(lookup + lookupOff);
-        lookupOff += (size_t)sh * sizeof(uint16_t);
-        lookupOff = alignLookupOffset(lookupOff, alignof(uint32_t));
-        uint32_t *blurInvX = reinterpret_cast<uint32_t *>(lookup + lookupOff);
-        lookupOff += (size_t)sw * sizeof(uint32_t);
-        uint32_t *blurInvY = reinterpret_cast<uint32_t *>(lookup + lookupOff);
-        lookupOff += (size_t)sh * sizeof(uint32_t);
         lookupOff = alignLookupOffset(lookupOff, alignof(uint8_t));
         uint8_t *gradAlpha = lookup + lookupOff;
         for (int16_t sx = 0; sx < sw; ++sx)
@@ -287,85 +397,79 @@ namespace pipgui
                 y1 = (int16_t)clipY;
             else if (y1 > clipB)
                 y1 = (int16_t)clipB;
-            sampleRow0[sy] = (int32_t)y0 * stride;
-            sampleRow1[sy] = (int32_t)y1 * stride;
+            sampleRow0[sy] = (y0 - bufY) * stride;
+            sampleRow1[sy] = (y1 - bufY) * stride;
         }
 
-        for (int16_t sy = 0; sy < sh; ++sy)
+        // Downsamples and blurs the window [wx0, wx0 + ww) x [wy0, wy0 + wh) of the half-size grid into
+        // smallIn with stride ww. Edge pixels are repeated at the window edge, so a window that stops
+        // short of the grid edge is exact only kernelRadius inside it.
+        auto blurWindow = [&](int16_t wx0, int16_t wy0, int16_t ww, int16_t wh)
         {
-            const int32_t row0 = sampleRow0[sy];
-            const int32_t row1 = sampleRow1[sy];
-            for (int16_t sx = 0; sx < sw; ++sx)
+            for (int16_t sy = 0; sy < wh; ++sy)
             {
-                const int16_t x0 = sampleX0[sx];
-                const int16_t x1 = sampleX1[sx];
-                const uint16_t c00 = read565(row0 + x0);
-                const uint16_t c10 = read565(row0 + x1);
-                const uint16_t c01 = read565(row1 + x0);
-                const uint16_t c11 = read565(row1 + x1);
-                smallIn[(uint32_t)sy * sw + sx] = (uint16_t)(((((c00 >> 11) + (c10 >> 11) + (c01 >> 11) + (c11 >> 11)) >> 2) << 11) |
-                                                             (((((c00 >> 5) & 0x3F) + ((c10 >> 5) & 0x3F) + ((c01 >> 5) & 0x3F) + ((c11 >> 5) & 0x3F)) >> 2) << 5) |
-                                                             (((c00 & 0x1F) + (c10 & 0x1F) + (c01 & 0x1F) + (c11 & 0x1F)) >> 2));
+                const int32_t row0 = sampleRow0[wy0 + sy];
+                const int32_t row1 = sampleRow1[wy0 + sy];
+                for (int16_t sx = 0; sx < ww; ++sx)
+                {
+                    const int16_t x0 = sampleX0[wx0 + sx];
+                    const int16_t x1 = sampleX1[wx0 + sx];
+                    const uint16_t c00 = read565(row0 + x0);
+                    const uint16_t c10 = read565(row0 + x1);
+                    const uint16_t c01 = read565(row1 + x0);
+                    const uint16_t c11 = read565(row1 + x1);
+                    smallIn[(uint32_t)sy * ww + sx] = (uint16_t)(((((c00 >> 11) + (c10 >> 11) + (c01 >> 11) + (c11 >> 11)) >> 2) << 11) |
+                                                                 (((((c00 >> 5) & 0x3F) + ((c10 >> 5) & 0x3F) + ((c01 >> 5) & 0x3F) + ((c11 >> 5) & 0x3F)) >> 2) << 5) |
+                                                                 (((c00 & 0x1F) + (c10 & 0x1F) + (c01 & 0x1F) + (c11 & 0x1F)) >> 2));
+                }
             }
-        }
 
-        const uint8_t radiusSmall = (uint8_t)((radius + 1) >> 1);
+            stackBlurRowsT(smallIn, smallTmp, ww, wh, kernelRadius, _blur.stack, _blur.tile);
+            stackBlurRowsT(smallTmp, smallIn, wh, ww, kernelRadius, _blur.stack, _blur.tile);
+        };
 
-        if (radiusSmall > 0)
+        // A cached region only re-blurs the invalidated part of the grid plus the kernel reach;
+        // everything else comes straight from the previous result. A region the clip cuts short
+        // bypasses the cache: its samples clamp to the clip edge, so the grid only holds for
+        // that one partial repaint.
+        const uint16_t *blurred = smallIn;
+        detail::BlurCacheSlot *cache = (spr == &_render.sprite && !bandedRender() && clipCoversRegion)
+                                           ? findBlurCache(x, y, w, h, radius, (int16_t)clipX, (int16_t)clipY, (int16_t)clipW, (int16_t)clipH)
+                                           : nullptr;
+        if (cache && cache->ready)
         {
-            auto blurH = [&]()
+            if (cache->dirtyX0 <= cache->dirtyX1 && cache->dirtyY0 <= cache->dirtyY1)
             {
-                for (int16_t iy = 0; iy < sh; ++iy)
-                {
-                    const uint32_t off = (uint32_t)iy * sw;
-                    rowR[0] = rowG[0] = rowB[0] = 0;
-                    for (int16_t ix = 0; ix < sw; ++ix)
-                    {
-                        uint16_t c = smallIn[off + ix];
-                        rowR[ix + 1] = rowR[ix] + ((c >> 11) & 0x1F);
-                        rowG[ix + 1] = rowG[ix] + ((c >> 5) & 0x3F);
-                        rowB[ix + 1] = rowB[ix] + (c & 0x1F);
-                    }
-                    for (int16_t ix = 0; ix < sw; ++ix)
-                    {
-                        const uint16_t xa = blurXa[ix];
-                        const uint16_t xb1 = blurXb[ix];
-                        const uint32_t inv = blurInvX[ix];
-                        smallTmp[off + ix] = (uint16_t)(((((rowR[xb1] - rowR[xa]) * inv) >> 16) << 11) |
-                                                        ((((rowG[xb1] - rowG[xa]) * inv) >> 16) << 5) |
-                                                        (((rowB[xb1] - rowB[xa]) * inv) >> 16));
-                    }
-                }
-            };
-
-            auto blurV = [&]()
+                const int16_t reach = (int16_t)kernelRadius;
+                const int16_t cx0 = max<int16_t>(0, cache->dirtyX0 - reach);
+                const int16_t cy0 = max<int16_t>(0, cache->dirtyY0 - reach);
+                const int16_t cx1 = min<int16_t>(sw - 1, cache->dirtyX1 + reach);
+                const int16_t cy1 = min<int16_t>(sh - 1, cache->dirtyY1 + reach);
+                const int16_t wx0 = max<int16_t>(0, cx0 - reach);
+                const int16_t wy0 = max<int16_t>(0, cy0 - reach);
+                const int16_t ww = (int16_t)(min<int16_t>(sw - 1, cx1 + reach) - wx0 + 1);
+                const int16_t wh = (int16_t)(min<int16_t>(sh - 1, cy1 + reach) - wy0 + 1);
+                blurWindow(wx0, wy0, ww, wh);
+                for (int16_t cy = cy0; cy <= cy1; ++cy)
+                    memcpy(cache->out + (uint32_t)cy * sw + cx0,
+                           smallIn + (uint32_t)(cy - wy0) * ww + (cx0 - wx0),
+                           (size_t)(cx1 - cx0 + 1) * sizeof(uint16_t));
+            }
+            blurred = cache->out;
+        }
+        else
+        {
+            blurWindow(0, 0, sw, sh);
+            if (cache)
             {
-                for (int16_t ix = 0; ix < sw; ++ix)
-                {
-                    colR[0] = colG[0] = colB[0] = 0;
-                    for (int16_t iy = 0; iy < sh; ++iy)
-                    {
-                        uint16_t c = smallTmp[(uint32_t)iy * sw + ix];
-                        colR[iy + 1] = colR[iy] + ((c >> 11) & 0x1F);
-                        colG[iy + 1] = colG[iy] + ((c >> 5) & 0x3F);
-                        colB[iy + 1] = colB[iy] + (c & 0x1F);
-                    }
-                    for (int16_t iy = 0; iy < sh; ++iy)
-                    {
-                        const uint16_t ya = blurYa[iy];
-                        const uint16_t yb1 = blurYb[iy];
-                        const uint32_t inv = blurInvY[iy];
-                        smallIn[(uint32_t)iy * sw + ix] = (uint16_t)(((((colR[yb1] - colR[ya]) * inv) >> 16) << 11) |
-                                                                     ((((colG[yb1] - colG[ya]) * inv) >> 16) << 5) |
-                                                                     (((colB[yb1] - colB[ya]) * inv) >> 16));
-                    }
-                }
-            };
-
-            blurH();
-            blurV();
-            blurH();
-            blurV();
+                memcpy(cache->out, smallIn, (size_t)smallLen * sizeof(uint16_t));
+                cache->ready = true;
+            }
+        }
+        if (cache)
+        {
+            cache->dirtyX0 = cache->dirtyY0 = 0;
+            cache->dirtyX1 = cache->dirtyY1 = -1;
         }
 
         const bool useMaterial = (materialStrength > 0);
@@ -399,29 +503,11 @@ namespace pipgui
                                     : (h <= 1 ? 255 : (uint8_t)(iy * 255 / (h - 1)));
         }
 
-        for (int16_t ix = 0; ix < sw; ++ix)
-        {
-            const uint16_t xa = (uint16_t)((ix > radiusSmall) ? (ix - radiusSmall) : 0);
-            const uint16_t xb = (uint16_t)min<int16_t>(sw - 1, ix + radiusSmall);
-            blurXa[ix] = xa;
-            blurXb[ix] = (uint16_t)(xb + 1);
-            blurInvX[ix] = inv16[(uint32_t)(xb - xa + 1)];
-        }
-
-        for (int16_t iy = 0; iy < sh; ++iy)
-        {
-            const uint16_t ya = (uint16_t)((iy > radiusSmall) ? (iy - radiusSmall) : 0);
-            const uint16_t yb = (uint16_t)min<int16_t>(sh - 1, iy + radiusSmall);
-            blurYa[iy] = ya;
-            blurYb[iy] = (uint16_t)(yb + 1);
-            blurInvY[iy] = inv16[(uint32_t)(yb - ya + 1)];
-        }
-
         for (int16_t iy = 0; iy < h; ++iy)
         {
             const uint8_t alphaRow = gradV ? gradAlpha[iy] : 255;
 
-            const int32_t screenOff = (int32_t)(y + iy) * stride + x;
+            const int32_t screenOff = (y + iy - bufY) * stride + x;
             const uint32_t sampleYOff = sampleYLookup[iy];
 
             if (!gradH)
@@ -435,17 +521,29 @@ namespace pipgui
                 {
                     for (int16_t ix = 0; ix < w; ++ix)
                     {
-                        uint16_t mixed = smallIn[sampleYOff + sampleXLookup[ix]];
+                        uint16_t mixed = blurred[sampleYOff + sampleXLookup[ix]];
                         if (materialAlpha)
                             mixed = detail::blend565(mixed, mat565, materialAlpha);
                         write565(screenOff + ix, mixed);
                     }
                 }
+                else if (alphaRow != 0 && !materialAlpha)
+                {
+                    uint16_t row[kBlurSpanPx];
+                    for (int16_t ix = 0; ix < w;)
+                    {
+                        const int16_t run = (w - ix < kBlurSpanPx) ? (int16_t)(w - ix) : kBlurSpanPx;
+                        for (int16_t i = 0; i < run; ++i)
+                            row[i] = swap16(blurred[sampleYOff + sampleXLookup[ix + i]]);
+                        detail::blendSpan565(screenBuf + screenOff + ix, row, run, alphaRow);
+                        ix = (int16_t)(ix + run);
+                    }
+                }
                 else if (alphaRow != 0)
                 {
                     for (int16_t ix = 0; ix < w; ++ix)
                     {
-                        uint16_t mixed = detail::blend565(read565(screenOff + ix), smallIn[sampleYOff + sampleXLookup[ix]], alphaRow);
+                        uint16_t mixed = detail::blend565(read565(screenOff + ix), blurred[sampleYOff + sampleXLookup[ix]], alphaRow);
                         if (materialAlpha)
                             mixed = detail::blend565(mixed, mat565, materialAlpha);
                         write565(screenOff + ix, mixed);
@@ -468,7 +566,7 @@ namespace pipgui
                     uint16_t mixed;
                     if (alpha == 255)
                     {
-                        mixed = smallIn[sampleYOff + sampleXLookup[ix]];
+                        mixed = blurred[sampleYOff + sampleXLookup[ix]];
                     }
                     else if (alpha == 0)
                     {
@@ -476,7 +574,7 @@ namespace pipgui
                     }
                     else
                     {
-                        mixed = detail::blend565(read565(screenOff + ix), smallIn[sampleYOff + sampleXLookup[ix]], alpha);
+                        mixed = detail::blend565(read565(screenOff + ix), blurred[sampleYOff + sampleXLookup[ix]], alpha);
                     }
 
                     if (useMaterial)
@@ -490,6 +588,8 @@ namespace pipgui
                 }
             }
         }
+
+        releaseBlurWorkBuffers();
     }
 
     void GUI::updateBlurRegion(int16_t x, int16_t y, int16_t w, int16_t h,
@@ -501,8 +601,11 @@ namespace pipgui
             drawBlurRegion(x, y, w, h, radius, dir, gradient, materialStrength, materialColor);
             return;
         }
+        // The region's own output must not count as a backdrop change.
+        ++_blurCache.hold;
         renderToSpriteAndInvalidate(x, y, w, h,
                                     [&]
                                     { drawBlurRegion(x, y, w, h, radius, dir, gradient, materialStrength, materialColor); });
+        --_blurCache.hold;
     }
 }
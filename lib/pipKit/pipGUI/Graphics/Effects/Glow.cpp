@@ -1,12 +1,20 @@
 #include "Internal.hpp"
+#include <pipGUI/Graphics/Draw/Internal.hpp>
 namespace pipgui
 {
     namespace
     {
-        struct GlowLayer
+        constexpr uint16_t kGlowLutSize = 256;
+
+        // Colors of the falloff, indexed by (metric - lo) >> shift. The metric is the squared
+        // distance to the shape core (fourth power for squircles), so the ring loop needs no sqrt.
+        template <typename AccT>
+        struct GlowLut
         {
-            int16_t offset;
-            uint16_t color;
+            uint16_t color[kGlowLutSize];
+            AccT lo;
+            uint8_t shift;
+            uint16_t end;
         };
 
         static inline uint16_t computeGlowStrength(uint8_t glowStrength, GlowAnim anim,
@@ -30,31 +38,174 @@ namespace pipgui
             return (uint16_t)(res > 255 ? 255 : res);
         }
 
-        static inline uint8_t glowAlphaForOffset(uint32_t inv, uint16_t strength, int16_t off)
+        // Cubic falloff; nQ4 runs from glowSize * 16 at the shape edge down to 0 at the rim.
+        static inline uint8_t glowAlphaForOffset(uint32_t inv, uint16_t strength, uint32_t nQ4)
         {
-            const uint32_t n = (uint32_t)off * inv;
+            const uint32_t n = nQ4 * inv >> 4;
             const uint32_t curve = (uint32_t)((uint64_t)(n * n >> 16) * n >> 16);
             return (uint8_t)min(255U, (uint32_t)strength * curve >> 16);
         }
 
-        static inline uint8_t buildGlowLayers(uint16_t bg, uint16_t glow,
-                                              uint8_t glowSize, uint16_t strength,
-                                              GlowLayer *layers)
+        template <typename AccT, uint8_t Pow>
+        static __attribute__((always_inline)) inline AccT glowMetric(int32_t v)
+        {
+            const AccT v2 = (AccT)v * (AccT)v;
+            if constexpr (Pow == 4)
+                return v2 * v2;
+            else
+                return v2;
+        }
+
+        // Never above the true root, so a skipped prefix can only be too short.
+        template <typename AccT>
+        static inline uint32_t glowSqrt(AccT v)
+        {
+            if (v <= (AccT)0xFFFFFFFFu)
+                return isqrt32((uint32_t)v);
+            return isqrt32((uint32_t)(v >> 16)) << 8;
+        }
+
+        template <typename AccT, uint8_t Pow>
+        static inline uint32_t glowRoot(AccT v)
+        {
+            if constexpr (Pow == 4)
+                return isqrt32(glowSqrt<AccT>(v));
+            else
+                return glowSqrt<AccT>(v);
+        }
+
+        template <typename AccT, uint8_t Pow>
+        static void buildGlowLut(GlowLut<AccT> &lut, int16_t r, uint8_t glowSize,
+                                 uint16_t bg, uint16_t glow, uint16_t strength)
         {
-            uint8_t count = 0;
+            // Start one pixel inside the edge so the shape's own AA blends over glow, not background.
+            lut.lo = glowMetric<AccT, Pow>(r > 0 ? r - 1 : 0);
+            const AccT span = glowMetric<AccT, Pow>(r + glowSize + 1) - lut.lo;
+            lut.shift = 0;
+            while ((span >> lut.shift) >= kGlowLutSize)
+                ++lut.shift;
+
             const uint32_t inv = 65535U / glowSize;
-            for (int16_t off = glowSize; off > 0; --off)
+            const int32_t fullQ4 = (int32_t)glowSize << 4;
+            const AccT half = ((AccT)1 << lut.shift) >> 1;
+            lut.end = kGlowLutSize;
+            for (uint16_t i = 0; i < kGlowLutSize; ++i)
             {
-                const uint8_t alpha = glowAlphaForOffset(inv, strength, (int16_t)(glowSize - off + 1));
+                const AccT m = lut.lo + ((AccT)i << lut.shift) + half;
+                uint32_t dQ4;
+                if constexpr (Pow == 4)
+                    dQ4 = isqrt32(glowSqrt<AccT>(m) << 8);
+                else
+                    dQ4 = ((uint32_t)m < (1u << 24)) ? isqrt32((uint32_t)m << 8) : (isqrt32((uint32_t)m) << 4);
+
+                int32_t nQ4 = fullQ4 + 16 - ((int32_t)dQ4 - ((int32_t)r << 4));
+                if (nQ4 > fullQ4)
+                    nQ4 = fullQ4;
+                const uint8_t alpha = nQ4 > 0 ? glowAlphaForOffset(inv, strength, (uint32_t)nQ4) : 0;
                 if (alpha < 2)
-                    continue;
-                const uint16_t color = detail::blend565(bg, glow, alpha);
-                if (count && layers[count - 1].color == color)
-                    continue;
-                layers[count++] = {off, color};
+                {
+                    lut.end = i;
+                    return;
+                }
+                lut.color[i] = pipcore::Sprite::swap16(detail::blend565(bg, glow, alpha));
             }
-            return count;
         }
+
+        // One store per ring pixel: each row walks outward from the core span on both sides and
+        // stops at the first pixel past the visible rim. Rows beside the core share one color.
+        template <typename AccT, uint8_t Pow>
+        static void rasterGlowRing(const Surface565 &s, const GlowLut<AccT> &lut,
+                                   int32_t cx0, int32_t cy0, int32_t cx1, int32_t cy1, int32_t reach)
+        {
+            const int32_t py0 = std::max<int32_t>(cy0 - reach, s.clipY);
+            const int32_t py1 = std::min<int32_t>(cy1 + reach, s.clipB);
+            const int32_t spanX0 = std::max<int32_t>(cx0, s.clipX);
+            const int32_t spanX1 = std::min<int32_t>(cx1, s.clipR);
+
+            for (int32_t py = py0; py <= py1; ++py)
+            {
+                const int32_t dy = (py < cy0) ? (cy0 - py) : ((py > cy1) ? (py - cy1) : 0);
+                const AccT my = glowMetric<AccT, Pow>(dy);
+                uint16_t *row = s.row(py);
+
+                int32_t dx = 1;
+                if (my >= lut.lo)
+                {
+                    const AccT idx = (my - lut.lo) >> lut.shift;
+                    if (idx >= lut.end)
+                        continue;
+                    const uint16_t fg = lut.color[idx];
+                    if (spanX0 <= spanX1)
+                        spanFill(row + spanX0, (int16_t)(spanX1 - spanX0 + 1), fg, ((uint32_t)fg << 16) | fg);
+                }
+                else
+                {
+                    const int32_t skip = (int32_t)glowRoot<AccT, Pow>(lut.lo - my);
+                    if (skip > dx)
+                        dx = skip;
+                }
+
+                for (; dx <= reach; ++dx)
+                {
+                    const AccT m = glowMetric<AccT, Pow>(dx) + my;
+                    if (m < lut.lo)
+                        continue;
+                    const AccT idx = (m - lut.lo) >> lut.shift;
+                    if (idx >= lut.end)
+                        break;
+                    const uint16_t fg = lut.color[idx];
+                    const int32_t pxL = cx0 - dx;
+                    const int32_t pxR = cx1 + dx;
+                    if (pxL >= s.clipX && pxL <= s.clipR)
+                        row[pxL] = fg;
+                    if (pxR >= s.clipX && pxR <= s.clipR)
+                        row[pxR] = fg;
+                }
+            }
+        }
+
+        template <typename AccT, uint8_t Pow>
+        static void fillGlowRingAcc(const Surface565 &s, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t r,
+                                    uint16_t bg, uint16_t glow, uint8_t glowSize, uint16_t strength)
+        {
+            GlowLut<AccT> lut;
+            buildGlowLut<AccT, Pow>(lut, r, glowSize, bg, glow, strength);
+            if (lut.end)
+                rasterGlowRing<AccT, Pow>(s, lut, x0, y0, x1, y1, (int32_t)r + glowSize + 1);
+        }
+    }
+
+    void GUI::fillGlowRing(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t r, bool squircle,
+                           uint16_t bg, uint16_t glow, uint8_t glowSize, uint16_t strength)
+    {
+        const int16_t reach = (int16_t)(r + glowSize + 1);
+        const int16_t bx = (int16_t)(x0 - reach);
+        const int16_t by = (int16_t)(y0 - reach);
+        const int16_t bw = (int16_t)(x1 - x0 + 1 + reach * 2);
+        const int16_t bh = (int16_t)(y1 - y0 + 1 + reach * 2);
+        if (!_flags.spriteEnabled || quickReject(bx, by, bw, bh))
+            return;
+
+        // The falloff LUT depends on the pulse phase, so the ring is not worth a display-list op.
+        if (_displayList.recording)
+        {
+            _displayList.unsupported = true;
+            return;
+        }
+
+        Surface565 s;
+        if (!getSurface565(getDrawTarget(), s))
+            return;
+
+        if (!squircle)
+            fillGlowRingAcc<uint32_t, 2>(s, x0, y0, x1, y1, r, bg, glow, glowSize, strength);
+        else if (reach <= 255)
+            fillGlowRingAcc<uint32_t, 4>(s, x0, y0, x1, y1, r, bg, glow, glowSize, strength);
+        else
+            fillGlowRingAcc<uint64_t, 4>(s, x0, y0, x1, y1, r, bg, glow, glowSize, strength);
+
+        if (_disp.display && !_flags.inSpritePass)
+            invalidateRect(bx, by, bw, bh);
     }
 
     void GUI::drawGlowCircle(int16_t x, int16_t y, int16_t r,
@@ -81,16 +232,8 @@ namespace pipgui
         const uint16_t glow = glowColor >= 0 ? (uint16_t)glowColor : detail::blend565WithWhite(fillColor, 80);
         const uint16_t strength = computeGlowStrength(glowStrength, anim, pulsePeriodMs, nowMs());
 
-        if (glowSize == 0 || strength < 2)
-        {
-            fillCircle(x, y, r, fillColor);
-            return;
-        }
-
-        GlowLayer layers[255];
-        const uint8_t layerCount = buildGlowLayers(bg, glow, glowSize, strength, layers);
-        for (uint8_t i = 0; i < layerCount; ++i)
-            fillCircle(x, y, (int16_t)(r + layers[i].offset), layers[i].color);
+        if (glowSize != 0 && strength >= 2)
+            fillGlowRing(x, y, x, y, r, false, bg, glow, glowSize, strength);
         fillCircle(x, y, r, fillColor);
     }
 
@@ -120,4 +263,63 @@ namespace pipgui
             { drawGlowCircle(x, y, r, fillColor, (int16_t)bg, glowColor, glowSize, glowStrength, anim, pulsePeriodMs); });
     }
 
+    void GUI::drawGlowRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t radius, bool squircle,
+                           uint16_t fillColor, int16_t bgColor, int16_t glowColor,
+                           uint8_t glowSize, uint8_t glowStrength,
+                           GlowAnim anim, uint16_t pulsePeriodMs)
+    {
+        if (w <= 0 || h <= 0)
+            return;
+
+        if (_flags.spriteEnabled && _disp.display && !_flags.inSpritePass)
+        {
+            updateGlowRect(x, y, w, h, radius, squircle, fillColor, bgColor, glowColor, glowSize, glowStrength, anim, pulsePeriodMs);
+            return;
+        }
+
+        if (x == center)
+            x = (int16_t)(AutoX(w + glowSize * 2) + glowSize);
+        if (y == center)
+            y = (int16_t)(AutoY(h + glowSize * 2) + glowSize);
+
+        const int16_t maxR = (w < h ? w : h) / 2;
+        const int16_t r = (radius > maxR) ? maxR : radius;
+        const uint16_t bg = detail::resolveOptionalColor565(bgColor, _render.bgColor565);
+        const uint16_t glow = glowColor >= 0 ? (uint16_t)glowColor : detail::blend565WithWhite(fillColor, 80);
+        const uint16_t strength = computeGlowStrength(glowStrength, anim, pulsePeriodMs, nowMs());
+
+        if (glowSize != 0 && strength >= 2)
+            fillGlowRing((int16_t)(x + r), (int16_t)(y + r), (int16_t)(x + w - r - 1), (int16_t)(y + h - r - 1),
+                         r, squircle, bg, glow, glowSize, strength);
+        if (squircle)
+            fillSquircleRect(x, y, w, h, (uint8_t)r, fillColor);
+        else
+            fillRoundRect(x, y, w, h, (uint8_t)r, fillColor);
+    }
+
+    void GUI::updateGlowRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t radius, bool squircle,
+                             uint16_t fillColor, int16_t bgColor, int16_t glowColor,
+                             uint8_t glowSize, uint8_t glowStrength,
+                             GlowAnim anim, uint16_t pulsePeriodMs)
+    {
+        if (!_flags.spriteEnabled || !_disp.display)
+        {
+            drawGlowRect(x, y, w, h, radius, squircle, fillColor, bgColor, glowColor, glowSize, glowStrength, anim, pulsePeriodMs);
+            return;
+        }
+
+        if (x == center)
+            x = (int16_t)(AutoX(w + glowSize * 2) + glowSize);
+        if (y == center)
+            y = (int16_t)(AutoY(h + glowSize * 2) + glowSize);
+
+        const uint16_t bg = detail::resolveOptionalColor565(bgColor, _render.bgColor565);
+        const int16_t pad = (int16_t)(glowSize + 2);
+        renderToSpriteAndInvalidate(
+            (int16_t)(x - pad), (int16_t)(y - pad),
+            (int16_t)(w + pad * 2), (int16_t)(h + pad * 2),
+            [&]
+            { drawGlowRect(x, y, w, h, radius, squircle, fillColor, (int16_t)bg, glowColor, glowSize, glowStrength, anim, pulsePeriodMs); });
+    }
+
 }
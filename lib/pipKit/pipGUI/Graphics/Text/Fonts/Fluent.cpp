@@ -5,9 +5,19 @@ namespace pipgui
     template <bool IsUpdate>
     void TextFluentT<IsUpdate>::draw()
     {
-        if (_text.length() == 0 || !beginCommit())
+        if ((!_run && _text.length() == 0) || !beginCommit())
             return;
 
+        if (_run)
+        {
+            detail::callByMode<IsUpdate>(
+                [&]
+                { detail::GuiAccess::updateText(*_gui, *_run, _x, _y, _fg565, _bg565, _align); },
+                [&]
+                { detail::GuiAccess::drawText(*_gui, *_run, _x, _y, _fg565, _bg565, _align); });
+            return;
+        }
+
         detail::TextFontGuard guard(_gui);
 
         if (_fontId && !_gui->setFont(*_fontId))
@@ -27,8 +37,14 @@ namespace pipgui
 
     void DrawTextMarqueeFluent::draw()
     {
-        if (_text.length() == 0 || _maxWidth <= 0 || !beginCommit())
+        if ((!_run && _text.length() == 0) || _maxWidth <= 0 || !beginCommit())
+            return;
+
+        if (_run)
+        {
+            detail::GuiAccess::drawTextMarquee(*_gui, *_run, _x, _y, _maxWidth, _fg565, _align, _opts);
             return;
+        }
 
         detail::TextFontGuard guard(_gui);
 
@@ -43,8 +59,14 @@ namespace pipgui
 
     void DrawTextEllipsizedFluent::draw()
     {
-        if (_text.length() == 0 || _maxWidth <= 0 || !beginCommit())
+        if ((!_run && _text.length() == 0) || _maxWidth <= 0 || !beginCommit())
+            return;
+
+        if (_run)
+        {
+            detail::GuiAccess::drawTextEllipsized(*_gui, *_run, _x, _y, _maxWidth, _fg565, _align);
             return;
+        }
 
         detail::TextFontGuard guard(_gui);
 
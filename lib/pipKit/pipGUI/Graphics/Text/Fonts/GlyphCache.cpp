@@ -0,0 +1,136 @@
+#include "GlyphCache.hpp"
+#include <pipGUI/Core/pipGUI.hpp>
+#include <pipGUI/Core/Internal/LruSlots.hpp>
+#include <cstring>
+
+namespace pipgui
+{
+    namespace detail
+    {
+        namespace
+        {
+            constexpr uint8_t kGlyphSlots = 192;
+            constexpr uint8_t kGlyphBuckets = 64;
+            constexpr uint8_t kNoSlot = 0xFF;
+
+            static inline uint8_t bucketFor(const void *glyph, uint16_t sizePx, uint16_t weight, uint8_t phase) noexcept
+            {
+                uint32_t h = (uint32_t)(uintptr_t)glyph;
+                h ^= (uint32_t)sizePx * 0x9E3779B1u;
+                h ^= (((uint32_t)weight << 8) | phase) * 0x85EBCA6Bu;
+                h ^= h >> 15;
+                return (uint8_t)(h & (kGlyphBuckets - 1));
+            }
+        }
+
+        struct GlyphCache::Slot
+        {
+            uint8_t *data = nullptr;
+            const void *glyph = nullptr;
+            uint32_t stamp = 0;
+            uint16_t sizePx = 0;
+            uint16_t weight = 0;
+            int16_t x = 0;
+            int16_t y = 0;
+            uint16_t w = 0;
+            uint16_t h = 0;
+            uint8_t phase = 0;
+            uint8_t next = kNoSlot;
+        };
+
+        void GlyphCache::releaseSlot(pipcore::Platform *plat, uint8_t index) noexcept
+        {
+            Slot &slot = _slots[index];
+            if (!slot.data)
+                return;
+
+            uint8_t *link = &_buckets[bucketFor(slot.glyph, slot.sizePx, slot.weight, slot.phase)];
+            while (*link != kNoSlot && *link != index)
+                link = &_slots[*link].next;
+            if (*link == index)
+                *link = slot.next;
+
+            detail::free(plat, slot.data);
+            _stats.bytes -= (uint32_t)slot.w * slot.h;
+            slot = Slot();
+        }
+
+        GlyphMask GlyphCache::find(const void *glyph, uint16_t sizePx, uint16_t weight, uint8_t phase) noexcept
+        {
+            if (!_slots)
+                return {nullptr, 0, 0, 0, 0};
+
+            for (uint8_t i = _buckets[bucketFor(glyph, sizePx, weight, phase)]; i != kNoSlot; i = _slots[i].next)
+            {
+                Slot &slot = _slots[i];
+                if (slot.glyph == glyph && slot.sizePx == sizePx && slot.weight == weight && slot.phase == phase)
+                {
+                    slot.stamp = ++_stamp;
+                    ++_stats.hits;
+                    return {slot.data, slot.x, slot.y, slot.w, slot.h};
+                }
+            }
+            ++_stats.misses;
+            return {nullptr, 0, 0, 0, 0};
+        }
+
+        uint8_t *GlyphCache::store(pipcore::Platform *plat, const void *glyph, uint16_t sizePx, uint16_t weight,
+                                   uint8_t phase, int16_t x, int16_t y, uint16_t w, uint16_t h) noexcept
+        {
+            const uint32_t bytes = (uint32_t)w * h;
+            // One glyph may take at most a quarter of the budget so a large size cannot flush the rest.
+            if (bytes == 0 || bytes > (uint32_t)PIPGUI_GLYPH_CACHE_BYTES / 4u)
+                return nullptr;
+
+            if (!_slots)
+            {
+                void *table = detail::alloc(plat, sizeof(Slot) * kGlyphSlots + kGlyphBuckets, pipcore::AllocCaps::PreferInternal);
+                if (!table)
+                    return nullptr;
+                _slots = static_cast<Slot *>(table);
+                for (uint8_t i = 0; i < kGlyphSlots; ++i)
+                    new (&_slots[i]) Slot();
+                _buckets = reinterpret_cast<uint8_t *>(_slots + kGlyphSlots);
+                memset(_buckets, kNoSlot, kGlyphBuckets);
+            }
+
+            Slot *victim = makeRoomLru(_slots, kGlyphSlots, _stats.bytes, bytes, (uint32_t)PIPGUI_GLYPH_CACHE_BYTES,
+                                       [&](Slot &slot)
+                                       { releaseSlot(plat, (uint8_t)(&slot - _slots)); });
+            if (!victim)
+                return nullptr;
+
+            uint8_t *data = static_cast<uint8_t *>(detail::alloc(plat, bytes, pipcore::AllocCaps::PreferInternal));
+            if (!data)
+                return nullptr;
+
+            Slot &slot = *victim;
+            slot.data = data;
+            slot.glyph = glyph;
+            slot.stamp = ++_stamp;
+            slot.sizePx = sizePx;
+            slot.weight = weight;
+            slot.x = x;
+            slot.y = y;
+            slot.w = w;
+            slot.h = h;
+            slot.phase = phase;
+            uint8_t &head = _buckets[bucketFor(glyph, sizePx, weight, phase)];
+            slot.next = head;
+            head = (uint8_t)(victim - _slots);
+            _stats.bytes += bytes;
+            return data;
+        }
+
+        void GlyphCache::clear(pipcore::Platform *plat) noexcept
+        {
+            if (!_slots)
+                return;
+            for (uint8_t i = 0; i < kGlyphSlots; ++i)
+                releaseSlot(plat, i);
+            detail::free(plat, _slots);
+            _slots = nullptr;
+            _buckets = nullptr;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <pipCore/Platform.hpp>
+
+namespace pipgui
+{
+    namespace detail
+    {
+        // Quarter-pixel pen phases per axis a glyph is rasterized at.
+        constexpr uint8_t kGlyphPhases = 4;
+
+        // Final 8-bit coverage of one glyph, w x h, row-major. (x, y) is its top-left pixel relative
+        // to the integer pen position. alpha stays valid until the next store() call.
+        struct GlyphMask
+        {
+            const uint8_t *alpha;
+            int16_t x;
+            int16_t y;
+            uint16_t w;
+            uint16_t h;
+        };
+
+        struct GlyphCacheStats
+        {
+            uint32_t bytes = 0;
+            uint32_t hits = 0;
+            uint32_t misses = 0;
+        };
+
+        // LRU of rendered glyph masks within PIPGUI_GLYPH_CACHE_BYTES. The slot table is allocated
+        // on the first store, so a GUI with the cache disabled or no text pays only for this object.
+        class GlyphCache
+        {
+        public:
+            GlyphCache() = default;
+            GlyphCache(const GlyphCache &) = delete;
+            GlyphCache &operator=(const GlyphCache &) = delete;
+
+            // phase packs the X phase in the low two bits and the Y phase above it.
+            [[nodiscard]] GlyphMask find(const void *glyph, uint16_t sizePx, uint16_t weight, uint8_t phase) noexcept;
+            [[nodiscard]] uint8_t *store(pipcore::Platform *plat, const void *glyph, uint16_t sizePx, uint16_t weight,
+                                         uint8_t phase, int16_t x, int16_t y, uint16_t w, uint16_t h) noexcept;
+            void clear(pipcore::Platform *plat) noexcept;
+
+            [[nodiscard]] const GlyphCacheStats &stats() const noexcept { return _stats; }
+
+        private:
+            struct Slot;
+
+            void releaseSlot(pipcore::Platform *plat, uint8_t index) noexcept;
+
+            Slot *_slots = nullptr;
+            uint8_t *_buckets = nullptr;
+            uint32_t _stamp = 0;
+            GlyphCacheStats _stats;
+        };
+    }
+}
@@ -333,18 +333,16 @@ namespace pipgui
         return s_cached;
     }
 
-    template <typename Fn>
-    static inline bool forEachGlyph(const char *s, int len, const FontData *font, float sizePx, uint16_t weight, Fn &&callback)
+    // Decodes len bytes of s into out, which must hold len entries, and returns the entry count.
+    static inline uint16_t shapeGlyphs(const char *s, int len, const FontData *font, float sizePx, uint16_t weight,
+                                       ShapedGlyph *out)
     {
-        static const FontData *s_cachedFont = nullptr;
-        static uint32_t s_cachedCodepoint = 0;
-        static const Glyph *s_cachedGlyph = nullptr;
-
+        const Glyph *glyphs = (const Glyph *)font->glyphs;
         const float spaceAdvance = spaceWidth(font) * sizePx;
-        const float lineAdvance = font->lineHeight * sizePx;
         const float trackingAdvance = fontTrackingPx(font, sizePx) + weightTrackingAdjustPx(weight, sizePx);
         float penX = 0.0f;
-        float penY = 0.0f;
+        uint16_t line = 0;
+        uint16_t count = 0;
         uint32_t prevCodepoint = 0;
 
         for (int i = 0; i < len;)
@@ -354,40 +352,23 @@ namespace pipgui
                 continue;
             if (codepoint == '\n')
             {
-                if (!callback(nullptr, penX, penY + font->ascender * sizePx, true))
-                    return false;
+                out[count++] = {penX, ShapedText::kLineBreak, line};
                 penX = 0.0f;
-                penY += lineAdvance;
+                ++line;
                 prevCodepoint = 0;
                 continue;
             }
-            if (codepoint == ' ')
+            if (codepoint == ' ' || codepoint == '\t')
             {
-                penX += spaceAdvance;
-                prevCodepoint = 0;
-                continue;
-            }
-            if (codepoint == '\t')
-            {
-                penX += spaceAdvance * 4.0f;
+                penX += (codepoint == ' ') ? spaceAdvance : spaceAdvance * 4.0f;
+                out[count++] = {penX, ShapedText::kSpace, line};
                 prevCodepoint = 0;
                 continue;
             }
 
-            const Glyph *glyph = nullptr;
-            if (font == s_cachedFont && codepoint == s_cachedCodepoint)
-            {
-                glyph = s_cachedGlyph;
-            }
-            else
-            {
-                glyph = findGlyph(font, codepoint);
-                if (!glyph)
-                    glyph = findGlyph(font, (uint32_t)'?');
-                s_cachedFont = font;
-                s_cachedCodepoint = codepoint;
-                s_cachedGlyph = glyph;
-            }
+            const Glyph *glyph = findGlyph(font, codepoint);
+            if (!glyph)
+                glyph = findGlyph(font, (uint32_t)'?');
             if (!glyph)
                 continue;
 
@@ -397,101 +378,114 @@ namespace pipgui
                 penX += fontKerningAdjustPx(font, prevCodepoint, codepoint, sizePx);
             }
 
-            if (!callback(glyph, penX, penY + font->ascender * sizePx, false))
-                return false;
+            out[count++] = {penX, (uint16_t)(glyph - glyphs), line};
             penX += glyph->unpackAdvance() * sizePx;
             prevCodepoint = codepoint;
         }
-        return true;
+        return count;
     }
 
-    static inline bool computeTextLayoutBox(const char *s, int len,
-                                            const FontData *font,
-                                            uint16_t sizePxU16,
-                                            uint16_t weight,
-                                            TextLayoutBox &out)
+    template <typename Fn>
+    static inline bool forEachShapedGlyph(const ShapedGlyph *run, uint16_t count, const FontData *font, float sizePx, Fn &&callback)
     {
-        out = {};
-        if (!font || sizePxU16 == 0)
-            return false;
-        if (len <= 0)
-            return true;
-
-        const float sizePx = (float)sizePxU16;
+        const Glyph *glyphs = (const Glyph *)font->glyphs;
         const float lineAdvance = font->lineHeight * sizePx;
-        const float padScale = sizePx * (1.0f / 128.0f);
+        const float ascent = font->ascender * sizePx;
+
+        for (uint16_t i = 0; i < count; ++i)
+        {
+            const ShapedGlyph &sg = run[i];
+            if (sg.glyph == ShapedText::kSpace)
+                continue;
+            const float penY = (float)sg.line * lineAdvance + ascent;
+            const bool nl = sg.glyph == ShapedText::kLineBreak;
+            if (!callback(nl ? nullptr : &glyphs[sg.glyph], sg.penX, penY, nl))
+                return false;
+        }
+        return true;
+    }
+
+    struct TextLayoutAccumulator
+    {
+        float sizePx;
+        float padScale;
+        float lineAdvance;
         float minX = 0.0f;
         float minY = 0.0f;
         float maxX = 0.0f;
-        float maxY = lineAdvance;
+        float maxY;
         float maxAdvanceX = 0.0f;
         uint16_t lines = 1;
         bool hasInk = false;
 
-        forEachGlyph(s, len, font, sizePx, weight,
-                     [&](const Glyph *g, float penX, float penY, bool nl) -> bool
-                     {
-                         if (nl)
-                         {
-                             if (penX > maxAdvanceX)
-                                 maxAdvanceX = penX;
-                             ++lines;
-                             return true;
-                         }
-                         if (!g)
-                             return true;
-
-                         const float advanceX = penX + g->unpackAdvance() * sizePx;
-                         if (advanceX > maxAdvanceX)
-                             maxAdvanceX = advanceX;
-
-                         const float gx0 = penX + (float)g->padLeft * padScale;
-                         const float gx1 = penX + (float)g->padRight * padScale;
-                         const float gy0 = penY - (float)g->padTop * padScale;
-                         const float gy1 = penY - (float)g->padBottom * padScale;
-
-                         if (!hasInk)
-                         {
-                             minX = gx0;
-                             minY = gy0;
-                             maxX = gx1;
-                             maxY = gy1;
-                             hasInk = true;
-                             return true;
-                         }
-
-                         if (gx0 < minX)
-                             minX = gx0;
-                         if (gy0 < minY)
-                             minY = gy0;
-                         if (gx1 > maxX)
-                             maxX = gx1;
-                         if (gy1 > maxY)
-                             maxY = gy1;
-                         return true;
-                     });
-
-        if (maxAdvanceX > maxX)
-            maxX = maxAdvanceX;
-        const float lineBottom = (float)lines * lineAdvance;
-        if (lineBottom > maxY)
-            maxY = lineBottom;
-        if (minX > 0.0f)
-            minX = 0.0f;
-        if (minY > 0.0f)
-            minY = 0.0f;
-
-        const int minXI = floorToInt(minX);
-        const int minYI = floorToInt(minY);
-        const int maxXI = ceilToInt(maxX);
-        const int maxYI = ceilToInt(maxY);
-        const int16_t weightExpandX = weightExpandXPxInt(weight, sizePx);
-        const int16_t weightExpandY = weightExpandYPxInt(weight, sizePx);
-
-        out.width = (int16_t)std::max(0, maxXI - minXI + weightExpandX * 2);
-        out.height = (int16_t)std::max(0, maxYI - minYI + weightExpandY * 2);
-        out.originX = (int16_t)(-minXI + weightExpandX);
-        out.originY = (int16_t)(-minYI + weightExpandY);
-        return true;
-    }
+        TextLayoutAccumulator(const FontData *font, float size)
+            : sizePx(size),
+              padScale(size * (1.0f / 128.0f)),
+              lineAdvance(font->lineHeight * size),
+              maxY(font->lineHeight * size)
+        {
+        }
+
+        bool operator()(const Glyph *g, float penX, float penY, bool nl)
+        {
+            if (nl)
+            {
+                if (penX > maxAdvanceX)
+                    maxAdvanceX = penX;
+                ++lines;
+                return true;
+            }
+            if (!g)
+                return true;
+
+            const float advanceX = penX + g->unpackAdvance() * sizePx;
+            if (advanceX > maxAdvanceX)
+                maxAdvanceX = advanceX;
+
+            const float gx0 = penX + (float)g->padLeft * padScale;
+            const float gx1 = penX + (float)g->padRight * padScale;
+            const float gy0 = penY - (float)g->padTop * padScale;
+            const float gy1 = penY - (float)g->padBottom * padScale;
+
+            if (!hasInk)
+            {
+                minX = gx0;
+                minY = gy0;
+                maxX = gx1;
+                maxY = gy1;
+                hasInk = true;
+                return true;
+            }
+
+            if (gx0 < minX)
+                minX = gx0;
+            if (gy0 < minY)
+                minY = gy0;
+            if (gx1 > maxX)
+                maxX = gx1;
+            if (gy1 > maxY)
+                maxY = gy1;
+            return true;
+        }
+
+        void finish(uint16_t weight, TextLayoutBox &out) const
+        {
+            const float x0 = std::min(minX, 0.0f);
+            const float y0 = std::min(minY, 0.0f);
+            const float x1 = std::max(maxX, maxAdvanceX);
+            const float y1 = std::max(maxY, (float)lines * lineAdvance);
+
+            const int minXI = floorToInt(x0);
+            const int minYI = floorToInt(y0);
+            const int maxXI = ceilToInt(x1);
+            const int maxYI = ceilToInt(y1);
+            const int16_t weightExpandX = weightExpandXPxInt(weight, sizePx);
+            const int16_t weightExpandY = weightExpandYPxInt(weight, sizePx);
+
+            out.width = (int16_t)std::max(0, maxXI - minXI + weightExpandX * 2);
+            out.height = (int16_t)std::max(0, maxYI - minYI + weightExpandY * 2);
+            out.originX = (int16_t)(-minXI + weightExpandX);
+            out.originY = (int16_t)(-minYI + weightExpandY);
+        }
+    };
 }
@@ -2,20 +2,35 @@
 
 namespace pipgui
 {
-    bool GUI::measureText(const String &text, int16_t &outW, int16_t &outH) const
+    namespace
     {
-        outW = outH = 0;
-        const FontData *font = fontDataForId(_typo.currentFontId);
-        if (!_typo.psdfSizePx || !font)
-            return false;
-        if (text.length() == 0)
-            return true;
+        // Byte length of the text behind the first n entries of its shaped run.
+        static unsigned int shapedPrefixBytes(const String &text, uint16_t n, const FontData *font)
+        {
+            const char *s = text.c_str();
+            const int len = (int)text.length();
+            int i = 0;
+            while (n > 0 && i < len)
+            {
+                const uint32_t codepoint = decodeUtf8(s, i, len);
+                if (codepoint == '\r')
+                    continue;
+                if (codepoint == '\n' || codepoint == ' ' || codepoint == '\t' ||
+                    findGlyph(font, codepoint) || findGlyph(font, (uint32_t)'?'))
+                    --n;
+            }
+            return (unsigned int)i;
+        }
+    }
 
-        TextLayoutBox box;
-        if (!computeTextLayoutBox(text.c_str(), (int)text.length(), font, _typo.psdfSizePx, _typo.psdfWeight, box))
+    bool GUI::measureText(const String &text, int16_t &outW, int16_t &outH)
+    {
+        outW = outH = 0;
+        const ShapedText *run = shapeText(text);
+        if (!run)
             return false;
-        outW = box.width;
-        outH = box.height;
+        outW = run->width();
+        outH = run->height();
         return true;
     }
 
@@ -25,16 +40,18 @@ namespace pipgui
     {
         if (maxWidth <= 0)
             return false;
+        const ShapedText *run = shapeText(text);
+        return run && drawTextMarquee(*run, x, y, maxWidth, fg565, align, opts);
+    }
 
-        const FontData *font = fontDataForId(_typo.currentFontId);
-        if (!_typo.psdfSizePx || !font)
-            return false;
-        TextLayoutBox box;
-        if (!computeTextLayoutBox(text.c_str(), (int)text.length(), font, _typo.psdfSizePx, _typo.psdfWeight, box) ||
-            box.width <= 0 || box.height <= 0)
+    bool GUI::drawTextMarquee(const ShapedText &run, int16_t x, int16_t y,
+                              int16_t maxWidth, uint16_t fg565,
+                              TextAlign align, const MarqueeTextOptions &opts)
+    {
+        if (maxWidth <= 0 || !run.valid() || run._width <= 0 || run._height <= 0)
             return false;
-        const int16_t tw = box.width;
-        const int16_t th = box.height;
+        const int16_t tw = run._width;
+        const int16_t th = run._height;
 
         int16_t boxX = (x == -1) ? AutoX((int32_t)maxWidth) : x;
         if (align == TextAlign::Center)
@@ -45,6 +62,8 @@ namespace pipgui
         const int16_t boxY = (y == -1) ? AutoY((int32_t)th) : y;
         if (tw <= maxWidth)
             return false;
+        if (quickReject(boxX, boxY, maxWidth, th))
+            return true;
 
         pipcore::Sprite *target = getDrawTarget();
         if (!target)
@@ -104,14 +123,11 @@ namespace pipgui
                 offsetPx = 0;
         }
 
-        const int16_t drawX = (int16_t)(boxX - offsetPx + box.originX);
-        drawTextImmediateMasked(text, drawX, (int16_t)(boxY + box.originY),
-                                tw, th, fg565, 0, TextAlign::Left, boxX, maxWidth, kMarqueeEdgeFadePx);
+        const int16_t drawX = (int16_t)(boxX - offsetPx + run._originX);
+        const int16_t drawY = (int16_t)(boxY + run._originY);
+        drawTextRun(run, drawX, drawY, fg565, boxX, maxWidth, kMarqueeEdgeFadePx);
         if (speedPxPerSec > 0 && loopPx > 0)
-        {
-            drawTextImmediateMasked(text, (int16_t)(drawX + loopPx), (int16_t)(boxY + box.originY),
-                                    tw, th, fg565, 0, TextAlign::Left, boxX, maxWidth, kMarqueeEdgeFadePx);
-        }
+            drawTextRun(run, (int16_t)(drawX + loopPx), drawY, fg565, boxX, maxWidth, kMarqueeEdgeFadePx);
 
         target->setClipRect(prevClipX, prevClipY, prevClipW, prevClipH);
         if (speedPxPerSec > 0)
@@ -125,46 +141,75 @@ namespace pipgui
     {
         if (maxWidth <= 0)
             return false;
+        const ShapedText *run = shapeText(text);
+        return run && drawTextEllipsized(*run, x, y, maxWidth, fg565, align);
+    }
 
-        int16_t tw = 0, th = 0;
-        if (!measureText(text, tw, th) || tw <= 0 || th <= 0)
+    bool GUI::drawTextEllipsized(const ShapedText &run, int16_t x, int16_t y,
+                                 int16_t maxWidth, uint16_t fg565,
+                                 TextAlign align)
+    {
+        if (maxWidth <= 0 || !run.valid() || run._width <= 0 || run._height <= 0)
             return false;
-        if (tw <= maxWidth)
+        if (run._width <= maxWidth)
             return false;
 
-        int16_t dotsW = 0, dotsH = 0;
-        const String dots("...");
-        if (!measureText(dots, dotsW, dotsH))
-            return false;
+        const FontData *font = fontDataForId(run._fontId);
+        const float sizePx = (float)run._sizePx;
+        ShapedGlyph dots[3];
+        const uint16_t dotCount = shapeGlyphs("...", 3, font, sizePx, run._weight, dots);
+        TextLayoutAccumulator dotsLayout(font, sizePx);
+        forEachShapedGlyph(dots, dotCount, font, sizePx, dotsLayout);
+        TextLayoutBox box;
+        dotsLayout.finish(run._weight, box);
 
-        String clipped;
-        if (dotsW >= maxWidth)
+        // Longest prefix that still fits with "..." appended, measured from the shaped run
+        // instead of re-shaping every candidate.
+        uint16_t keep = 0;
+        if (box.width < maxWidth)
         {
-            clipped = dots;
-        }
-        else
-        {
-            String candidate = text;
-            int16_t width = 0, height = 0;
-            while (candidate.length() > 0)
+            const Glyph *glyphs = (const Glyph *)font->glyphs;
+            const float trackingAdvance = fontTrackingPx(font, sizePx) + weightTrackingAdjustPx(run._weight, sizePx);
+            const float lineAdvance = font->lineHeight * sizePx;
+            const float ascent = font->ascender * sizePx;
+            TextLayoutAccumulator prefix(font, sizePx);
+            for (uint16_t n = 1; n < run._count; ++n)
             {
-                const size_t cut = prevUtf8Boundary(candidate, candidate.length());
-                candidate.remove(cut);
-                String trial = candidate + dots;
-                if (measureText(trial, width, height) && width <= maxWidth)
+                const ShapedGlyph &last = run._glyphs[n - 1];
+                forEachShapedGlyph(&last, 1, font, sizePx, prefix);
+
+                float dotsX = 0.0f;
+                uint16_t line = last.line;
+                if (last.glyph == ShapedText::kLineBreak)
+                {
+                    ++line;
+                }
+                else if (last.glyph == ShapedText::kSpace)
                 {
-                    clipped = trial;
-                    break;
+                    dotsX = last.penX;
                 }
+                else
+                {
+                    const Glyph &g = glyphs[last.glyph];
+                    dotsX = last.penX + g.unpackAdvance() * sizePx + trackingAdvance +
+                            fontKerningAdjustPx(font, g.codepoint, (uint32_t)'.', sizePx);
+                }
+
+                TextLayoutAccumulator trial = prefix;
+                const float dotsY = (float)line * lineAdvance + ascent;
+                for (uint16_t i = 0; i < dotCount; ++i)
+                    trial(&glyphs[dots[i].glyph], dotsX + dots[i].penX, dotsY, false);
+                trial.finish(run._weight, box);
+                if (box.width <= maxWidth)
+                    keep = n;
             }
-            if (clipped.length() == 0)
-                clipped = dots;
         }
 
-        if (clipped.length() == 0)
+        String clipped = run._text.substring(0, shapedPrefixBytes(run._text, keep, font));
+        clipped += "...";
+        if (!_textRun.shape(clipped, run._fontId, run._sizePx, run._weight))
             return false;
-
-        drawTextAligned(clipped, x, y, fg565, 0, align);
+        drawTextAligned(_textRun, x, y, fg565, 0, align);
         return true;
     }
 
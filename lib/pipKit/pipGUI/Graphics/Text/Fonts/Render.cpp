@@ -1,9 +1,13 @@
 #include "Internal.hpp"
+#include "GlyphCache.hpp"
+#include <pipGUI/Core/Debug.hpp>
 
 namespace pipgui
 {
     namespace
     {
+        constexpr int kCoverageSpanPx = 64;
+
         [[nodiscard]] uint32_t hashTextUpdateKey(int16_t x, int16_t y,
                                                  TextAlign align,
                                                  FontId fontId,
@@ -225,24 +229,117 @@ namespace pipgui
                     (uint32_t)v16 & 0xFFFFu};
             }
         };
+
+        struct GlyphAtlasStep
+        {
+            int32_t u0;
+            int32_t v0;
+            int32_t du;
+            int32_t dv;
+        };
+
+        static inline GlyphSampler glyphSamplerFor(pipcore::Platform *plat, const FontData *font, const Glyph *g)
+        {
+            const int glyphL = (int)g->atlasLeft;
+            const int glyphB = (int)g->atlasBottom;
+            return {
+                plat,
+                font->atlasData,
+                (int32_t)font->atlasWidth,
+                glyphL,
+                std::max(glyphL, (int)g->atlasRight - 1),
+                glyphB,
+                std::max(glyphB, (int)g->atlasTop - 1)};
+        }
+
+        static inline GlyphAtlasStep glyphAtlasStep(const Glyph *g, float gx0, float gy0, float gx1, float gy1,
+                                                    int ix0, int iy0)
+        {
+            const float gw = gx1 - gx0;
+            const float gh = gy1 - gy0;
+            const float invW = (gw != 0.f) ? 1.f / gw : 0.f;
+            const float invH = (gh != 0.f) ? 1.f / gh : 0.f;
+            const float atlasW = (float)(g->atlasRight - g->atlasLeft);
+            const float atlasH = (float)(g->atlasTop - g->atlasBottom);
+            return {
+                (int32_t)(((float)g->atlasLeft + atlasW * ((float)ix0 + 0.5f - gx0) * invW) * 65536.f),
+                (int32_t)(((float)g->atlasBottom + atlasH * ((float)iy0 + 0.5f - gy0) * invH) * 65536.f),
+                (int32_t)(atlasW * invW * 65536.f),
+                (int32_t)(atlasH * invH * 65536.f)};
+        }
+
+        static inline void sampleCoverageRow(const GlyphRowSampler &row, int32_t atlasU, int32_t atlasDu,
+                                             uint8_t *coverage, int n, const AlphaLut &lut, uint8_t s8Min)
+        {
+            for (int i = 0; i < n; ++i, atlasU += atlasDu)
+            {
+                const uint8_t s8 = row.sample(atlasU);
+                coverage[i] = (s8 <= s8Min) ? 0 : lut.values[s8];
+            }
+        }
+
+        // Returns the glyph's coverage at the given quarter-pixel pen phase, rasterizing it on a miss.
+        // alpha is null with w == 0 when the glyph covers no pixels, and with w > 0 when it could not be cached.
+        static detail::GlyphMask cachedGlyphMask(detail::GlyphCache &cache, pipcore::Platform *plat,
+                                                 const FontData *font, const Glyph *g,
+                                                 uint16_t sizePx, uint16_t weight, float padScale,
+                                                 uint8_t phaseX, uint8_t phaseY,
+                                                 const AlphaLut &lut, uint8_t s8Min)
+        {
+            const float penX = (float)phaseX * (1.0f / detail::kGlyphPhases);
+            const float penY = (float)phaseY * (1.0f / detail::kGlyphPhases);
+            const float gx0 = penX + (float)g->padLeft * padScale;
+            const float gy0 = penY - (float)g->padTop * padScale;
+            const float gx1 = penX + (float)g->padRight * padScale;
+            const float gy1 = penY - (float)g->padBottom * padScale;
+            const int ix0 = floorToInt(gx0);
+            const int iy0 = floorToInt(gy0);
+            const int w = ceilToInt(gx1) - ix0;
+            const int h = ceilToInt(gy1) - iy0;
+            if (w <= 0 || h <= 0)
+                return {nullptr, 0, 0, 0, 0};
+
+            const uint8_t phase = (uint8_t)(phaseX | (phaseY << 2));
+            detail::GlyphMask mask = cache.find(g, sizePx, weight, phase);
+            if (mask.alpha)
+                return mask;
+
+            mask = {nullptr, (int16_t)ix0, (int16_t)iy0, (uint16_t)w, (uint16_t)h};
+            uint8_t *alpha = cache.store(plat, g, sizePx, weight, phase, mask.x, mask.y, mask.w, mask.h);
+            if (!alpha)
+                return mask;
+
+            const GlyphSampler sampler = glyphSamplerFor(plat, font, g);
+            const GlyphAtlasStep step = glyphAtlasStep(g, gx0, gy0, gx1, gy1, ix0, iy0);
+            int32_t atlasV = step.v0;
+            for (int row = 0; row < h; ++row, atlasV += step.dv)
+                sampleCoverageRow(sampler.row(atlasV), step.u0, step.du, alpha + (uint32_t)row * w, w, lut, s8Min);
+            mask.alpha = alpha;
+            return mask;
+        }
+    }
+
+    const ShapedText *GUI::shapeText(const String &text)
+    {
+        return _textRun.shape(text, _typo.currentFontId, _typo.psdfSizePx, _typo.psdfWeight) ? &_textRun : nullptr;
     }
 
-    void GUI::drawTextImmediate(const String &text, int16_t rx, int16_t ry,
-                                int16_t tw, int16_t th,
-                                uint16_t fg565, uint16_t bg565, TextAlign align)
+    void GUI::drawTextRun(const char *text, int16_t rx, int16_t ry, uint16_t fg565)
     {
-        drawTextImmediateMasked(text, rx, ry, tw, th, fg565, bg565, align, 0, 0, 0);
+        _textRun._text = text;
+        if (_textRun.reshape(_typo.currentFontId, _typo.psdfSizePx, _typo.psdfWeight))
+            drawTextRun(_textRun, rx, ry, fg565, 0, 0, 0);
     }
 
-    void GUI::drawTextImmediateMasked(const String &text, int16_t rx, int16_t ry,
-                                      int16_t, int16_t,
-                                      uint16_t fg565, uint16_t, TextAlign,
-                                      int16_t fadeBoxX, int16_t fadeBoxW, uint8_t fadePx)
+    void GUI::drawTextRun(const ShapedText &run,
+                          int16_t rx, int16_t ry, uint16_t fg565,
+                          int16_t fadeBoxX, int16_t fadeBoxW, uint8_t fadePx)
     {
-        const FontData *font = fontDataForId(_typo.currentFontId);
-        if (!_typo.psdfSizePx || !font)
+        const FontData *font = fontDataForId(run._fontId);
+        if (!run.valid() || !font || run._count == 0)
             return;
 
+        DebugProbe probe(DebugPhase::Text);
         pipcore::Sprite *spr = getDrawTarget();
         if (!spr)
             return;
@@ -251,6 +348,7 @@ namespace pipgui
             return;
 
         const int16_t stride = spr->width(), maxH = spr->height();
+        const int16_t bufY = spr->bufferY();
         if (stride <= 0 || maxH <= 0)
             return;
 
@@ -268,11 +366,11 @@ namespace pipgui
         const float baseRx = (float)rx + _typo.subpixelOffsetX;
         const float baseRy = (float)ry + _typo.subpixelOffsetY;
 
-        const float sizePx = (float)_typo.psdfSizePx;
+        const float sizePx = (float)run._sizePx;
         const float distanceScale = font->distanceRange * (sizePx / font->nominalSizePx);
-        const float weightBias = weightBiasFor(_typo.psdfWeight, sizePx, font);
+        const float weightBias = weightBiasFor(run._weight, sizePx, font);
         const float readabilityBias = (distanceScale > 0.0001f) ? (readabilityDarkenPxFor(sizePx) / distanceScale) : 0.0f;
-        const float coverageGamma = weightCoverageGammaFor(_typo.psdfWeight) * readabilityGammaFor(sizePx);
+        const float coverageGamma = weightCoverageGammaFor(run._weight) * readabilityGammaFor(sizePx);
         const float edgeContrast = readabilityContrastFor(sizePx);
         const float biasOffset = 0.5f + weightBias;
         const float kScale = distanceScale * (1.f / 255.f);
@@ -284,180 +382,235 @@ namespace pipgui
 
         pipcore::Platform *const plat = platform();
         const float padScale = sizePx * (1.0f / 128.0f);
-
-        forEachGlyph(text.c_str(), (int)text.length(), font, sizePx, _typo.psdfWeight,
-                     [&](const Glyph *g, float penX, float penY, bool nl) -> bool
-                     {
-                         if (nl || !g)
-                             return true;
-
-                         const float absPenX = baseRx + penX;
-                         const float absPenY = baseRy + penY;
-                         const float padLeftPx = (float)g->padLeft * padScale;
-                         const float padRightPx = (float)g->padRight * padScale;
-                         const float padTopPx = (float)g->padTop * padScale;
-                         const float padBottomPx = (float)g->padBottom * padScale;
-                         const float gx0 = absPenX + padLeftPx;
-                         const float gy0 = absPenY - padTopPx;
-                         const float gx1 = absPenX + padRightPx;
-                         const float gy1 = absPenY - padBottomPx;
-
-                         int ix0 = floorToInt(gx0);
-                         int ix1 = ceilToInt(gx1);
-                         int iy0 = floorToInt(gy0);
-                         int iy1 = ceilToInt(gy1);
-
-                         if (ix1 <= clipX || iy1 <= clipY || ix0 >= clipR || iy0 >= clipB)
-                             return true;
-                         if (ix0 < clipX)
-                             ix0 = clipX;
-                         if (iy0 < clipY)
-                             iy0 = clipY;
-                         if (ix1 > clipR)
-                             ix1 = clipR;
-                         if (iy1 > clipB)
-                             iy1 = clipB;
-                         if (ix0 >= ix1 || iy0 >= iy1)
-                             return true;
-
-                         const float gw = gx1 - gx0;
-                         const float gh = gy1 - gy0;
-                         const float invW = (gw != 0.f) ? 1.f / gw : 0.f;
-                         const float invH = (gh != 0.f) ? 1.f / gh : 0.f;
-
-                         const int glyphL = (int)g->atlasLeft;
-                         const int glyphB = (int)g->atlasBottom;
-                         const int glyphR = std::max(glyphL, (int)g->atlasRight - 1);
-                         const int glyphT = std::max(glyphB, (int)g->atlasTop - 1);
-                         const float atlasW = (float)(g->atlasRight - g->atlasLeft);
-                         const float atlasH = (float)(g->atlasTop - g->atlasBottom);
-
-                         const int32_t atlasDu = (int32_t)(atlasW * invW * 65536.f);
-                         const int32_t atlasDv = (int32_t)(atlasH * invH * 65536.f);
-                         const int32_t atlasU0 = (int32_t)(((float)g->atlasLeft + atlasW * ((float)ix0 + 0.5f - gx0) * invW) * 65536.f);
-                         const int32_t atlasV0 = (int32_t)(((float)g->atlasBottom + atlasH * ((float)iy0 + 0.5f - gy0) * invH) * 65536.f);
-                         const GlyphSampler sampler{
-                             plat,
-                             font->atlasData,
-                             (int32_t)font->atlasWidth,
-                             glyphL,
-                             glyphR,
-                             glyphB,
-                             glyphT};
-
-                         int32_t atlasV = atlasV0;
-                         if (!useFade)
-                         {
-                             for (int py = iy0; py < iy1; ++py, atlasV += atlasDv)
-                             {
-                                 const GlyphRowSampler rowSampler = sampler.row(atlasV);
-                                 int32_t atlasU = atlasU0;
-                                 uint16_t *dst = buf + (int32_t)py * stride + ix0;
-                                 for (int px = ix0; px < ix1; ++px, ++dst, atlasU += atlasDu)
-                                 {
-                                     const uint8_t s8 = rowSampler.sample(atlasU);
-                                     if (s8 <= s8Min)
-                                         continue;
-                                     const uint8_t alpha = alphaLut.values[s8];
-                                     if (alpha)
-                                         blendNative565(dst, fg, alpha);
-                                 }
-                             }
-                         }
-                        else
-                        {
-                            const int fadeLeftEnd = fadeBoxX + fadePxClamped;
-                            const int fadeRightStart = fadeBoxR - fadePxClamped;
-                            for (int py = iy0; py < iy1; ++py, atlasV += atlasDv)
-                            {
-                                 const GlyphRowSampler rowSampler = sampler.row(atlasV);
-                                 int32_t atlasU = atlasU0;
-                                 uint16_t *dst = buf + (int32_t)py * stride + ix0;
-                                 int px = ix0;
-
-                                 for (; px < ix1 && px < fadeBoxX; ++px, ++dst, atlasU += atlasDu)
-                                 {
-                                 }
-
-                                 const int leftLimit = std::min(ix1, fadeLeftEnd);
-                                 for (; px < leftLimit; ++px, ++dst, atlasU += atlasDu)
-                                 {
-                                     const uint8_t edgeAlpha = detail::fadeEdgeAlpha(px, fadeBoxX, fadeBoxR, fadePxClamped);
-                                     if (edgeAlpha == 0)
-                                         continue;
-
-                                     const uint8_t s8 = rowSampler.sample(atlasU);
-                                     if (s8 <= s8Min)
-                                         continue;
-
-                                     uint16_t alpha = alphaLut.values[s8];
-                                     if (!alpha)
-                                         continue;
-                                     if (edgeAlpha < 255)
-                                     {
-                                         alpha = (uint16_t)((alpha * edgeAlpha + 127U) / 255U);
-                                         if (!alpha)
-                                             continue;
-                                     }
-                                     blendNative565(dst, fg, (uint8_t)alpha);
-                                 }
-
-                                 const int middleLimit = std::min(ix1, fadeRightStart);
-                                 for (; px < middleLimit; ++px, ++dst, atlasU += atlasDu)
-                                 {
-                                     const uint8_t s8 = rowSampler.sample(atlasU);
-                                     if (s8 <= s8Min)
-                                         continue;
-
-                                     const uint8_t alpha = alphaLut.values[s8];
-                                     if (alpha)
-                                         blendNative565(dst, fg, alpha);
-                                 }
-
-                                 const int rightLimit = std::min(ix1, fadeBoxR);
-                                 for (; px < rightLimit; ++px, ++dst, atlasU += atlasDu)
-                                 {
-                                     const uint8_t edgeAlpha = detail::fadeEdgeAlpha(px, fadeBoxX, fadeBoxR, fadePxClamped);
-                                     if (edgeAlpha == 0)
-                                         continue;
-
-                                     const uint8_t s8 = rowSampler.sample(atlasU);
-                                     if (s8 <= s8Min)
-                                         continue;
-
-                                     uint16_t alpha = alphaLut.values[s8];
-                                     if (!alpha)
-                                         continue;
-                                     if (edgeAlpha < 255)
-                                     {
-                                         alpha = (uint16_t)((alpha * edgeAlpha + 127U) / 255U);
-                                         if (!alpha)
-                                             continue;
-                                     }
-                                     blendNative565(dst, fg, (uint8_t)alpha);
-                                 }
-
-                                 for (; px < ix1; ++px, ++dst, atlasU += atlasDu)
-                                 {
-                                 }
-                             }
-                         }
-                         return true;
-                     });
+        const bool cacheGlyphs = PIPGUI_GLYPH_CACHE_BYTES > 0;
+
+        forEachShapedGlyph(run._glyphs, run._count, font, sizePx,
+                           [&](const Glyph *g, float penX, float penY, bool nl) -> bool
+                           {
+                               if (nl || !g)
+                                   return true;
+
+                               // The pen is snapped to the cache's quarter-pixel grid on both paths, so a
+                               // glyph too large to cache lands exactly where a cached one would.
+                               float absPenX = baseRx + penX;
+                               float absPenY = baseRy + penY;
+                               int penIx = floorToInt(absPenX);
+                               int penIy = floorToInt(absPenY);
+                               int phaseX = (int)((absPenX - (float)penIx) * detail::kGlyphPhases + 0.5f);
+                               int phaseY = (int)((absPenY - (float)penIy) * detail::kGlyphPhases + 0.5f);
+                               if (phaseX == detail::kGlyphPhases)
+                               {
+                                   ++penIx;
+                                   phaseX = 0;
+                               }
+                               if (phaseY == detail::kGlyphPhases)
+                               {
+                                   ++penIy;
+                                   phaseY = 0;
+                               }
+                               absPenX = (float)penIx + (float)phaseX * (1.0f / detail::kGlyphPhases);
+                               absPenY = (float)penIy + (float)phaseY * (1.0f / detail::kGlyphPhases);
+
+                               if (cacheGlyphs)
+                               {
+                                   const detail::GlyphMask mask = cachedGlyphMask(_glyphCache, plat, font, g, run._sizePx, run._weight,
+                                                                                  padScale, (uint8_t)phaseX, (uint8_t)phaseY,
+                                                                                  alphaLut, s8Min);
+                                   if (mask.alpha)
+                                   {
+                                       const int ox = penIx + mask.x;
+                                       const int oy = penIy + mask.y;
+                                       int x0 = std::max<int>(ox, clipX);
+                                       int x1 = std::min<int>(ox + mask.w, clipR);
+                                       const int y0 = std::max<int>(oy, clipY);
+                                       const int y1 = std::min<int>(oy + mask.h, clipB);
+                                       if (useFade)
+                                       {
+                                           x0 = std::max<int>(x0, fadeBoxX);
+                                           x1 = std::min<int>(x1, fadeBoxR);
+                                       }
+                                       if (x0 >= x1 || y0 >= y1)
+                                           return true;
+
+                                       for (int py = y0; py < y1; ++py)
+                                       {
+                                           const uint8_t *src = mask.alpha + (uint32_t)(py - oy) * mask.w + (x0 - ox);
+                                           uint16_t *dst = buf + (int32_t)(py - bufY) * stride + x0;
+                                           if (!useFade)
+                                           {
+                                               detail::blendCoverageSpan565(dst, src, x1 - x0, fg565);
+                                               continue;
+                                           }
+                                           for (int px = x0; px < x1; ++px, ++src, ++dst)
+                                           {
+                                               uint16_t alpha = *src;
+                                               if (!alpha)
+                                                   continue;
+                                               const uint8_t edgeAlpha = detail::fadeEdgeAlpha(px, fadeBoxX, fadeBoxR, fadePxClamped);
+                                               if (edgeAlpha < 255)
+                                               {
+                                                   alpha = (uint16_t)((alpha * edgeAlpha + 127U) / 255U);
+                                                   if (!alpha)
+                                                       continue;
+                                               }
+                                               blendNative565(dst, fg, (uint8_t)alpha);
+                                           }
+                                       }
+                                       return true;
+                                   }
+                                   if (mask.w == 0)
+                                       return true;
+                               }
+
+                               const float padLeftPx = (float)g->padLeft * padScale;
+                               const float padRightPx = (float)g->padRight * padScale;
+                               const float padTopPx = (float)g->padTop * padScale;
+                               const float padBottomPx = (float)g->padBottom * padScale;
+                               const float gx0 = absPenX + padLeftPx;
+                               const float gy0 = absPenY - padTopPx;
+                               const float gx1 = absPenX + padRightPx;
+                               const float gy1 = absPenY - padBottomPx;
+
+                               int ix0 = floorToInt(gx0);
+                               int ix1 = ceilToInt(gx1);
+                               int iy0 = floorToInt(gy0);
+                               int iy1 = ceilToInt(gy1);
+
+                               if (ix1 <= clipX || iy1 <= clipY || ix0 >= clipR || iy0 >= clipB)
+                                   return true;
+                               if (ix0 < clipX)
+                                   ix0 = clipX;
+                               if (iy0 < clipY)
+                                   iy0 = clipY;
+                               if (ix1 > clipR)
+                                   ix1 = clipR;
+                               if (iy1 > clipB)
+                                   iy1 = clipB;
+                               if (ix0 >= ix1 || iy0 >= iy1)
+                                   return true;
+
+                               const GlyphSampler sampler = glyphSamplerFor(plat, font, g);
+                               const GlyphAtlasStep step = glyphAtlasStep(g, gx0, gy0, gx1, gy1, ix0, iy0);
+                               const int32_t atlasU0 = step.u0;
+                               const int32_t atlasDu = step.du;
+                               const int32_t atlasDv = step.dv;
+
+                               int32_t atlasV = step.v0;
+                               if (!useFade)
+                               {
+                                   uint8_t coverage[kCoverageSpanPx];
+                                   for (int py = iy0; py < iy1; ++py, atlasV += atlasDv)
+                                   {
+                                       const GlyphRowSampler rowSampler = sampler.row(atlasV);
+                                       int32_t atlasU = atlasU0;
+                                       uint16_t *dst = buf + (int32_t)(py - bufY) * stride + ix0;
+                                       for (int px = ix0; px < ix1;)
+                                       {
+                                           const int run = std::min(ix1 - px, kCoverageSpanPx);
+                                           sampleCoverageRow(rowSampler, atlasU, atlasDu, coverage, run, alphaLut, s8Min);
+                                           detail::blendCoverageSpan565(dst, coverage, run, fg565);
+                                           atlasU += atlasDu * run;
+                                           dst += run;
+                                           px += run;
+                                       }
+                                   }
+                               }
+                              else
+                              {
+                                  const int fadeLeftEnd = fadeBoxX + fadePxClamped;
+                                  const int fadeRightStart = fadeBoxR - fadePxClamped;
+                                  for (int py = iy0; py < iy1; ++py, atlasV += atlasDv)
+                                  {
+                                       const GlyphRowSampler rowSampler = sampler.row(atlasV);
+                                       int32_t atlasU = atlasU0;
+                                       uint16_t *dst = buf + (int32_t)(py - bufY) * stride + ix0;
+                                       int px = ix0;
+
+                                       for (; px < ix1 && px < fadeBoxX; ++px, ++dst, atlasU += atlasDu)
+                                       {
+                                       }
+
+                                       const int leftLimit = std::min(ix1, fadeLeftEnd);
+                                       for (; px < leftLimit; ++px, ++dst, atlasU += atlasDu)
+                                       {
+                                           const uint8_t edgeAlpha = detail::fadeEdgeAlpha(px, fadeBoxX, fadeBoxR, fadePxClamped);
+                                           if (edgeAlpha == 0)
+                                               continue;
+
+                                           const uint8_t s8 = rowSampler.sample(atlasU);
+                                           if (s8 <= s8Min)
+                                               continue;
+
+                                           uint16_t alpha = alphaLut.values[s8];
+                                           if (!alpha)
+                                               continue;
+                                           if (edgeAlpha < 255)
+                                           {
+                                               alpha = (uint16_t)((alpha * edgeAlpha + 127U) / 255U);
+                                               if (!alpha)
+                                                   continue;
+                                           }
+                                           blendNative565(dst, fg, (uint8_t)alpha);
+                                       }
+
+                                       const int middleLimit = std::min(ix1, fadeRightStart);
+                                       for (; px < middleLimit; ++px, ++dst, atlasU += atlasDu)
+                                       {
+                                           const uint8_t s8 = rowSampler.sample(atlasU);
+                                           if (s8 <= s8Min)
+                                               continue;
+
+                                           const uint8_t alpha = alphaLut.values[s8];
+                                           if (alpha)
+                                               blendNative565(dst, fg, alpha);
+                                       }
+
+                                       const int rightLimit = std::min(ix1, fadeBoxR);
+                                       for (; px < rightLimit; ++px, ++dst, atlasU += atlasDu)
+                                       {
+                                           const uint8_t edgeAlpha = detail::fadeEdgeAlpha(px, fadeBoxX, fadeBoxR, fadePxClamped);
+                                           if (edgeAlpha == 0)
+                                               continue;
+
+                                           const uint8_t s8 = rowSampler.sample(atlasU);
+                                           if (s8 <= s8Min)
+                                               continue;
+
+                                           uint16_t alpha = alphaLut.values[s8];
+                                           if (!alpha)
+                                               continue;
+                                           if (edgeAlpha < 255)
+                                           {
+                                               alpha = (uint16_t)((alpha * edgeAlpha + 127U) / 255U);
+                                               if (!alpha)
+                                                   continue;
+                                           }
+                                           blendNative565(dst, fg, (uint8_t)alpha);
+                                       }
+
+                                       for (; px < ix1; ++px, ++dst, atlasU += atlasDu)
+                                       {
+                                       }
+                                   }
+                               }
+                               return true;
+                           });
     }
 
     void GUI::drawTextAligned(const String &text, int16_t x, int16_t y,
                               uint16_t fg565, uint16_t bg565, TextAlign align)
     {
-        const FontData *font = fontDataForId(_typo.currentFontId);
-        if (!_typo.psdfSizePx || !font)
-            return;
-        TextLayoutBox box;
-        if (!computeTextLayoutBox(text.c_str(), (int)text.length(), font, _typo.psdfSizePx, _typo.psdfWeight, box) ||
-            box.width <= 0 || box.height <= 0)
+        if (const ShapedText *run = shapeText(text))
+            drawTextAligned(*run, x, y, fg565, bg565, align);
+    }
+
+    void GUI::drawTextAligned(const ShapedText &run, int16_t x, int16_t y,
+                              uint16_t fg565, uint16_t, TextAlign align)
+    {
+        if (!run.valid() || run._width <= 0 || run._height <= 0)
             return;
-        const int16_t tw = box.width;
-        const int16_t th = box.height;
+        const int16_t tw = run._width;
+        const int16_t th = run._height;
 
         int16_t rx = (x == -1) ? AutoX((int32_t)tw) : x;
         if (align == TextAlign::Center)
@@ -466,33 +619,61 @@ namespace pipgui
             rx -= tw;
 
         const int16_t ry = (y == -1) ? AutoY((int32_t)th) : y;
-        drawTextImmediate(text,
-                          (int16_t)(rx + box.originX),
-                          (int16_t)(ry + box.originY),
-                          tw, th, fg565, bg565, align);
+        if (quickReject((int16_t)(rx - 2), (int16_t)(ry - 2), (int16_t)(tw + 4), (int16_t)(th + 4)))
+            return;
+        if (_displayList.recording)
+        {
+            const uint16_t len = (uint16_t)run._text.length();
+            const uint16_t payload = (uint16_t)(sizeof(detail::TypographyState) + len + 1);
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::Text, (int16_t)(rx - 2), (int16_t)(ry - 2),
+                                                         (int16_t)(tw + 4), (int16_t)(th + 4), payload))
+            {
+                detail::TypographyState typo = _typo;
+                typo.currentFontId = run._fontId;
+                typo.psdfSizePx = run._sizePx;
+                typo.psdfWeight = run._weight;
+                cmd->color = fg565;
+                cmd->v[0] = (int16_t)(rx + run._originX);
+                cmd->v[1] = (int16_t)(ry + run._originY);
+                cmd->v[2] = (int16_t)len;
+                uint8_t *dst = reinterpret_cast<uint8_t *>(cmd + 1);
+                memcpy(dst, &typo, sizeof(detail::TypographyState));
+                memcpy(dst + sizeof(detail::TypographyState), run._text.c_str(), (size_t)len + 1);
+            }
+            return;
+        }
+        drawTextRun(run, (int16_t)(rx + run._originX), (int16_t)(ry + run._originY), fg565, 0, 0, 0);
     }
 
     void GUI::drawText(const String &text, int16_t x, int16_t y,
                        uint16_t fg565, uint16_t bg565, TextAlign align)
+    {
+        if (const ShapedText *run = shapeText(text))
+            drawText(*run, x, y, fg565, bg565, align);
+    }
+
+    void GUI::drawText(const ShapedText &run, int16_t x, int16_t y,
+                       uint16_t fg565, uint16_t bg565, TextAlign align)
     {
         if (!_flags.spriteEnabled || _flags.inSpritePass || !_disp.display)
-            return drawTextAligned(text, x, y, fg565, bg565, align);
-        updateText(text, x, y, fg565, bg565, align);
+            return drawTextAligned(run, x, y, fg565, bg565, align);
+        updateText(run, x, y, fg565, bg565, align);
     }
 
     void GUI::updateText(const String &text, int16_t x, int16_t y,
                          uint16_t fg565, uint16_t bg565, TextAlign align)
     {
-        const FontData *font = fontDataForId(_typo.currentFontId);
-        if (!_typo.psdfSizePx || !font)
-            return;
+        if (const ShapedText *run = shapeText(text))
+            updateText(*run, x, y, fg565, bg565, align);
+    }
 
-        TextLayoutBox box;
-        if (!computeTextLayoutBox(text.c_str(), (int)text.length(), font, _typo.psdfSizePx, _typo.psdfWeight, box) ||
-            box.width <= 0 || box.height <= 0)
+    void GUI::updateText(const ShapedText &run, int16_t x, int16_t y,
+                         uint16_t fg565, uint16_t bg565, TextAlign align)
+    {
+        if (!run.valid() || run._width <= 0 || run._height <= 0)
             return;
-        const int16_t tw = box.width;
-        const int16_t th = box.height;
+        const int16_t tw = run._width;
+        const int16_t th = run._height;
 
         int16_t rx = (x == -1) ? AutoX((int32_t)tw) : x;
         if (align == TextAlign::Center)
@@ -501,8 +682,8 @@ namespace pipgui
             rx -= tw;
         const int16_t ry = (y == -1) ? AutoY((int32_t)th) : y;
 
-        const float drawXf = (float)(rx + box.originX) + _typo.subpixelOffsetX;
-        const float drawYf = (float)(ry + box.originY) + _typo.subpixelOffsetY;
+        const float drawXf = (float)(rx + run._originX) + _typo.subpixelOffsetX;
+        const float drawYf = (float)(ry + run._originY) + _typo.subpixelOffsetY;
         const int drawX0 = floorToInt(drawXf);
         const int drawY0 = floorToInt(drawYf);
         const int drawX1 = ceilToInt(drawXf + tw);
@@ -515,7 +696,7 @@ namespace pipgui
         const uint32_t now = nowMs();
         detail::TextCacheEntry &cacheEntry = resolveTextCacheEntry(
             _textCache,
-            hashTextUpdateKey(x, y, align, _typo.currentFontId, _typo.psdfSizePx, _typo.psdfWeight),
+            hashTextUpdateKey(x, y, align, run._fontId, run._sizePx, run._weight),
             now);
 
         int16_t clearX = newX;
@@ -540,10 +721,7 @@ namespace pipgui
         _render.activeSprite = &_render.sprite;
 
         drawRect().pos(clearX, clearY).size(clearW, clearH).fill(bg565).draw();
-        drawTextImmediate(text,
-                          (int16_t)(rx + box.originX),
-                          (int16_t)(ry + box.originY),
-                          tw, th, fg565, bg565, align);
+        drawTextRun(run, (int16_t)(rx + run._originX), (int16_t)(ry + run._originY), fg565, 0, 0, 0);
 
         _flags.inSpritePass = prevRender;
         _render.activeSprite = prevActive;
@@ -0,0 +1,93 @@
+#include "Internal.hpp"
+
+namespace pipgui
+{
+    ShapedText::~ShapedText()
+    {
+        detail::free(nullptr, _glyphs);
+    }
+
+    ShapedText::ShapedText(ShapedText &&other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    ShapedText &ShapedText::operator=(ShapedText &&other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        detail::free(nullptr, _glyphs);
+        _text = std::move(other._text);
+        _glyphs = other._glyphs;
+        _count = other._count;
+        _capacity = other._capacity;
+        _fontId = other._fontId;
+        _sizePx = other._sizePx;
+        _weight = other._weight;
+        _width = other._width;
+        _height = other._height;
+        _originX = other._originX;
+        _originY = other._originY;
+
+        other._glyphs = nullptr;
+        other._capacity = 0;
+        other.clear();
+        return *this;
+    }
+
+    bool ShapedText::shape(const String &text, FontId fontId, uint16_t sizePx, uint16_t weight)
+    {
+        if (&text != &_text)
+            _text = text;
+        return reshape(fontId, sizePx, weight);
+    }
+
+    bool ShapedText::reshape(FontId fontId, uint16_t sizePx, uint16_t weight)
+    {
+        clear();
+        const FontData *font = fontDataForId(fontId);
+        if (!font || sizePx == 0)
+            return false;
+
+        const uint16_t len = (uint16_t)std::min<unsigned int>(_text.length(), 0xFFFFu);
+        if (len > _capacity)
+        {
+            ShapedGlyph *glyphs = static_cast<ShapedGlyph *>(detail::alloc(nullptr, sizeof(ShapedGlyph) * len,
+                                                                           pipcore::AllocCaps::Default));
+            if (!glyphs)
+                return false;
+            detail::free(nullptr, _glyphs);
+            _glyphs = glyphs;
+            _capacity = len;
+        }
+
+        weight = clampFontWeight(weight);
+        TextLayoutBox box;
+        if (len > 0)
+        {
+            _count = shapeGlyphs(_text.c_str(), len, font, (float)sizePx, weight, _glyphs);
+            TextLayoutAccumulator layout(font, (float)sizePx);
+            forEachShapedGlyph(_glyphs, _count, font, (float)sizePx, layout);
+            layout.finish(weight, box);
+        }
+
+        _fontId = fontId;
+        _sizePx = sizePx;
+        _weight = weight;
+        _width = box.width;
+        _height = box.height;
+        _originX = box.originX;
+        _originY = box.originY;
+        return true;
+    }
+
+    void ShapedText::clear() noexcept
+    {
+        _count = 0;
+        _sizePx = 0;
+        _weight = 0;
+        _width = _height = 0;
+        _originX = _originY = 0;
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <pipGUI/Core/Types.hpp>
+
+namespace pipgui
+{
+    // One character of a shaped run. glyph indexes the font's glyph table. Spaces and tabs
+    // (ShapedText::kSpace) hold the pen after them, line breaks (kLineBreak) the pen before.
+    struct ShapedGlyph
+    {
+        float penX;
+        uint16_t glyph;
+        uint16_t line;
+    };
+
+    // Text decoded and laid out once for a font, size and weight: glyph lookups, kerning,
+    // pen positions and the layout box. Draw it any number of times without re-shaping.
+    class ShapedText
+    {
+    public:
+        static constexpr uint16_t kSpace = 0xFFFF;
+        static constexpr uint16_t kLineBreak = 0xFFFE;
+
+        ShapedText() = default;
+        ~ShapedText();
+        ShapedText(const ShapedText &) = delete;
+        ShapedText &operator=(const ShapedText &) = delete;
+        ShapedText(ShapedText &&other) noexcept;
+        ShapedText &operator=(ShapedText &&other) noexcept;
+
+        bool shape(const String &text, FontId fontId, uint16_t sizePx, uint16_t weight = Medium);
+        void clear() noexcept;
+
+        [[nodiscard]] bool valid() const noexcept { return _sizePx != 0; }
+        [[nodiscard]] bool matches(FontId fontId, uint16_t sizePx, uint16_t weight) const noexcept
+        {
+            return valid() && _fontId == fontId && _sizePx == sizePx && _weight == weight;
+        }
+        [[nodiscard]] const String &text() const noexcept { return _text; }
+        [[nodiscard]] FontId fontId() const noexcept { return _fontId; }
+        [[nodiscard]] uint16_t fontSize() const noexcept { return _sizePx; }
+        [[nodiscard]] uint16_t fontWeight() const noexcept { return _weight; }
+        [[nodiscard]] int16_t width() const noexcept { return _width; }
+        [[nodiscard]] int16_t height() const noexcept { return _height; }
+
+    private:
+        friend class GUI;
+
+        bool reshape(FontId fontId, uint16_t sizePx, uint16_t weight);
+
+        String _text;
+        ShapedGlyph *_glyphs = nullptr;
+        uint16_t _count = 0;
+        uint16_t _capacity = 0;
+        FontId _fontId = WixMadeForDisplay;
+        uint16_t _sizePx = 0;
+        uint16_t _weight = 0;
+        int16_t _width = 0;
+        int16_t _height = 0;
+        int16_t _originX = 0;
+        int16_t _originY = 0;
+    };
+}
@@ -10,6 +10,8 @@ namespace pipgui
 {
     namespace
     {
+        constexpr int16_t kCoverageSpanPx = 64;
+
         struct AlphaLut
         {
             uint8_t values[256];
@@ -253,6 +255,25 @@ namespace pipgui
         if (ic.w == 0 || ic.h == 0)
             return;
 
+        const int16_t rx = (x == -1) ? AutoX((int32_t)sizePx) : x;
+        const int16_t ry = (y == -1) ? AutoY((int32_t)sizePx) : y;
+        if (quickReject((int16_t)(rx - 2), (int16_t)(ry - 2), (int16_t)(sizePx + 4), (int16_t)(sizePx + 4)))
+            return;
+
+        if (_displayList.recording)
+        {
+            if (detail::DrawCommand *cmd = recordCommand(detail::DrawOp::Icon, (int16_t)(rx - 2), (int16_t)(ry - 2),
+                                                         (int16_t)(sizePx + 4), (int16_t)(sizePx + 4)))
+            {
+                cmd->color = fg565;
+                cmd->v[0] = rx;
+                cmd->v[1] = ry;
+                cmd->v[2] = (int16_t)sizePx;
+                cmd->v[3] = (int16_t)iconId;
+            }
+            return;
+        }
+
         pipcore::Sprite *spr = getDrawTarget();
         if (!spr)
             return;
@@ -261,6 +282,7 @@ namespace pipgui
             return;
 
         const int16_t stride = spr->width(), maxH = spr->height();
+        const int16_t bufY = spr->bufferY();
         if (stride <= 0 || maxH <= 0)
             return;
 
@@ -284,9 +306,6 @@ namespace pipgui
             inset = (int16_t)((int32_t)sizePx - (int32_t)renderSizePx) / 2;
         }
 
-        const int16_t rx = (x == -1) ? AutoX((int32_t)sizePx) : x;
-        const int16_t ry = (y == -1) ? AutoY((int32_t)sizePx) : y;
-
         const int16_t drawX = (int16_t)(rx + inset);
         const int16_t drawY = (int16_t)(ry + inset);
 
@@ -314,7 +333,6 @@ namespace pipgui
         const AlphaLut &alphaLut = alphaLutFor(kScale, kOffset);
         const uint8_t s8Min = alphaLut.firstNonZero;
 
-        const NativeColor565 fg = makeNativeColor565(fg565);
         pipcore::Platform *const plat = platform();
 
         const int32_t duFP = (int32_t)((float)ic.w / (float)renderSizePx * 65536.f);
@@ -323,22 +341,25 @@ namespace pipgui
         const int32_t u0FP = (int32_t)((float)ic.x * 65536.f) + (int32_t)(((float)(ix0 - drawX) + 0.5f) / (float)renderSizePx * (float)ic.w * 65536.f);
         const int32_t v0FP = (int32_t)((float)ic.y * 65536.f) + (int32_t)(((float)(iy0 - drawY) + 0.5f) / (float)renderSizePx * (float)ic.h * 65536.f);
 
+        uint8_t coverage[kCoverageSpanPx];
         int32_t vFP = v0FP;
         for (int16_t py = iy0; py < iy1; ++py, vFP += dvFP)
         {
             const IconRowSampler rowSampler = makeIconRowSampler(plat, icons, vFP, atlasW, atlasH);
             int32_t uFP = u0FP;
-            uint16_t *dst = buf + (int32_t)py * stride + ix0;
+            uint16_t *dst = buf + (int32_t)(py - bufY) * stride + ix0;
 
-            for (int16_t px = ix0; px < ix1; ++px, ++dst, uFP += duFP)
+            for (int16_t px = ix0; px < ix1;)
             {
-                const uint8_t s8 = rowSampler.sample(uFP);
-                if (s8 <= s8Min)
-                    continue;
-
-                const uint8_t alpha = alphaLut.values[s8];
-                if (alpha)
-                    blendNative565(dst, fg, alpha);
+                const int16_t run = (ix1 - px < kCoverageSpanPx) ? (int16_t)(ix1 - px) : kCoverageSpanPx;
+                for (int16_t i = 0; i < run; ++i, uFP += duFP)
+                {
+                    const uint8_t s8 = rowSampler.sample(uFP);
+                    coverage[i] = (s8 <= s8Min) ? 0 : alphaLut.values[s8];
+                }
+                detail::blendCoverageSpan565(dst, coverage, run, fg565);
+                dst += run;
+                px = (int16_t)(px + run);
             }
         }
     }
@@ -384,6 +405,11 @@ namespace pipgui
         if (icon.layerCount == 0 || icon.frameCount == 0 || icon.width == 0 || icon.height == 0)
             return;
 
+        const int16_t rx = (x == -1) ? AutoX((int32_t)sizePx) : x;
+        const int16_t ry = (y == -1) ? AutoY((int32_t)sizePx) : y;
+        if (quickReject((int16_t)(rx - 3), (int16_t)(ry - 3), (int16_t)(sizePx + 6), (int16_t)(sizePx + 6)))
+            return;
+
         pipcore::Sprite *spr = getDrawTarget();
         if (!spr)
             return;
@@ -391,14 +417,12 @@ namespace pipgui
         if (!buf)
             return;
 
-        const int16_t rx = (x == -1) ? AutoX((int32_t)sizePx) : x;
-        const int16_t ry = (y == -1) ? AutoY((int32_t)sizePx) : y;
-
         const float box = (float)sizePx;
         const float scale = box / (float)((icon.width > icon.height) ? icon.width : icon.height);
         const float drawW = (float)icon.width * scale;
         const int16_t stride = spr->width();
         const int16_t maxH = spr->height();
+        const int16_t bufY = spr->bufferY();
         if (stride <= 0 || maxH <= 0)
             return;
 
@@ -480,7 +504,7 @@ namespace pipgui
 
             for (int16_t py = iy0; py < iy1; ++py)
             {
-                uint16_t *dst = buf + (int32_t)py * stride + ix0;
+                uint16_t *dst = buf + (int32_t)(py - bufY) * stride + ix0;
                 for (int16_t px = ix0; px < ix1; ++px, ++dst)
                 {
                     const float sx = inverse.m00 * ((float)px + 0.5f) + inverse.m01 * ((float)py + 0.5f) + inverse.m02;
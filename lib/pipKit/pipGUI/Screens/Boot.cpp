@@ -90,6 +90,11 @@ namespace pipgui
         setFontWeight(prevWeight);
     }
 
+    void GUI::renderBootBand()
+    {
+        drawBootTitleBlock(_boot.title, _boot.subtitle, _boot.fg565, kBootBg565);
+    }
+
     void GUI::startLogo(const String &t, const String &s, BootAnimation a)
     {
         _flags.bootActive = 1;
@@ -121,6 +126,7 @@ namespace pipgui
                 _flags.inSpritePass = 1;
             }
 
+            _boot.fg565 = fg565;
             drawBootTitleBlock(_boot.title, _boot.subtitle, fg565, kBootBg565);
 
             _flags.inSpritePass = prevSpritePass;
@@ -175,21 +175,12 @@ namespace pipgui
 
         auto withClip = [&](int16_t x, int16_t y, int16_t w, int16_t h, auto &&drawFn)
         {
-            pipcore::Sprite *sprite = getDrawTarget();
-            if (!sprite)
+            if (!getDrawTarget())
                 return;
 
-            const ClipState prevGuiClip = _clip;
-            int32_t clipX = 0;
-            int32_t clipY = 0;
-            int32_t clipW = 0;
-            int32_t clipH = 0;
-            sprite->getClipRect(&clipX, &clipY, &clipW, &clipH);
-            applyClip(x, y, w, h);
-            sprite->setClipRect(x, y, w, h);
+            pushClip(x, y, w, h);
             drawFn();
-            _clip = prevGuiClip;
-            sprite->setClipRect((int16_t)clipX, (int16_t)clipY, (int16_t)clipW, (int16_t)clipH);
+            popClip();
         };
 
         auto measureLine = [&](const String &text, uint16_t px, uint16_t weight, int16_t &width, int16_t &height)
@@ -65,8 +65,7 @@ namespace pipgui
     {
         if (_shotStream.buffer)
         {
-            if (plat)
-                detail::free(plat, _shotStream.buffer);
+            _scratch.release(plat, _shotStream.buffer);
             _shotStream.buffer = nullptr;
         }
 #if (PIPGUI_SCREENSHOT_MODE == 2)
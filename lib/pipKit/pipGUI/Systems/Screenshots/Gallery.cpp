@@ -308,7 +308,7 @@ namespace pipgui
 #if !PIPGUI_SCREENSHOTS
         return;
 #else
-        if (!_flags.spriteEnabled || _render.screenWidth == 0 || _render.screenHeight == 0)
+        if (!_flags.spriteEnabled || bandedRender() || _render.screenWidth == 0 || _render.screenHeight == 0)
             return;
         const uint16_t *src = static_cast<const uint16_t *>(_render.sprite.getBuffer());
         if (!src)
@@ -1,4 +1,5 @@
 #include <pipGUI/Systems/Screenshots/Internals.hpp>
+#include <pipGUI/Graphics/Draw/ShapeMask.hpp>
 #include <cstdio>
 #include <cstring>
 
@@ -161,6 +162,7 @@ namespace pipgui
         }
 
         [[nodiscard]] bool snapshotSpriteBuffer(pipcore::Platform *plat,
+                                                detail::ScratchPool &scratch,
                                                 const void *src,
                                                 uint32_t bytes,
                                                 detail::ScreenshotStreamState &stream) noexcept
@@ -168,7 +170,7 @@ namespace pipgui
             if (!plat || !src || bytes == 0)
                 return false;
 
-            void *mem = detail::alloc(plat, bytes, pipcore::AllocCaps::Default);
+            void *mem = scratch.acquire(plat, bytes, pipcore::AllocCaps::Default, true);
             if (!mem)
                 return false;
 
@@ -183,7 +185,7 @@ namespace pipgui
 #if !PIPGUI_SCREENSHOTS
         return;
 #else
-        if (_shotStream.active || !_flags.spriteEnabled || !_disp.display)
+        if (_shotStream.active || !_flags.spriteEnabled || bandedRender() || !_disp.display)
             return;
 
         const uint16_t w = _render.screenWidth;
@@ -207,13 +209,15 @@ namespace pipgui
             resetScreenshotStreamState(plat);
         };
 
-        bool haveSnapshot = snapshotSpriteBuffer(plat, src, snapshotBytes, _shotStream);
+        bool haveSnapshot = snapshotSpriteBuffer(plat, _scratch, src, snapshotBytes, _shotStream);
         if (!haveSnapshot)
         {
-            freeBlurBuffers(plat);
+            _scratch.dropIdle(plat);
+            detail::clearShapeMaskCache();
+            _glyphCache.clear(plat);
             releaseGalleryScratch(plat, _shots);
             releaseGalleryThumbPixels(plat, _shots);
-            haveSnapshot = snapshotSpriteBuffer(plat, src, snapshotBytes, _shotStream);
+            haveSnapshot = snapshotSpriteBuffer(plat, _scratch, src, snapshotBytes, _shotStream);
         }
 
         if (!haveSnapshot)
@@ -123,6 +123,7 @@ namespace pipgui
             uint16_t *buf = static_cast<uint16_t *>(spr->getBuffer());
             const int16_t bufW = spr->width();
             const int16_t bufH = spr->height();
+            const int32_t bufY = spr->bufferY();
 
             if (visible == 0)
             {
@@ -147,7 +148,7 @@ namespace pipgui
                         sx = bufW - 1;
                     if (sy >= bufH)
                         sy = bufH - 1;
-                    bg565 = pipcore::Sprite::swap16(buf[(size_t)sy * (size_t)bufW + (size_t)sx]);
+                    bg565 = pipcore::Sprite::swap16(buf[(size_t)(sy - bufY) * (size_t)bufW + (size_t)sx]);
                 }
 
                 const bool bgBright = (detail::autoTextColor(bg565) == 0x0000);
@@ -190,7 +191,7 @@ namespace pipgui
             {
                 for (uint8_t dy = 0; dy < r; ++dy)
                 {
-                    const uint16_t *src = buf + (int32_t)(oy + dy) * bufW + ox;
+                    const uint16_t *src = buf + (int32_t)(oy + dy - bufY) * bufW + ox;
                     std::memcpy(dst + (size_t)dy * kMaxR, src, (size_t)r * sizeof(uint16_t));
                 }
             };
@@ -198,7 +199,7 @@ namespace pipgui
             {
                 for (uint8_t dy = 0; dy < r; ++dy)
                 {
-                    uint16_t *dst = buf + (int32_t)(oy + dy) * bufW + ox;
+                    uint16_t *dst = buf + (int32_t)(oy + dy - bufY) * bufW + ox;
                     for (uint8_t dx = 0; dx < r; ++dx)
                     {
                         const int32_t ddx = right ? dx : (int32_t)r - 1 - dx;
@@ -271,7 +272,7 @@ namespace pipgui
                         sy = clipY1;
                     if (sy >= clipY2)
                         sy = clipY2 - 1;
-                    const uint16_t stored = buf[(size_t)sy * (size_t)bufW + (size_t)sx];
+                    const uint16_t stored = buf[(size_t)(sy - bufY) * (size_t)bufW + (size_t)sx];
                     bg565 = pipcore::Sprite::swap16(stored);
                 }
 
@@ -448,6 +448,7 @@ namespace pipgui
             uint16_t *buf = static_cast<uint16_t *>(t->getBuffer());
             const int32_t stride = t->width();
             const int32_t height = t->height();
+            const int32_t bufY = t->bufferY();
             if (!buf || stride <= 0 || height <= 0)
                 return false;
 
@@ -466,7 +467,7 @@ namespace pipgui
             const bool leftToRight = (area.direction == LeftToRight);
             for (int16_t y = 0; y < area.innerH; ++y)
             {
-                uint16_t *row = buf + static_cast<size_t>(area.innerY + y) * stride + area.innerX;
+                uint16_t *row = buf + static_cast<size_t>(area.innerY + y - bufY) * stride + area.innerX;
                 if (leftToRight)
                 {
                     std::memmove(row, row + 1, static_cast<size_t>(area.innerW - 1) * sizeof(uint16_t));
@@ -529,6 +530,7 @@ namespace pipgui
                 uint16_t *buf = static_cast<uint16_t *>(t->getBuffer());
                 const int32_t stride = t->width();
                 const int32_t height = t->height();
+                const int32_t bufY = t->bufferY();
                 if (buf && stride > 0 && height > 0)
                 {
                     int32_t clipX = 0;
@@ -551,7 +553,7 @@ namespace pipgui
                         const size_t rowBytes = static_cast<size_t>(copyW) * sizeof(uint16_t);
                         for (int16_t y = 0; y < copyH; ++y)
                         {
-                            uint16_t *dst = buf + static_cast<size_t>(copyY + y) * stride + copyX;
+                            uint16_t *dst = buf + static_cast<size_t>(copyY + y - bufY) * stride + copyX;
                             const uint16_t *src = mutableArea.innerCache + static_cast<size_t>(srcY + y) * area.innerW + srcX;
                             std::memcpy(dst, src, rowBytes);
                         }
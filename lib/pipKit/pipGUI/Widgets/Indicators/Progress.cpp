@@ -319,17 +319,11 @@ namespace pipgui
             break;
         }
 
-        auto target = getDrawTarget();
-        if (!target)
+        if (!getDrawTarget())
             return;
-        const ClipState prevGuiClip = _clip;
-        int32_t prevClipX = 0, prevClipY = 0, prevClipW = 0, prevClipH = 0;
-        target->getClipRect(&prevClipX, &prevClipY, &prevClipW, &prevClipH);
-        applyClip(clipX, y, clipW, h);
-        target->setClipRect(clipX, y, clipW, h);
+        pushClip(clipX, y, clipW, h);
         drawTextAligned(text, tx, ty, textColor565, bgColor565, TextAlign::Left);
-        _clip = prevGuiClip;
-        target->setClipRect(prevClipX, prevClipY, prevClipW, prevClipH);
+        popClip();
 
         setFontSize(prevSize);
         setFontWeight(prevWeight);
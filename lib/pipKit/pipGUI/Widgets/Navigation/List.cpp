@@ -87,9 +87,8 @@ namespace pipgui
 
     static void resetListItemCache(ListState::Item &item)
     {
-        item.titleW = item.titleH = item.subW = item.subH = 0;
-        item.cachedTitlePx = item.cachedSubPx = 0;
-        item.cachedTitleWeight = item.cachedSubWeight = 0;
+        item.titleRun.clear();
+        item.subRun.clear();
     }
 
     static void resetListRuntime(ListState &menu)
@@ -564,32 +563,22 @@ namespace pipgui
                 setFontSize(px);
             };
 
-            auto ensureTextMetrics = [&](ListState::Item &item,
-                                         uint16_t titlePx, uint16_t titleWeight,
-                                         bool hasSub, uint16_t subPx, uint16_t subWeight)
+            auto ensureTextRuns = [&](ListState::Item &item,
+                                      uint16_t titlePx, uint16_t titleWeight,
+                                      bool hasSub, uint16_t subPx, uint16_t subWeight)
             {
-                if (item.cachedTitlePx != titlePx || item.cachedTitleWeight != titleWeight)
-                {
-                    setTextFont(titleWeight, titlePx);
-                    measureText(item.title, item.titleW, item.titleH);
-                    item.cachedTitlePx = titlePx;
-                    item.cachedTitleWeight = titleWeight;
-                }
+                const FontId fontId = _typo.currentFontId;
+                if (!item.titleRun.matches(fontId, titlePx, titleWeight))
+                    item.titleRun.shape(item.title, fontId, titlePx, titleWeight);
 
                 if (hasSub && subPx > 0)
                 {
-                    if (item.cachedSubPx != subPx || item.cachedSubWeight != subWeight)
-                    {
-                        setTextFont(subWeight, subPx);
-                        measureText(item.subtitle, item.subW, item.subH);
-                        item.cachedSubPx = subPx;
-                        item.cachedSubWeight = subWeight;
-                    }
+                    if (!item.subRun.matches(fontId, subPx, subWeight))
+                        item.subRun.shape(item.subtitle, fontId, subPx, subWeight);
                 }
                 else
                 {
-                    item.subW = item.subH = 0;
-                    item.cachedSubPx = item.cachedSubWeight = 0;
+                    item.subRun.clear();
                 }
             };
 
@@ -617,7 +606,7 @@ namespace pipgui
             constexpr uint16_t TITLE_WEIGHT = 600;
             constexpr uint16_t SUBTITLE_WEIGHT = 500;
             const MarqueeTextOptions marqueeOpts(28, 700, menu.marqueeStartMs);
-            const auto drawTextLine = [&](const String &text,
+            const auto drawTextLine = [&](const ShapedText &run,
                                           int16_t textX,
                                           float textY,
                                           int16_t textMaxWidth,
@@ -632,15 +621,15 @@ namespace pipgui
                 _typo.subpixelOffsetY = textY - (float)textYInt;
                 if (active)
                 {
-                    if (!drawTextMarquee(text, textX, textYInt, textMaxWidth, fg, TextAlign::Left, marqueeOpts))
-                        drawTextAligned(text, textX, textYInt, fg, bg, TextAlign::Left);
+                    if (!drawTextMarquee(run, textX, textYInt, textMaxWidth, fg, TextAlign::Left, marqueeOpts))
+                        drawTextAligned(run, textX, textYInt, fg, bg, TextAlign::Left);
                     _typo.subpixelOffsetX = prevSubX;
                     _typo.subpixelOffsetY = prevSubY;
                     return;
                 }
 
-                if (!drawTextEllipsized(text, textX, textYInt, textMaxWidth, fg, TextAlign::Left))
-                    drawTextAligned(text, textX, textYInt, fg, bg, TextAlign::Left);
+                if (!drawTextEllipsized(run, textX, textYInt, textMaxWidth, fg, TextAlign::Left))
+                    drawTextAligned(run, textX, textYInt, fg, bg, TextAlign::Left);
                 _typo.subpixelOffsetX = prevSubX;
                 _typo.subpixelOffsetY = prevSubY;
             };
@@ -683,18 +672,19 @@ namespace pipgui
                         titlePx = 18;
                     titlePx = scaleU16(titlePx, previewScaleY, 10);
 
-                    ensureTextMetrics(item, titlePx, TITLE_WEIGHT, false, 0, 0);
+                    ensureTextRuns(item, titlePx, TITLE_WEIGHT, false, 0, 0);
+                    const int16_t titleH = item.titleRun.height();
 
                     const int16_t itemClipY = itemY + 2;
                     const int16_t itemClipH = cardH - 4;
-                    if (itemClipH <= 0 || item.titleH > itemClipH)
+                    if (itemClipH <= 0 || titleH > itemClipH)
                         continue;
 
-                    float baseY = posY + 2.0f + (float)(itemClipH - item.titleH) * 0.5f;
+                    float baseY = posY + 2.0f + (float)(itemClipH - titleH) * 0.5f;
                     if (baseY < (float)itemClipY)
                         baseY = (float)itemClipY;
 
-                    if (baseY + item.titleH <= (float)contentTop || baseY >= (float)contentBottom)
+                    if (baseY + titleH <= (float)contentTop || baseY >= (float)contentBottom)
                         continue;
 
                     int32_t prevItemClipX = 0, prevItemClipY = 0, prevItemClipW = 0, prevItemClipH = 0;
@@ -704,7 +694,7 @@ namespace pipgui
                     target->setClipRect(textClipX, itemClipY, textClipW, itemClipH);
 
                     setTextFont(TITLE_WEIGHT, titlePx);
-                    drawTextLine(item.title, textX, baseY, textMaxWidth, textColor, bg, active);
+                    drawTextLine(item.titleRun, textX, baseY, textMaxWidth, textColor, bg, active);
 
                     if (checked)
                     {
@@ -779,21 +769,23 @@ namespace pipgui
                 if (gapPx > 0)
                     gapPx = scaleU16(gapPx, previewScaleY, 1);
 
-                ensureTextMetrics(item, titlePx, TITLE_WEIGHT, hasSub, subPx, SUBTITLE_WEIGHT);
+                ensureTextRuns(item, titlePx, TITLE_WEIGHT, hasSub, subPx, SUBTITLE_WEIGHT);
+                const int16_t titleH = item.titleRun.height();
+                const int16_t subH = item.subRun.height();
 
                 const int16_t itemClipY = itemY + 4;
                 const int16_t itemClipH = cardH - 8;
-                if (itemClipH <= 0 || item.titleH > itemClipH)
+                if (itemClipH <= 0 || titleH > itemClipH)
                     continue;
 
-                bool showSub = hasSub && subPx > 0 && item.subH > 0;
-                int16_t totalH = item.titleH;
+                bool showSub = hasSub && subPx > 0 && subH > 0;
+                int16_t totalH = titleH;
                 if (showSub)
-                    totalH += gapPx + item.subH;
+                    totalH += gapPx + subH;
                 if (showSub && totalH > itemClipH)
                 {
                     showSub = false;
-                    totalH = item.titleH;
+                    totalH = titleH;
                 }
 
                 float baseY = posY + 4.0f + (float)(itemClipH - totalH) * 0.5f;
@@ -801,7 +793,7 @@ namespace pipgui
                     baseY = (float)itemClipY;
 
                 const float titleY = baseY;
-                const float subY = baseY + item.titleH + (showSub ? gapPx : 0);
+                const float subY = baseY + titleH + (showSub ? gapPx : 0);
                 int32_t prevItemClipX = 0, prevItemClipY = 0, prevItemClipW = 0, prevItemClipH = 0;
                 target->getClipRect(&prevItemClipX, &prevItemClipY, &prevItemClipW, &prevItemClipH);
                 const ClipState prevItemGuiClip = _clip;
@@ -809,12 +801,12 @@ namespace pipgui
                 target->setClipRect(textClipX, itemClipY, textClipW, itemClipH);
 
                 setTextFont(TITLE_WEIGHT, titlePx);
-                drawTextLine(item.title, textX, titleY, textMaxWidth, textColor, bg, active);
+                drawTextLine(item.titleRun, textX, titleY, textMaxWidth, textColor, bg, active);
 
                 if (showSub)
                 {
                     setTextFont(SUBTITLE_WEIGHT, subPx);
-                    drawTextLine(subtitle, textX, subY, textMaxWidth, subColor, bg, active);
+                    drawTextLine(item.subRun, textX, subY, textMaxWidth, subColor, bg, active);
                 }
 
                 if (checked)
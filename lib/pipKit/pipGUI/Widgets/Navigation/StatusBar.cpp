@@ -374,8 +374,7 @@ namespace pipgui
             if (_status.style != Blur)
                 return;
 
-            const ClipState prevClip = _clip;
-            applyClip(bar.x, bar.y, bar.w, bar.h);
+            pushClip(bar.x, bar.y, bar.w, bar.h);
 
             const ScreenCallback currentCb = (_screen.current < _screen.capacity && _screen.callbacks)
                                                  ? _screen.callbacks[_screen.current]
@@ -385,13 +384,15 @@ namespace pipgui
             else
                 clear(_render.bgColor565 ? _render.bgColor565 : (uint16_t)_render.bgColor);
 
-            _clip = prevClip;
+            popClip();
         };
 
         if (_flags.statusBarDebugMetrics || _status.custom)
         {
             redrawBlurBackdrop();
+            ++_blurCache.hold;
             invalidateRect(bar.x, bar.y, bar.w, bar.h);
+            --_blurCache.hold;
             renderStatusBar();
             _status.dirtyMask = 0;
             return;
@@ -456,23 +457,25 @@ namespace pipgui
         {
             redrawBlurBackdrop();
             renderStatusBar();
+            // Text over the frosted bar is not backdrop, so the bar's blur cache stays valid.
+            ++_blurCache.hold;
             for (uint8_t i = 0; i < dirtyCount; ++i)
             {
                 const DirtyRect &dirty = dirtyRects[i];
                 invalidateRect(dirty.x, dirty.y, dirty.w, dirty.h);
             }
+            --_blurCache.hold;
         }
         else
         {
-            const ClipState prevClip = _clip;
             for (uint8_t i = 0; i < dirtyCount; ++i)
             {
                 const DirtyRect &dirty = dirtyRects[i];
                 invalidateRect(dirty.x, dirty.y, dirty.w, dirty.h);
-                applyClip(dirty.x, dirty.y, dirty.w, dirty.h);
+                pushClip(dirty.x, dirty.y, dirty.w, dirty.h);
                 renderStatusBar();
+                popClip();
             }
-            _clip = prevClip;
         }
 
         _status.dirtyMask &= (uint8_t)~(mask);
@@ -498,6 +501,8 @@ namespace pipgui
         if (!_flags.statusBarEnabled || _status.height == 0)
             return;
 
+        DebugProbe probe(DebugPhase::StatusBar);
+
         bool prevRender = _flags.inSpritePass;
         pipcore::Sprite *prevActive = _render.activeSprite;
 
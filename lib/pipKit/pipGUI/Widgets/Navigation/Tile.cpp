@@ -326,9 +326,8 @@ namespace pipgui
 
     static void resetTileItemCache(TileState::Item &item)
     {
-        item.titleW = item.titleH = item.subW = item.subH = 0;
-        item.cachedTitlePx = item.cachedSubPx = 0;
-        item.cachedTitleWeight = item.cachedSubWeight = 0;
+        item.titleRun.clear();
+        item.subRun.clear();
     }
 
     static bool initTileItem(TileState::Item &item, const TileItemDef &def)
@@ -705,32 +704,22 @@ namespace pipgui
             setFontSize(px);
         };
 
-        auto ensureTextMetrics = [&](TileState::Item &item,
-                                     uint16_t titlePx, uint16_t titleWeight,
-                                     bool hasSub, uint16_t subPx, uint16_t subWeight)
+        auto ensureTextRuns = [&](TileState::Item &item,
+                                  uint16_t titlePx, uint16_t titleWeight,
+                                  bool hasSub, uint16_t subPx, uint16_t subWeight)
         {
-            if (item.cachedTitlePx != titlePx || item.cachedTitleWeight != titleWeight)
-            {
-                setTextFont(titleWeight, titlePx);
-                measureText(item.title, item.titleW, item.titleH);
-                item.cachedTitlePx = titlePx;
-                item.cachedTitleWeight = titleWeight;
-            }
+            const FontId fontId = _typo.currentFontId;
+            if (!item.titleRun.matches(fontId, titlePx, titleWeight))
+                item.titleRun.shape(item.title, fontId, titlePx, titleWeight);
 
             if (hasSub && subPx > 0)
             {
-                if (item.cachedSubPx != subPx || item.cachedSubWeight != subWeight)
-                {
-                    setTextFont(subWeight, subPx);
-                    measureText(item.subtitle, item.subW, item.subH);
-                    item.cachedSubPx = subPx;
-                    item.cachedSubWeight = subWeight;
-                }
+                if (!item.subRun.matches(fontId, subPx, subWeight))
+                    item.subRun.shape(item.subtitle, fontId, subPx, subWeight);
             }
             else
             {
-                item.subW = item.subH = 0;
-                item.cachedSubPx = item.cachedSubWeight = 0;
+                item.subRun.clear();
             }
         };
 
@@ -749,7 +738,7 @@ namespace pipgui
         };
 
         const MarqueeTextOptions marqueeOpts(28, 700, m.marqueeStartMs);
-        auto drawTextLine = [&](const String &text,
+        auto drawTextLine = [&](const ShapedText &run,
                                 int16_t centerX,
                                 int16_t y,
                                 int16_t maxWidth,
@@ -759,12 +748,12 @@ namespace pipgui
         {
             if (active)
             {
-                if (!drawTextMarquee(text, centerX, y, maxWidth, fg, TextAlign::Center, marqueeOpts))
-                    drawTextAligned(text, centerX, y, fg, bg, TextAlign::Center);
+                if (!drawTextMarquee(run, centerX, y, maxWidth, fg, TextAlign::Center, marqueeOpts))
+                    drawTextAligned(run, centerX, y, fg, bg, TextAlign::Center);
             }
-            else if (!drawTextEllipsized(text, centerX, y, maxWidth, fg, TextAlign::Center))
+            else if (!drawTextEllipsized(run, centerX, y, maxWidth, fg, TextAlign::Center))
             {
-                drawTextAligned(text, centerX, y, fg, bg, TextAlign::Center);
+                drawTextAligned(run, centerX, y, fg, bg, TextAlign::Center);
             }
         };
 
@@ -781,7 +770,6 @@ namespace pipgui
             const bool active = (i == m.selectedIndex);
 
             TileState::Item &it = m.items[i];
-            const String &title = it.title;
             const String &sub = it.subtitle;
             const bool hasIcon = (it.iconId != 0xFFFF && it.iconId < psdf_icons::IconCount);
             const bool hasSub = (m.style.contentMode == TextSubtitle && sub.length() > 0);
@@ -817,19 +805,21 @@ namespace pipgui
             if (gapPx > 0)
                 gapPx = scaleU16(gapPx, previewScaleY, 1);
 
-            ensureTextMetrics(it, titlePx, 600, hasSub, subPx, 500);
+            ensureTextRuns(it, titlePx, 600, hasSub, subPx, 500);
+            const int16_t titleH = it.titleRun.height();
+            const int16_t subH = it.subRun.height();
 
-            bool showSub = hasSub && subPx > 0 && it.subH > 0;
+            bool showSub = hasSub && subPx > 0 && subH > 0;
             int16_t iconSize = hasIcon ? (int16_t)std::min<int16_t>((int16_t)(tileH / (hasSub ? 3 : 2)), (int16_t)(tileW / 3)) : 0;
             int16_t iconGap = hasIcon ? (int16_t)((tileH >= 84) ? 8 : 6) : 0;
             iconGap = (int16_t)scaleU16((uint16_t)iconGap, previewScaleY, 2);
-            int16_t textBlockH = it.titleH;
+            int16_t textBlockH = titleH;
             if (showSub)
-                textBlockH += gapPx + it.subH;
+                textBlockH += gapPx + subH;
             if (showSub && textBlockH + (iconSize > 0 ? iconSize + iconGap : 0) > contentClipH)
             {
                 showSub = false;
-                textBlockH = it.titleH;
+                textBlockH = titleH;
             }
             if (iconSize > 0)
             {
@@ -852,9 +842,9 @@ namespace pipgui
                     }
                 }
             }
-            int16_t blockH = it.titleH;
+            int16_t blockH = titleH;
             if (showSub)
-                blockH += gapPx + it.subH;
+                blockH += gapPx + subH;
             if (iconSize > 0)
                 blockH += iconSize + iconGap;
             if (blockH > contentClipH)
@@ -878,15 +868,15 @@ namespace pipgui
             }
 
             const int16_t titleY = contentY;
-            const int16_t subY = contentY + it.titleH + (showSub ? gapPx : 0);
+            const int16_t subY = contentY + titleH + (showSub ? gapPx : 0);
 
             setTextFont(600, titlePx);
-            drawTextLine(title, centerX, titleY, textMaxWidth, txtCol, bg, active);
+            drawTextLine(it.titleRun, centerX, titleY, textMaxWidth, txtCol, bg, active);
 
             if (showSub)
             {
                 setTextFont(500, subPx);
-                drawTextLine(sub, centerX, subY, textMaxWidth, subCol, bg, active);
+                drawTextLine(it.subRun, centerX, subY, textMaxWidth, subCol, bg, active);
             }
 
             _clip = prevGuiClip;
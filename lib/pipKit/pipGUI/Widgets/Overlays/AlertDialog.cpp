@@ -1,4 +1,5 @@
 #include <pipGUI/Core/pipGUI.hpp>
+#include <pipGUI/Core/Debug.hpp>
 
 namespace pipgui
 {
@@ -148,6 +149,8 @@ namespace pipgui
         if (!_flags.notifActive)
             return;
 
+        DebugProbe probe(DebugPhase::Overlays);
+
         uint32_t now = nowMs();
         uint32_t elapsed = (now >= _notif.startMs) ? (now - _notif.startMs) : 0;
         uint32_t dur = _notif.animDurationMs ? _notif.animDurationMs : 1;
@@ -172,10 +175,17 @@ namespace pipgui
                 dim = 255.0f;
             const uint32_t factor = (uint32_t)(256.0f - dim);
 
-            uint16_t *buf = (uint16_t *)_render.sprite.getBuffer();
+            pipcore::Sprite *spr = getDrawTarget();
+            uint16_t *buf = spr ? (uint16_t *)spr->getBuffer() : nullptr;
             if (buf)
             {
-                const size_t len = _render.screenWidth * _render.screenHeight;
+                const int32_t stride = spr->width();
+                const int32_t bufY = spr->bufferY();
+                int32_t clipX = 0;
+                int32_t clipY = 0;
+                int32_t clipW = 0;
+                int32_t clipH = 0;
+                spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
                 uint8_t lut5[32];
                 uint8_t lut6[64];
 
@@ -184,14 +194,18 @@ namespace pipgui
                 for (uint8_t v = 0; v < 64; ++v)
                     lut6[v] = (uint8_t)(((uint32_t)v * factor) >> 8);
 
-                for (size_t i = 0; i < len; ++i)
+                for (int32_t yy = clipY; yy < clipY + clipH; ++yy)
                 {
-                    uint16_t px = __builtin_bswap16(buf[i]);
-                    const uint16_t r = lut5[(px >> 11) & 0x1F];
-                    const uint16_t g = lut6[(px >> 5) & 0x3F];
-                    const uint16_t b = lut5[px & 0x1F];
-                    px = (uint16_t)((r << 11) | (g << 5) | b);
-                    buf[i] = __builtin_bswap16(px);
+                    uint16_t *row = buf + (size_t)(yy - bufY) * stride;
+                    for (int32_t xx = clipX; xx < clipX + clipW; ++xx)
+                    {
+                        uint16_t px = __builtin_bswap16(row[xx]);
+                        const uint16_t r = lut5[(px >> 11) & 0x1F];
+                        const uint16_t g = lut6[(px >> 5) & 0x3F];
+                        const uint16_t b = lut5[px & 0x1F];
+                        px = (uint16_t)((r << 11) | (g << 5) | b);
+                        row[xx] = __builtin_bswap16(px);
+                    }
                 }
             }
 
@@ -1,4 +1,5 @@
 #include <pipGUI/Core/pipGUI.hpp>
+#include <pipGUI/Core/Debug.hpp>
 #include <pipGUI/Core/API/Builders/Base.hpp>
 #include <pipGUI/Core/Internal/ViewModels.hpp>
 #include <pipGUI/Graphics/Utils/Easing.hpp>
@@ -182,9 +183,8 @@ namespace pipgui
             item.subtitle = String();
             item.targetScreen = INVALID_SCREEN_ID;
             item.iconId = 0xFFFF;
-            item.titleW = item.titleH = item.subW = item.subH = 0;
-            item.cachedTitlePx = item.cachedSubPx = 0;
-            item.cachedTitleWeight = item.cachedSubWeight = 0;
+            item.titleRun.clear();
+            item.subRun.clear();
             return true;
         }
     }
@@ -394,6 +394,8 @@ namespace pipgui
         if (!_flags.popupActive || _popup.list.itemCount == 0 || !_popup.items)
             return;
 
+        DebugProbe probe(DebugPhase::Overlays);
+
         const uint32_t dur = _popup.animDurationMs ? _popup.animDurationMs : 1;
         uint32_t elapsed = now - _popup.startMs;
         if (elapsed > dur)
@@ -415,15 +417,10 @@ namespace pipgui
         if (!computePopupOverlayFrame(_popup, _flags.popupActive, _flags.popupClosing, now, frame))
             return;
 
-        auto *target = getDrawTarget();
-        if (!target)
+        if (!getDrawTarget())
             return;
 
-        const ClipState prevGuiClip = _clip;
-        int32_t clipX = 0, clipY = 0, clipW = 0, clipH = 0;
-        target->getClipRect(&clipX, &clipY, &clipW, &clipH);
-        applyClip(frame.x, frame.y, frame.w, frame.revealH);
-        target->setClipRect(frame.x, frame.y, frame.w, frame.revealH);
+        pushClip(frame.x, frame.y, frame.w, frame.revealH);
 
         const uint16_t shadow565 = (uint16_t)detail::blend565((uint16_t)0x0000, _popup.bg565, 80);
         drawSquircleRect()
@@ -439,8 +436,7 @@ namespace pipgui
             .border(1, _popup.border565);
         renderListState(_popup.list, frame.x + 8, frame.y + 8, frame.w - 16, frame.visibleCount * _popup.itemHeight, _popup.bg565, false);
 
-        _clip = prevGuiClip;
-        target->setClipRect(clipX, clipY, clipW, clipH);
+        popClip();
     }
 
     bool GUI::computePopupBounds(uint32_t now, DirtyRect &outRect)
@@ -1,4 +1,5 @@
 #include <pipGUI/Core/pipGUI.hpp>
+#include <pipGUI/Core/Debug.hpp>
 
 namespace pipgui
 {
@@ -62,12 +63,13 @@ namespace pipgui
         _toast.lastRectValid = false;
         _toast.fromTop = fromTop;
         _toast.iconId = iconId;
+        _layers.slots[detail::TOAST_LAYER].ready = false;
 
         const bool hasText = (_toast.text.length() > 0);
         const bool hasIcon = (_toast.iconId < psdf_icons::IconCount);
         if (!hasText && !hasIcon)
         {
-            _flags.toastActive = 0;
+            hideToast();
             return;
         }
         _toast.startMs = nowMs();
@@ -93,6 +95,15 @@ namespace pipgui
         }
     }
 
+    void GUI::hideToast() noexcept
+    {
+        _flags.toastActive = 0;
+        detail::LayerSlot &layer = _layers.slots[detail::TOAST_LAYER];
+        layer.sprite.deleteSprite();
+        layer.coverage.release();
+        layer.ready = false;
+    }
+
     bool GUI::toastActive() const
     {
         return _flags.toastActive && (_toast.text.length() > 0 || _toast.iconId < psdf_icons::IconCount);
@@ -106,7 +117,7 @@ namespace pipgui
             return false;
         if (_toast.text.length() == 0 && _toast.iconId >= psdf_icons::IconCount)
         {
-            _flags.toastActive = 0;
+            hideToast();
             return false;
         }
 
@@ -114,7 +125,7 @@ namespace pipgui
         const uint32_t totalDur = _toast.animDurMs * 2 + kToastDisplayMs;
         if (elapsed >= totalDur)
         {
-            _flags.toastActive = 0;
+            hideToast();
             return false;
         }
 
@@ -130,7 +141,7 @@ namespace pipgui
             const float phaseProgress = (float)exitElapsed / (float)_toast.animDurMs;
             if (phaseProgress >= 1.0f)
             {
-                _flags.toastActive = 0;
+                hideToast();
                 return false;
             }
             visualP = 1.0f - toastExitEase(phaseProgress);
@@ -218,9 +229,11 @@ namespace pipgui
     {
         if (!_flags.toastActive)
             return;
+
+        DebugProbe probe(DebugPhase::Overlays);
         if (_toast.text.length() == 0 && _toast.iconId >= psdf_icons::IconCount)
         {
-            _flags.toastActive = 0;
+            hideToast();
             return;
         }
 
@@ -232,7 +245,7 @@ namespace pipgui
 
         if (elapsed >= totalDur)
         {
-            _flags.toastActive = 0;
+            hideToast();
             return;
         }
 
@@ -248,7 +261,7 @@ namespace pipgui
             const float phaseProgress = (float)exitElapsed / (float)_toast.animDurMs;
             if (phaseProgress >= 1.0f)
             {
-                _flags.toastActive = 0;
+                hideToast();
                 return;
             }
             visualP = 1.0f - toastExitEase(phaseProgress);
@@ -332,50 +345,83 @@ namespace pipgui
             .radius((uint8_t)(drawRadius > 2 ? drawRadius - 2 : drawRadius))
             .fill(bgColor);
 
-        int16_t textX = boxX + (drawW - tw) / 2;
-        const int16_t textY = boxY + (drawH - th) / 2;
+        // Static content is rasterized once into the toast layer and recomposited as the box
+        // slides. Icon and text share fgColor, so the layer keeps only their coverage (L8, half
+        // the bytes of RGB565) and is tinted back on composite, with edges blended per pixel
+        // against whatever lies under them. Scrolling text changes every frame and is still
+        // drawn directly.
         const int16_t textMaxW = (int16_t)max<int16_t>(24, drawW - padH * 2 - (hasIcon ? (iconSide + iconGap) : 0));
-
-        if (hasIcon && hasText)
+        const bool staticContent = !hasText || tw <= textMaxW;
+        const int16_t layerX = padH;
+        const int16_t layerY = (hasIcon && iconSide > th) ? (int16_t)((drawH - iconSide) / 2) : padV;
+        const int16_t layerW = (int16_t)(drawW - padH * 2);
+        const int16_t layerH = (int16_t)(drawH - layerY * 2);
+        const detail::LayerSlot &layer = _layers.slots[detail::TOAST_LAYER];
+        bool composite = staticContent && layer.ready && layer.rect.w == layerW && layer.rect.h == layerH;
+
+        if (!composite)
         {
-            const int16_t iconX = (int16_t)(boxX + padH);
-            const int16_t iconY = (int16_t)(boxY + (drawH - iconSide) / 2);
-            drawIcon()
-                .pos(iconX, iconY)
-                .size((uint16_t)iconSide)
-                .icon(_toast.iconId)
-                .color(0xFFFF)
-                .bgColor(bgColor)
-                .draw();
-            textX = (int16_t)(iconX + iconSide + iconGap);
-        }
-        else if (hasIcon)
-        {
-            const int16_t iconX = (int16_t)(boxX + (drawW - iconSide) / 2);
-            const int16_t iconY = (int16_t)(boxY + (drawH - iconSide) / 2);
-            drawIcon()
-                .pos(iconX, iconY)
-                .size((uint16_t)iconSide)
-                .icon(_toast.iconId)
-                .color(0xFFFF)
-                .bgColor(bgColor)
-                .draw();
-        }
+            const bool cached = staticContent &&
+                                beginAlphaLayerSlot(detail::TOAST_LAYER, 0, 0, layerW, layerH, LayerAlpha::Gray8);
+            // Drawn white on black into the layer, so luma reads back as coverage.
+            const uint16_t contentFg = cached ? 0xFFFF : fgColor;
+            const uint16_t contentBg = cached ? 0x0000 : bgColor;
+            const int16_t originX = cached ? (int16_t)(-layerX) : boxX;
+            const int16_t originY = cached ? (int16_t)(-layerY) : boxY;
+
+            int16_t textX = originX + (drawW - tw) / 2;
+            const int16_t textY = originY + (drawH - th) / 2;
+
+            if (hasIcon && hasText)
+            {
+                const int16_t iconX = (int16_t)(originX + padH);
+                const int16_t iconY = (int16_t)(originY + (drawH - iconSide) / 2);
+                drawIcon()
+                    .pos(iconX, iconY)
+                    .size((uint16_t)iconSide)
+                    .icon(_toast.iconId)
+                    .color(contentFg)
+                    .bgColor(contentBg)
+                    .draw();
+                textX = (int16_t)(iconX + iconSide + iconGap);
+            }
+            else if (hasIcon)
+            {
+                const int16_t iconX = (int16_t)(originX + (drawW - iconSide) / 2);
+                const int16_t iconY = (int16_t)(originY + (drawH - iconSide) / 2);
+                drawIcon()
+                    .pos(iconX, iconY)
+                    .size((uint16_t)iconSide)
+                    .icon(_toast.iconId)
+                    .color(contentFg)
+                    .bgColor(contentBg)
+                    .draw();
+            }
 
-        if (hasText)
-        {
-            MarqueeTextOptions marqueeOpts;
-            marqueeOpts.speedPxPerSec = 24;
-            marqueeOpts.holdStartMs = 700;
-            marqueeOpts.phaseStartMs = _toast.startMs;
+            if (hasText)
+            {
+                MarqueeTextOptions marqueeOpts;
+                marqueeOpts.speedPxPerSec = 24;
+                marqueeOpts.holdStartMs = 700;
+                marqueeOpts.phaseStartMs = _toast.startMs;
+
+                if (!drawTextMarquee(_toast.text, textX, textY, textMaxW, contentFg, TextAlign::Left, marqueeOpts) &&
+                    !drawTextEllipsized(_toast.text, textX, textY, textMaxW, contentFg, TextAlign::Left))
+                {
+                    drawTextAligned(_toast.text, textX, textY, contentFg, contentBg, TextAlign::Left);
+                }
+            }
 
-            if (!drawTextMarquee(_toast.text, textX, textY, textMaxW, fgColor, TextAlign::Left, marqueeOpts) &&
-                !drawTextEllipsized(_toast.text, textX, textY, textMaxW, fgColor, TextAlign::Left))
+            if (cached)
             {
-                drawTextAligned(_toast.text, textX, textY, fgColor, bgColor, TextAlign::Left);
+                endLayer();
+                composite = true;
             }
         }
 
+        if (composite)
+            compositeAlphaLayerSlot(detail::TOAST_LAYER, fgColor, 255, (int16_t)(boxX + layerX), (int16_t)(boxY + layerY));
+
         _flags.inSpritePass = prevRender;
         _render.activeSprite = prevActive;
         setFontWeight(prevWeight);
@@ -139,15 +139,9 @@ namespace pipgui
         const uint16_t fg565 = detail::color888To565(fgColor);
         const uint16_t bg565 = detail::color888To565(bgColor);
 
-        pipcore::Sprite *spr = getDrawTarget();
-        const ClipState prevGuiClip = _clip;
-        int32_t clipX = 0, clipY = 0, clipW = 0, clipH = 0;
-        if (spr)
-        {
-            spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
-            applyClip(x, y, w, h);
-            spr->setClipRect(x, y, w, h);
-        }
+        const bool clipped = getDrawTarget() != nullptr;
+        if (clipped)
+            pushClip(x, y, w, h);
 
         for (uint8_t i = 0; i < count; ++i)
         {
@@ -179,11 +173,8 @@ namespace pipgui
             requestRedraw();
         }
 
-        if (spr)
-        {
-            _clip = prevGuiClip;
-            spr->setClipRect((int16_t)clipX, (int16_t)clipY, (int16_t)clipW, (int16_t)clipH);
-        }
+        if (clipped)
+            popClip();
         setFontSize(savePx);
         setFontWeight(saveWeight);
     }
@@ -246,15 +237,9 @@ namespace pipgui
         const uint16_t fg565 = detail::color888To565(fgColor);
         const uint16_t bg565 = detail::color888To565(bgColor);
 
-        pipcore::Sprite *spr = getDrawTarget();
-        const ClipState prevGuiClip = _clip;
-        int32_t clipX = 0, clipY = 0, clipW = 0, clipH = 0;
-        if (spr)
-        {
-            spr->getClipRect(&clipX, &clipY, &clipW, &clipH);
-            applyClip(x, y, w, h);
-            spr->setClipRect(x, y, w, h);
-        }
+        const bool clipped = getDrawTarget() != nullptr;
+        if (clipped)
+            pushClip(x, y, w, h);
 
         for (uint8_t i = 0; i < count; ++i)
         {
@@ -285,11 +270,8 @@ namespace pipgui
             requestRedraw();
         }
 
-        if (spr)
-        {
-            _clip = prevGuiClip;
-            spr->setClipRect((int16_t)clipX, (int16_t)clipY, (int16_t)clipW, (int16_t)clipH);
-        }
+        if (clipped)
+            popClip();
         setFontSize(savePx);
         setFontWeight(saveWeight);
     }
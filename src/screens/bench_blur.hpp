@@ -0,0 +1,42 @@
+SCREEN(benchBlur, 46)
+{
+  const uint16_t bg565 = ui.rgb(20, 20, 28);
+  static constexpr uint8_t kReps = 4;
+  static const uint8_t kRadii[] = {2, 4, 8, 12, 16, 24, 32};
+
+  uint32_t blurUs[sizeof(kRadii) / sizeof(kRadii[0])];
+  const int16_t w = (int16_t)ui.screenWidth();
+  const int16_t h = (int16_t)ui.screenHeight();
+
+  for (uint8_t i = 0; i < sizeof(kRadii) / sizeof(kRadii[0]); ++i)
+  {
+    blurUs[i] = 0;
+    for (uint8_t n = 0; n < kReps; ++n)
+    {
+      // Redrawing inside the screen pass is invisible to the blur cache, so drop it by hand;
+      // otherwise every rep after the first would only composite the cached result.
+      for (int16_t y = 0; y < h; y += 20)
+        ui.drawRect().pos(0, y).size(w, 20).fill(((y / 20) & 1) ? ui.rgb(0, 87, 250) : ui.rgb(250, 180, 40));
+      for (int16_t x = 8; x < w; x += 40)
+        ui.drawRect().pos(x, 0).size(12, h).fill(ui.rgb(255, 255, 255));
+      ui.invalidateBlurCache();
+
+      const uint32_t tStart = micros();
+      ui.drawBlur().pos(0, 0).size(w, h).radius(kRadii[i]);
+      blurUs[i] += micros() - tStart;
+    }
+  }
+
+  ui.clear(bg565);
+  ui.setTextStyle(H2);
+  ui.drawText().text("Blur Bench").pos(-1, 6).color(ui.rgb(255, 255, 255)).bgColor(bg565).align(Center);
+  ui.setTextStyle(Caption);
+  ui.drawText().text("full screen, us per call").pos(-1, 28).color(ui.rgb(180, 180, 200)).bgColor(bg565).align(Center);
+
+  char buf[48];
+  for (uint8_t i = 0; i < sizeof(kRadii) / sizeof(kRadii[0]); ++i)
+  {
+    snprintf(buf, sizeof(buf), "r=%d  %lu", (int)kRadii[i], (unsigned long)(blurUs[i] / kReps));
+    ui.drawText().text(buf).pos(-1, (int16_t)(52 + i * 22)).color(ui.rgb(220, 220, 220)).bgColor(bg565).align(Center);
+  }
+}
@@ -50,6 +50,16 @@ void updateGlowDemoFrame(uint32_t nowMs)
       .fillColor(ui.rgb(255, 180, 0))
       .glowSize(16)
       .glowStrength(180);
+
+  ui.updateGlowRoundRect()
+      .pos(244, 74)
+      .size(56, 40)
+      .radius(12)
+      .fillColor(ui.rgb(200, 80, 255))
+      .glowSize(14)
+      .glowStrength(220)
+      .anim(Pulse)
+      .pulseMs(1100);
 }
 
 void updateBlurDemoFrame(uint32_t nowMs)
@@ -407,7 +417,9 @@ void updateFirmwareUpdateScreen(uint32_t nowMs, bool nextPressed, bool nextDown,
       }
       else if (st.state == OtaState::Success)
       {
+#if !defined(PIPCORE_HOST)
         ESP.restart();
+#endif
       }
       else
       {
@@ -35,8 +35,26 @@ SCREEN(glow, 2)
       .glowSize(16)
       .glowStrength(180);
 
+  ui.drawGlowRoundRect()
+      .pos(244, 74)
+      .size(56, 40)
+      .radius(12)
+      .fillColor(ui.rgb(200, 80, 255))
+      .glowSize(14)
+      .glowStrength(220)
+      .anim(Pulse)
+      .pulseMs(1100);
+
+  ui.drawGlowSquircleRect()
+      .pos(248, 156)
+      .size(48, 48)
+      .radius(20)
+      .fillColor(ui.rgb(0, 220, 220))
+      .glowSize(14)
+      .glowStrength(200);
+
   ui.setTextStyle(H2);
   ui.drawText().text("Glow demo").pos(-1, 22).color(color565To888(0xFFFF)).bgColor(bg565).align(Center);
   ui.setTextStyle(Body);
-  ui.drawText().text("Circles only").pos(-1, 44).color(ui.rgb(200, 200, 200)).bgColor(bg565).align(Center);
+  ui.drawText().text("Circles, rects, squircles").pos(-1, 44).color(ui.rgb(200, 200, 200)).bgColor(bg565).align(Center);
 }
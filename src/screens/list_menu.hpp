@@ -36,6 +36,7 @@ SCREEN(listMenu, 7)
           listItem("Test: Circles", "drawCircle fill / border", testCircles),
           listItem("Test: RoundRects", "1 & 4 radius variants", testRoundRects),
           listItem("Test: Ellipses", "Wu-style AA ellipses", testEllipses),
+          listItem("Bench: Blur", "full-screen blur time by radius", benchBlur),
           listItem("Test: Triangles", "4x subpixel AA triangles", testTriangles),
           listItem("Test: Arcs+Lines", "sqrt_fraction AA", testArcsAndLines),
           listItem("Test: All Grid", "All primitives comparison", testAllPrimitivesGrid),
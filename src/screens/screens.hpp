@@ -25,6 +25,7 @@
 #include "test_circles.hpp"
 #include "test_round_rects.hpp"
 #include "test_ellipses.hpp"
+#include "bench_blur.hpp"
 #include "test_triangles.hpp"
 #include "test_arcs_and_lines.hpp"
 #include "test_all_primitives_grid.hpp"
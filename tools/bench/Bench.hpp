@@ -0,0 +1,80 @@
+#pragma once
+
+#include <pipGUI/Graphics/Draw/Internal.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace bench
+{
+    constexpr int16_t kWidth = 320;
+    constexpr int16_t kHeight = 240;
+
+    struct Frame
+    {
+        std::vector<uint16_t> pixels = std::vector<uint16_t>((size_t)kWidth * kHeight);
+
+        pipgui::Surface565 surface()
+        {
+            return {pixels.data(), kWidth, 0, 0, kWidth - 1, kHeight - 1};
+        }
+
+        void fill(uint16_t color565)
+        {
+            const uint16_t swapped = pipcore::Sprite::swap16(color565);
+            for (uint16_t &p : pixels)
+                p = swapped;
+        }
+    };
+
+    template <typename Fn>
+    inline double timeUs(int reps, Fn fn)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < reps; ++i)
+            fn();
+        const auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(t1 - t0).count() / reps;
+    }
+
+    struct Diff
+    {
+        uint32_t pixels = 0;
+        uint32_t maxChannel = 0;
+    };
+
+    // Largest per-channel difference of two 565 pixels, scaled to 0..255.
+    inline uint32_t channelDiff(uint16_t pa, uint16_t pb)
+    {
+        const uint32_t dr = (uint32_t)std::abs((int)(pa >> 11) - (int)(pb >> 11)) * 255 / 31;
+        const uint32_t dg = (uint32_t)std::abs((int)((pa >> 5) & 63) - (int)((pb >> 5) & 63)) * 255 / 63;
+        const uint32_t db = (uint32_t)std::abs((int)(pa & 31) - (int)(pb & 31)) * 255 / 31;
+        return std::max({dr, dg, db});
+    }
+
+    inline void accumulate(Diff &d, uint16_t pa, uint16_t pb)
+    {
+        if (pa == pb)
+            return;
+        const uint32_t m = channelDiff(pa, pb);
+        ++d.pixels;
+        if (m > d.maxChannel)
+            d.maxChannel = m;
+    }
+
+    inline Diff compare(const Frame &a, const Frame &b)
+    {
+        Diff d;
+        for (size_t i = 0; i < a.pixels.size(); ++i)
+            accumulate(d, pipcore::Sprite::swap16(a.pixels[i]), pipcore::Sprite::swap16(b.pixels[i]));
+        return d;
+    }
+
+    inline uint32_t lcg(uint32_t &state)
+    {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+}
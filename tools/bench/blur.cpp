@@ -0,0 +1,293 @@
+// Full-screen drawBlur() on a 320x240 GUI against the box prefix-sum pipeline the stack blur
+// replaced. The old pipeline (2x2 downsample, two box passes per axis, nearest write-back) lives
+// only here; both sides blur the same backdrop without material and only the blur call is timed.
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -DPIPCORE_HOST -Ilib/pipKit -pthread -o blur
+//       tools/bench/blur.cpp $(find lib/pipKit -name '*.cpp' -not -path '*/ESP32/*')
+//   ./blur
+// Edges differ by design: the box kernel renormalises where it is cut, the stack blur repeats the
+// border pixel. "inner max" skips a 2 * radius margin along the screen edge.
+
+#include "Bench.hpp"
+#include <pipKit.hpp>
+#include <pipCore/Platforms/Host/Platform.hpp>
+#include <cstring>
+
+namespace
+{
+    constexpr int kReps = 40;
+
+    // 65536 / n rounded to nearest, as the library's inv16 table held it.
+    inline uint32_t inv16(uint32_t n)
+    {
+        return (65536u + n / 2) / n;
+    }
+
+    // The pre-stack-blur drawBlurRegion() for a region that fills the screen and has no gradient or
+    // material: 2x2 downsample, two box passes of radiusSmall per axis over prefix sums (renormalised
+    // where the box is cut by the grid edge), nearest write-back. The loops and per-call lookup
+    // tables are the library's as they were, so both sides pay the same setup; buffers are sized
+    // once per radius, as the library borrowed them from the blur work block.
+    struct BoxBlur
+    {
+        uint8_t radius = 0;
+        int16_t sw = 0, sh = 0;
+        std::vector<uint16_t> smallIn, smallTmp, cached;
+        std::vector<uint32_t> rowR, rowG, rowB, colR, colG, colB;
+        std::vector<int16_t> sampleX0, sampleX1;
+        std::vector<int32_t> sampleRow0, sampleRow1;
+        std::vector<uint16_t> sampleXLookup, blurXa, blurXb, blurYa, blurYb;
+        std::vector<uint32_t> sampleYLookup, blurInvX, blurInvY;
+
+        explicit BoxBlur(uint8_t r) : radius(r)
+        {
+            sw = (int16_t)((bench::kWidth + r * 2 + 1) >> 1);
+            sh = (int16_t)((bench::kHeight + r * 2 + 1) >> 1);
+            const size_t len = (size_t)sw * sh;
+            smallIn.resize(len), smallTmp.resize(len), cached.resize(len);
+            rowR.resize(sw + 1), rowG.resize(sw + 1), rowB.resize(sw + 1);
+            colR.resize(sh + 1), colG.resize(sh + 1), colB.resize(sh + 1);
+            sampleX0.resize(sw), sampleX1.resize(sw), sampleRow0.resize(sh), sampleRow1.resize(sh);
+            sampleXLookup.resize(bench::kWidth), sampleYLookup.resize(bench::kHeight);
+            blurXa.resize(sw), blurXb.resize(sw), blurInvX.resize(sw);
+            blurYa.resize(sh), blurYb.resize(sh), blurInvY.resize(sh);
+        }
+
+        void run(uint16_t *screenBuf)
+        {
+            const int16_t x = 0, y = 0, w = bench::kWidth, h = bench::kHeight, stride = bench::kWidth;
+            const int32_t clipX = 0, clipY = 0, clipR = w - 1, clipB = h - 1;
+            const int16_t sampleX = (int16_t)(x - radius);
+            const int16_t sampleY = (int16_t)(y - radius);
+            const int16_t sampleW = (int16_t)(w + radius * 2);
+            const int16_t sampleH = (int16_t)(h + radius * 2);
+
+            auto swap16 = [](uint16_t v)
+            { return (uint16_t)((v >> 8) | (v << 8)); };
+            auto read565 = [&](int32_t i)
+            { return swap16(screenBuf[i]); };
+            auto write565 = [&](int32_t i, uint16_t c)
+            { screenBuf[i] = swap16(c); };
+
+            for (int16_t sx = 0; sx < sw; ++sx)
+            {
+                int16_t x0 = sampleX + (sx << 1);
+                int16_t x1 = (x0 + 1 < sampleX + sampleW) ? (int16_t)(x0 + 1) : x0;
+                x0 = (int16_t)std::min<int32_t>(std::max<int32_t>(x0, clipX), clipR);
+                x1 = (int16_t)std::min<int32_t>(std::max<int32_t>(x1, clipX), clipR);
+                sampleX0[sx] = x0;
+                sampleX1[sx] = x1;
+            }
+            for (int16_t sy = 0; sy < sh; ++sy)
+            {
+                int16_t y0 = sampleY + (sy << 1);
+                int16_t y1 = (y0 + 1 < sampleY + sampleH) ? (int16_t)(y0 + 1) : y0;
+                y0 = (int16_t)std::min<int32_t>(std::max<int32_t>(y0, clipY), clipB);
+                y1 = (int16_t)std::min<int32_t>(std::max<int32_t>(y1, clipY), clipB);
+                sampleRow0[sy] = (int32_t)y0 * stride;
+                sampleRow1[sy] = (int32_t)y1 * stride;
+            }
+
+            for (int16_t sy = 0; sy < sh; ++sy)
+            {
+                const int32_t row0 = sampleRow0[sy];
+                const int32_t row1 = sampleRow1[sy];
+                for (int16_t sx = 0; sx < sw; ++sx)
+                {
+                    const int16_t x0 = sampleX0[sx];
+                    const int16_t x1 = sampleX1[sx];
+                    const uint16_t c00 = read565(row0 + x0);
+                    const uint16_t c10 = read565(row0 + x1);
+                    const uint16_t c01 = read565(row1 + x0);
+                    const uint16_t c11 = read565(row1 + x1);
+                    smallIn[(uint32_t)sy * sw + sx] = (uint16_t)(((((c00 >> 11) + (c10 >> 11) + (c01 >> 11) + (c11 >> 11)) >> 2) << 11) |
+                                                                 (((((c00 >> 5) & 0x3F) + ((c10 >> 5) & 0x3F) + ((c01 >> 5) & 0x3F) + ((c11 >> 5) & 0x3F)) >> 2) << 5) |
+                                                                 (((c00 & 0x1F) + (c10 & 0x1F) + (c01 & 0x1F) + (c11 & 0x1F)) >> 2));
+                }
+            }
+
+            const uint8_t radiusSmall = (uint8_t)((radius + 1) >> 1);
+            for (int16_t ix = 0; ix < sw; ++ix)
+            {
+                const uint16_t xa = (uint16_t)((ix > radiusSmall) ? (ix - radiusSmall) : 0);
+                const uint16_t xb = (uint16_t)std::min<int16_t>(sw - 1, ix + radiusSmall);
+                blurXa[ix] = xa;
+                blurXb[ix] = (uint16_t)(xb + 1);
+                blurInvX[ix] = inv16(xb - xa + 1);
+            }
+            for (int16_t iy = 0; iy < sh; ++iy)
+            {
+                const uint16_t ya = (uint16_t)((iy > radiusSmall) ? (iy - radiusSmall) : 0);
+                const uint16_t yb = (uint16_t)std::min<int16_t>(sh - 1, iy + radiusSmall);
+                blurYa[iy] = ya;
+                blurYb[iy] = (uint16_t)(yb + 1);
+                blurInvY[iy] = inv16(yb - ya + 1);
+            }
+
+            auto blurH = [&]()
+            {
+                for (int16_t iy = 0; iy < sh; ++iy)
+                {
+                    const uint32_t off = (uint32_t)iy * sw;
+                    rowR[0] = rowG[0] = rowB[0] = 0;
+                    for (int16_t ix = 0; ix < sw; ++ix)
+                    {
+                        uint16_t c = smallIn[off + ix];
+                        rowR[ix + 1] = rowR[ix] + ((c >> 11) & 0x1F);
+                        rowG[ix + 1] = rowG[ix] + ((c >> 5) & 0x3F);
+                        rowB[ix + 1] = rowB[ix] + (c & 0x1F);
+                    }
+                    for (int16_t ix = 0; ix < sw; ++ix)
+                    {
+                        const uint16_t xa = blurXa[ix];
+                        const uint16_t xb1 = blurXb[ix];
+                        const uint32_t inv = blurInvX[ix];
+                        smallTmp[off + ix] = (uint16_t)(((((rowR[xb1] - rowR[xa]) * inv) >> 16) << 11) |
+                                                        ((((rowG[xb1] - rowG[xa]) * inv) >> 16) << 5) |
+                                                        (((rowB[xb1] - rowB[xa]) * inv) >> 16));
+                    }
+                }
+            };
+            auto blurV = [&]()
+            {
+                for (int16_t ix = 0; ix < sw; ++ix)
+                {
+                    colR[0] = colG[0] = colB[0] = 0;
+                    for (int16_t iy = 0; iy < sh; ++iy)
+                    {
+                        uint16_t c = smallTmp[(uint32_t)iy * sw + ix];
+                        colR[iy + 1] = colR[iy] + ((c >> 11) & 0x1F);
+                        colG[iy + 1] = colG[iy] + ((c >> 5) & 0x3F);
+                        colB[iy + 1] = colB[iy] + (c & 0x1F);
+                    }
+                    for (int16_t iy = 0; iy < sh; ++iy)
+                    {
+                        const uint16_t ya = blurYa[iy];
+                        const uint16_t yb1 = blurYb[iy];
+                        const uint32_t inv = blurInvY[iy];
+                        smallIn[(uint32_t)iy * sw + ix] = (uint16_t)(((((colR[yb1] - colR[ya]) * inv) >> 16) << 11) |
+                                                                     ((((colG[yb1] - colG[ya]) * inv) >> 16) << 5) |
+                                                                     (((colB[yb1] - colB[ya]) * inv) >> 16));
+                    }
+                }
+            };
+            blurH();
+            blurV();
+            blurH();
+            blurV();
+            // A full recompute also refreshed the region's blur cache slot.
+            memcpy(cached.data(), smallIn.data(), smallIn.size() * sizeof(uint16_t));
+
+            const int32_t sampleBaseX = x - sampleX;
+            for (int16_t ix = 0; ix < w; ++ix)
+                sampleXLookup[ix] = (uint16_t)std::min((sampleBaseX + ix) >> 1, (int32_t)sw - 1);
+            for (int16_t iy = 0; iy < h; ++iy)
+                sampleYLookup[iy] = (uint32_t)std::min(((int32_t)(y + iy) - sampleY) >> 1, (int32_t)sh - 1) * (uint32_t)sw;
+
+            const uint16_t *blurred = smallIn.data();
+            for (int16_t iy = 0; iy < h; ++iy)
+            {
+                const int32_t screenOff = (int32_t)(y + iy) * stride + x;
+                const uint32_t sampleYOff = sampleYLookup[iy];
+                for (int16_t ix = 0; ix < w; ++ix)
+                    write565(screenOff + ix, blurred[sampleYOff + sampleXLookup[ix]]);
+            }
+        }
+    };
+
+    pipgui::GUI ui;
+    uint8_t g_radius = 0;
+    bool g_blur = false;
+    const bench::Frame *g_backdrop = nullptr;
+    bench::Frame g_boxOut;
+    double g_boxUs = 0;
+    double g_stackUs = 0;
+
+    void drawBackdrop(pipgui::GUI &gui)
+    {
+        for (int16_t y = 0; y < bench::kHeight; y += 20)
+            gui.drawRect().pos(0, y).size(bench::kWidth, 20).fill(((y / 20) & 1) ? 0x02BF : 0xFDA5);
+        for (int16_t x = 8; x < bench::kWidth; x += 40)
+            gui.drawRect().pos(x, 0).size(12, bench::kHeight).fill(0xFFFF);
+        uint32_t seed = 0xB1A2u;
+        for (int i = 0; i < 48; ++i)
+            gui.drawCircle().pos((int16_t)(bench::lcg(seed) % bench::kWidth), (int16_t)(bench::lcg(seed) % bench::kHeight))
+                .radius((int16_t)(2 + bench::lcg(seed) % 9))
+                .fill((uint16_t)bench::lcg(seed));
+    }
+
+    // Both sides run in the same render pass, one rep of each in turn, so load on the host hits
+    // them alike; the best rep is reported.
+    SCREEN(blurBench, 0)
+    {
+        drawBackdrop(ui);
+        if (!g_blur)
+            return;
+        BoxBlur box(g_radius);
+        g_boxUs = g_stackUs = 1e12;
+        for (int rep = 0; rep < kReps; ++rep)
+        {
+            // Start from the same backdrop and make the blur cache recompute the whole grid.
+            drawBackdrop(ui);
+            ui.invalidateBlurCache();
+            g_stackUs = std::min(g_stackUs, bench::timeUs(1, [&]
+                                                          { ui.drawBlur().pos(0, 0).size(bench::kWidth, bench::kHeight).radius(g_radius).material(0, -1); }));
+
+            g_boxOut = *g_backdrop;
+            g_boxUs = std::min(g_boxUs, bench::timeUs(1, [&]
+                                                      { box.run(g_boxOut.pixels.data()); }));
+        }
+    }
+
+    void present(pipcore::host::Platform *plat, bench::Frame &out)
+    {
+        plat->advanceMs(16);
+        ui.requestRedraw();
+        ui.loop();
+        for (int16_t y = 0; y < bench::kHeight; ++y)
+            for (int16_t x = 0; x < bench::kWidth; ++x)
+                out.pixels[(size_t)y * bench::kWidth + x] = pipcore::Sprite::swap16(plat->framebuffer().pixel565(x, y));
+    }
+}
+
+int main()
+{
+    auto *plat = static_cast<pipcore::host::Platform *>(pipcore::GetPlatform());
+    plat->setNowMs(0);
+    ui.configDisplay().pins({11, 12, 10, 9, 14}).size(bench::kWidth, bench::kHeight);
+    ui.begin(0);
+    ui.setScreen(blurBench);
+
+    bench::Frame backdrop;
+    present(plat, backdrop);
+    g_backdrop = &backdrop;
+
+    static const uint8_t radii[] = {2, 4, 8, 12, 16, 24, 32};
+    std::printf("%6s %10s %10s %8s %10s %8s %10s\n",
+                "radius", "box us", "stack us", "speedup", "diff px", "max diff", "inner max");
+
+    for (uint8_t radius : radii)
+    {
+        bench::Frame stackOut;
+        g_radius = radius;
+        g_blur = true;
+        present(plat, stackOut);
+        g_blur = false;
+
+        const int16_t margin = (int16_t)(radius * 2);
+        bench::Diff all, inner;
+        for (int16_t y = 0; y < bench::kHeight; ++y)
+            for (int16_t x = 0; x < bench::kWidth; ++x)
+            {
+                const size_t i = (size_t)y * bench::kWidth + x;
+                const uint16_t a = pipcore::Sprite::swap16(g_boxOut.pixels[i]);
+                const uint16_t b = pipcore::Sprite::swap16(stackOut.pixels[i]);
+                bench::accumulate(all, a, b);
+                if (x >= margin && x < bench::kWidth - margin && y >= margin && y < bench::kHeight - margin)
+                    bench::accumulate(inner, a, b);
+            }
+        std::printf("%6u %10.1f %10.1f %7.2fx %10u %8u %10u\n",
+                    radius, g_boxUs, g_stackUs, g_boxUs / g_stackUs, all.pixels, all.maxChannel, inner.maxChannel);
+    }
+    return 0;
+}
@@ -0,0 +1,167 @@
+// fill/drawEllipse on a 320x240 host GUI against a per-pixel bounding-box rasterizer that lives
+// only in this file: every pixel of the box evaluates the implicit ellipse in float and turns
+// its first-order distance into coverage. That is the approach the span rasterizer stands in
+// for; the library has not shipped it, so the ratio shows what the spans buy rather than a
+// before/after. Both sides draw in the same render pass, one rep of each in turn, and the best
+// rep is reported. Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -DPIPCORE_HOST -Ilib/pipKit -pthread -o ellipse
+//       tools/bench/ellipse.cpp $(find lib/pipKit -name '*.cpp' -not -path '*/ESP32/*')
+//   ./ellipse
+
+#include "Bench.hpp"
+#include <pipKit.hpp>
+#include <pipCore/Platforms/Host/Platform.hpp>
+
+namespace
+{
+    using pipgui::Color565;
+    using pipgui::Surface565;
+
+    constexpr int kReps = 20;
+    constexpr int kEllipses = 32;
+
+    struct Ellipse
+    {
+        int16_t cx, cy, rx, ry;
+        uint16_t color;
+    };
+
+    std::vector<Ellipse> makeEllipses(int16_t radius)
+    {
+        std::vector<Ellipse> out;
+        uint32_t seed = 0xE111u + (uint32_t)radius;
+        uint16_t color = 0x07E0;
+        for (int i = 0; i < kEllipses; ++i)
+        {
+            Ellipse e;
+            e.rx = (int16_t)(radius - (int16_t)(bench::lcg(seed) % (uint32_t)(radius / 4 + 1)));
+            e.ry = (int16_t)(e.rx * 2 / 3 + 1);
+            e.cx = (int16_t)(bench::lcg(seed) % bench::kWidth);
+            e.cy = (int16_t)(bench::lcg(seed) % bench::kHeight);
+            e.color = color;
+            color = (uint16_t)(color * 31u + 0x1863u);
+            out.push_back(e);
+        }
+        return out;
+    }
+
+    void drawReference(bench::Frame &f, const Ellipse &e, bool fill)
+    {
+        const Surface565 s = f.surface();
+        const Color565 c = pipgui::makeColor565(e.color);
+        const uint8_t *gamma = pipgui::gammaTable();
+        const float irx2 = 1.0f / ((float)e.rx * e.rx), iry2 = 1.0f / ((float)e.ry * e.ry);
+        const int32_t x0 = std::max<int32_t>(e.cx - e.rx - 1, s.clipX), x1 = std::min<int32_t>(e.cx + e.rx + 1, s.clipR);
+        const int32_t y0 = std::max<int32_t>(e.cy - e.ry - 1, s.clipY), y1 = std::min<int32_t>(e.cy + e.ry + 1, s.clipB);
+        for (int32_t py = y0; py <= y1; ++py)
+        {
+            uint16_t *row = s.row(py);
+            const float fy = (float)(py - e.cy);
+            for (int32_t px = x0; px <= x1; ++px)
+            {
+                const float fx = (float)(px - e.cx);
+                const float gx = fx * irx2, gy = fy * iry2;
+                const float grad = 2.0f * sqrtf(gx * gx + gy * gy);
+                const float value = fx * gx + fy * gy - 1.0f;
+                const float d = (grad > 0.0f) ? value / grad : -1.0f;
+                const uint8_t a = pipgui::alphaSdfAA(fill ? d : fabsf(d) - 0.5f);
+                if (a == 255)
+                    row[px] = c.fg;
+                else if (a)
+                    pipgui::blendStore(row + px, c, gamma[a]);
+            }
+        }
+    }
+
+    void drawLibrary(pipgui::GUI &gui, const Ellipse &e, bool fill)
+    {
+        if (fill)
+            gui.drawEllipse().pos(e.cx, e.cy).radiusX(e.rx).radiusY(e.ry).fill(e.color);
+        else
+            gui.drawEllipse().pos(e.cx, e.cy).radiusX(e.rx).radiusY(e.ry).border(1, e.color);
+    }
+
+    pipgui::GUI ui;
+    const std::vector<Ellipse> *g_list = nullptr;
+    bool g_fill = false;
+    int g_only = -1;
+    double g_boxUs = 0;
+    double g_spanUs = 0;
+
+    SCREEN(ellipseBench, 0)
+    {
+        ui.drawRect().pos(0, 0).size(bench::kWidth, bench::kHeight).fill(0x0000);
+        if (!g_list)
+            return;
+        if (g_only >= 0)
+        {
+            drawLibrary(ui, (*g_list)[g_only], g_fill);
+            return;
+        }
+
+        bench::Frame ref;
+        g_boxUs = g_spanUs = 1e12;
+        for (int rep = 0; rep < kReps; ++rep)
+        {
+            g_spanUs = std::min(g_spanUs, bench::timeUs(1, [&]
+                                                        { for (const Ellipse &e : *g_list) drawLibrary(ui, e, g_fill); }));
+            g_boxUs = std::min(g_boxUs, bench::timeUs(1, [&]
+                                                      { for (const Ellipse &e : *g_list) drawReference(ref, e, g_fill); }));
+        }
+    }
+
+    void present(pipcore::host::Platform *plat, bench::Frame &out)
+    {
+        plat->advanceMs(16);
+        ui.requestRedraw();
+        ui.loop();
+        for (int16_t y = 0; y < bench::kHeight; ++y)
+            for (int16_t x = 0; x < bench::kWidth; ++x)
+                out.pixels[(size_t)y * bench::kWidth + x] = pipcore::Sprite::swap16(plat->framebuffer().pixel565(x, y));
+    }
+}
+
+int main()
+{
+    auto *plat = static_cast<pipcore::host::Platform *>(pipcore::GetPlatform());
+    plat->setNowMs(0);
+    ui.configDisplay().pins({11, 12, 10, 9, 14}).size(bench::kWidth, bench::kHeight);
+    ui.begin(0);
+    ui.setScreen(ellipseBench);
+
+    static const int16_t radii[] = {4, 8, 16, 32, 64, 100};
+    std::printf("%-7s %6s %12s %12s %8s %10s %8s\n",
+                "mode", "radius", "box us", "span us", "speedup", "diff px", "max diff");
+
+    bench::Frame frame;
+    for (int mode = 0; mode < 2; ++mode)
+        for (int16_t radius : radii)
+        {
+            const std::vector<Ellipse> list = makeEllipses(radius);
+            g_list = &list;
+            g_fill = (mode == 1);
+            g_only = -1;
+            present(plat, frame);
+
+            // Deviation is measured per ellipse on a clear frame so overlapping AA edges do not
+            // add up.
+            bench::Diff d;
+            for (int i = 0; i < kEllipses; ++i)
+            {
+                g_only = i;
+                present(plat, frame);
+                bench::Frame ref;
+                ref.fill(0x0000);
+                drawReference(ref, list[i], g_fill);
+                const bench::Diff di = bench::compare(ref, frame);
+                d.pixels += di.pixels;
+                if (di.maxChannel > d.maxChannel)
+                    d.maxChannel = di.maxChannel;
+            }
+            std::printf("%-7s %6d %12.1f %12.1f %7.2fx %10u %8u\n",
+                        g_fill ? "fill" : "outline", radius, g_boxUs, g_spanUs,
+                        g_boxUs / g_spanUs, d.pixels, d.maxChannel);
+        }
+    g_list = nullptr;
+    return 0;
+}
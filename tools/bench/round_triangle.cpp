@@ -0,0 +1,337 @@
+// fill/drawRoundTriangle on a 320x240 host GUI against the float rasterizer the fixed-point path
+// replaced. The float path lives only here; it draws into a plain frame in the same render pass,
+// one rep of each side in turn, and the best rep is reported. The library side also pays for the
+// fluent call and its bounds checks, so the ratio is a floor.
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -DPIPCORE_HOST -Ilib/pipKit -pthread -o round_triangle
+//       tools/bench/round_triangle.cpp $(find lib/pipKit -name '*.cpp' -not -path '*/ESP32/*')
+//   ./round_triangle
+// "icon" triangles span 16-48 px, the size of arrows and badges on a 240x320 panel; "large" ones
+// span up to 140 px. The host has an FPU, so an FPU-less ESP32 (C3/C6) only widens the gap.
+
+#include "Bench.hpp"
+#include <pipKit.hpp>
+#include <pipCore/Platforms/Host/Platform.hpp>
+
+namespace
+{
+    using pipgui::Color565;
+    using pipgui::Surface565;
+
+    constexpr int kReps = 20;
+    constexpr int kTriangles = 64;
+
+    static inline float distanceSqToSegmentProjected(float dx, float dy,
+                                                     float ex, float ey,
+                                                     float invLen,
+                                                     float dot)
+    {
+        float t = dot * invLen;
+        t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        dx -= ex * t;
+        dy -= ey * t;
+        return dx * dx + dy * dy;
+    }
+
+    struct DistSqAlphaLut
+    {
+        uint8_t radius = 0xFF;
+        float minSq = 0.0f;
+        float maxSq = 1.0f;
+        float scale = 0.0f;
+        uint8_t table[513] = {};
+    };
+
+    static inline uint8_t sampleDistSqAlpha(const DistSqAlphaLut &lut, float dSq)
+    {
+        if (dSq <= lut.minSq)
+            return lut.table[0];
+        if (dSq >= lut.maxSq)
+            return lut.table[512];
+
+        int32_t idx = (int32_t)((dSq - lut.minSq) * lut.scale + 0.5f);
+        if (idx < 0)
+            idx = 0;
+        else if (idx > 512)
+            idx = 512;
+        return lut.table[idx];
+    }
+
+    template <typename AlphaFn>
+    static inline const DistSqAlphaLut &buildDistSqAlphaLut(DistSqAlphaLut &lut, uint8_t radius,
+                                                            float minRadius, float maxRadius,
+                                                            AlphaFn alphaFn)
+    {
+        if (lut.radius == radius)
+            return lut;
+
+        lut.radius = radius;
+        lut.minSq = minRadius * minRadius;
+        lut.maxSq = maxRadius * maxRadius;
+        lut.scale = (lut.maxSq > lut.minSq) ? (512.0f / (lut.maxSq - lut.minSq)) : 0.0f;
+
+        const float step = (lut.maxSq - lut.minSq) * (1.0f / 512.0f);
+        for (int32_t i = 0; i <= 512; ++i)
+            lut.table[i] = alphaFn(lut.minSq + step * i);
+        return lut;
+    }
+
+    template <bool Fill>
+    static inline const DistSqAlphaLut &roundTriangleReferenceLut(uint8_t radius)
+    {
+        static DistSqAlphaLut lut;
+        if (Fill)
+            return buildDistSqAlphaLut(
+                lut, radius, std::max(0.0f, radius - 0.5f), radius + 1.0f,
+                [&](float dSq)
+                { return pipgui::alphaSdfAA(sqrtf(dSq) - radius); });
+        return buildDistSqAlphaLut(
+            lut, radius, std::max(0.0f, radius - 1.0f), radius + 1.0f,
+            [&](float dSq)
+            { return pipgui::alphaSdfAA(fabsf(sqrtf(dSq) - radius) - 0.5f); });
+    }
+
+    // The float rasterizer as it was in Advanced.cpp: edge functions and segment distances in
+    // float for every pixel of the bounding box.
+    template <bool Fill>
+    static void rasterRoundTriangleReference(const Surface565 &s, const Color565 &c,
+                                             int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                             int16_t x2, int16_t y2, uint8_t radius,
+                                             int32_t xStart, int32_t xEnd, int32_t yStart, int32_t yEnd)
+    {
+        const float v0x = x0, v0y = y0, v1x = x1, v1y = y1, v2x = x2, v2y = y2;
+        const float e0x = v1x - v0x, e0y = v1y - v0y, inv_len0 = 1.0f / (e0x * e0x + e0y * e0y);
+        const float e1x = v2x - v1x, e1y = v2y - v1y, inv_len1 = 1.0f / (e1x * e1x + e1y * e1y);
+        const float e2x = v0x - v2x, e2y = v0y - v2y, inv_len2 = 1.0f / (e2x * e2x + e2y * e2y);
+        const float sign = (e0x * (v2y - v0y) - e0y * (v2x - v0x) < 0.0f) ? -1.0f : 1.0f;
+
+        const uint8_t *gamma = pipgui::gammaTable();
+        const DistSqAlphaLut &lut = roundTriangleReferenceLut<Fill>(radius);
+
+        for (int32_t py = yStart; py <= yEnd; ++py)
+        {
+            const float py_f = py + 0.5f;
+            const float dy0 = py_f - v0y, dy1 = py_f - v1y, dy2 = py_f - v2y;
+            uint16_t *row = s.row(py);
+            float dx0 = (float)xStart + 0.5f - v0x;
+            float dx1 = (float)xStart + 0.5f - v1x;
+            float dx2 = (float)xStart + 0.5f - v2x;
+            float c0 = e0x * dy0 - e0y * dx0;
+            float c1 = e1x * dy1 - e1y * dx1;
+            float c2 = e2x * dy2 - e2y * dx2;
+            float dot0 = dx0 * e0x + dy0 * e0y;
+            float dot1 = dx1 * e1x + dy1 * e1y;
+            float dot2 = dx2 * e2x + dy2 * e2y;
+
+            for (int32_t px = xStart; px <= xEnd; ++px)
+            {
+                const float side0 = c0 * sign;
+                const float side1 = c1 * sign;
+                const float side2 = c2 * sign;
+                if (side0 >= 0.0f && side1 >= 0.0f && side2 >= 0.0f)
+                {
+                    if (Fill)
+                        row[px] = c.fg;
+                }
+                else
+                {
+                    float dSq = 0.0f;
+                    bool hasDistance = false;
+                    if (side0 < 0.0f)
+                    {
+                        dSq = distanceSqToSegmentProjected(dx0, dy0, e0x, e0y, inv_len0, dot0);
+                        hasDistance = true;
+                    }
+                    if (side1 < 0.0f)
+                    {
+                        const float d1Sq = distanceSqToSegmentProjected(dx1, dy1, e1x, e1y, inv_len1, dot1);
+                        if (!hasDistance || d1Sq < dSq)
+                            dSq = d1Sq;
+                        hasDistance = true;
+                    }
+                    if (side2 < 0.0f)
+                    {
+                        const float d2Sq = distanceSqToSegmentProjected(dx2, dy2, e2x, e2y, inv_len2, dot2);
+                        if (!hasDistance || d2Sq < dSq)
+                            dSq = d2Sq;
+                    }
+
+                    if (Fill)
+                    {
+                        if (dSq <= lut.minSq)
+                            row[px] = c.fg;
+                        else if (dSq <= lut.maxSq)
+                        {
+                            const uint8_t a = sampleDistSqAlpha(lut, dSq);
+                            if (a == 255)
+                                row[px] = c.fg;
+                            else if (a > 0)
+                                pipgui::blendStore(row + px, c, gamma[a]);
+                        }
+                    }
+                    else if (dSq >= lut.minSq && dSq <= lut.maxSq)
+                    {
+                        const uint8_t a = sampleDistSqAlpha(lut, dSq);
+                        if (a > 0)
+                            pipgui::blendStore(row + px, c, gamma[a]);
+                    }
+                }
+
+                dx0 += 1.0f;
+                dx1 += 1.0f;
+                dx2 += 1.0f;
+                c0 -= e0y;
+                c1 -= e1y;
+                c2 -= e2y;
+                dot0 += e0x;
+                dot1 += e1x;
+                dot2 += e2x;
+            }
+        }
+    }
+
+    struct Triangle
+    {
+        int16_t v[6];
+        uint16_t color;
+    };
+
+    std::vector<Triangle> makeTriangles(uint8_t radius, int16_t minSpan, int16_t maxSpan)
+    {
+        std::vector<Triangle> out;
+        uint32_t seed = 0x5EEDu + radius + (uint32_t)maxSpan * 977u;
+        uint16_t color = 0x07E0;
+        for (int i = 0; i < kTriangles; ++i)
+        {
+            Triangle t;
+            const int16_t span = (int16_t)(minSpan + bench::lcg(seed) % (maxSpan - minSpan + 1));
+            const int16_t ox = (int16_t)(20 + bench::lcg(seed) % (bench::kWidth - 40 - span));
+            const int16_t oy = (int16_t)(20 + bench::lcg(seed) % (bench::kHeight - 40 - span));
+            for (int k = 0; k < 3; ++k)
+            {
+                t.v[k * 2] = (int16_t)(ox + bench::lcg(seed) % span);
+                t.v[k * 2 + 1] = (int16_t)(oy + bench::lcg(seed) % span);
+            }
+            t.color = color;
+            color = (uint16_t)(color * 31u + 0x1863u);
+            out.push_back(t);
+        }
+        return out;
+    }
+
+    void drawReference(bench::Frame &f, const Triangle &t, uint8_t radius, bool fill)
+    {
+        const Surface565 s = f.surface();
+        const int16_t pad = (int16_t)(radius + (fill ? 1 : 2));
+        const int32_t minX = std::max<int32_t>(std::min({t.v[0], t.v[2], t.v[4]}) - pad, s.clipX);
+        const int32_t maxX = std::min<int32_t>(std::max({t.v[0], t.v[2], t.v[4]}) + pad, s.clipR);
+        const int32_t minY = std::max<int32_t>(std::min({t.v[1], t.v[3], t.v[5]}) - pad, s.clipY);
+        const int32_t maxY = std::min<int32_t>(std::max({t.v[1], t.v[3], t.v[5]}) + pad, s.clipB);
+        const Color565 c = pipgui::makeColor565(t.color);
+        if (fill)
+            rasterRoundTriangleReference<true>(s, c, t.v[0], t.v[1], t.v[2], t.v[3], t.v[4], t.v[5], radius, minX, maxX, minY, maxY);
+        else
+            rasterRoundTriangleReference<false>(s, c, t.v[0], t.v[1], t.v[2], t.v[3], t.v[4], t.v[5], radius, minX, maxX, minY, maxY);
+    }
+
+    void drawLibrary(pipgui::GUI &gui, const Triangle &t, uint8_t radius, bool fill)
+    {
+        if (fill)
+            gui.drawTriangle().point0(t.v[0], t.v[1]).point1(t.v[2], t.v[3]).point2(t.v[4], t.v[5]).radius(radius).fill(t.color);
+        else
+            gui.drawTriangle().point0(t.v[0], t.v[1]).point1(t.v[2], t.v[3]).point2(t.v[4], t.v[5]).radius(radius).border(1, t.color);
+    }
+
+    pipgui::GUI ui;
+    const std::vector<Triangle> *g_tris = nullptr;
+    uint8_t g_radius = 0;
+    bool g_fill = false;
+    int g_only = -1;
+    double g_floatUs = 0;
+    double g_fixedUs = 0;
+
+    SCREEN(roundTriangleBench, 0)
+    {
+        ui.drawRect().pos(0, 0).size(bench::kWidth, bench::kHeight).fill(0x0000);
+        if (!g_tris)
+            return;
+        if (g_only >= 0)
+        {
+            drawLibrary(ui, (*g_tris)[g_only], g_radius, g_fill);
+            return;
+        }
+
+        bench::Frame ref;
+        g_floatUs = g_fixedUs = 1e12;
+        for (int rep = 0; rep < kReps; ++rep)
+        {
+            g_fixedUs = std::min(g_fixedUs, bench::timeUs(1, [&]
+                                                          { for (const Triangle &t : *g_tris) drawLibrary(ui, t, g_radius, g_fill); }));
+            g_floatUs = std::min(g_floatUs, bench::timeUs(1, [&]
+                                                          { for (const Triangle &t : *g_tris) drawReference(ref, t, g_radius, g_fill); }));
+        }
+    }
+
+    void present(pipcore::host::Platform *plat, bench::Frame &out)
+    {
+        plat->advanceMs(16);
+        ui.requestRedraw();
+        ui.loop();
+        for (int16_t y = 0; y < bench::kHeight; ++y)
+            for (int16_t x = 0; x < bench::kWidth; ++x)
+                out.pixels[(size_t)y * bench::kWidth + x] = pipcore::Sprite::swap16(plat->framebuffer().pixel565(x, y));
+    }
+}
+
+int main()
+{
+    auto *plat = static_cast<pipcore::host::Platform *>(pipcore::GetPlatform());
+    plat->setNowMs(0);
+    ui.configDisplay().pins({11, 12, 10, 9, 14}).size(bench::kWidth, bench::kHeight);
+    ui.begin(0);
+    ui.setScreen(roundTriangleBench);
+
+    struct Set
+    {
+        const char *name;
+        int16_t minSpan, maxSpan;
+    };
+    static const Set sets[] = {{"icon", 16, 48}, {"large", 100, 140}};
+    static const uint8_t radii[] = {1, 2, 4, 8, 16};
+    std::printf("%-6s %-7s %6s %12s %12s %8s %10s %8s\n",
+                "set", "mode", "radius", "float us", "fixed us", "speedup", "diff px", "max diff");
+
+    bench::Frame frame;
+    for (const Set &set : sets)
+        for (int mode = 0; mode < 2; ++mode)
+            for (uint8_t radius : radii)
+            {
+                const std::vector<Triangle> tris = makeTriangles(radius, set.minSpan, set.maxSpan);
+                g_tris = &tris;
+                g_radius = radius;
+                g_fill = (mode == 1);
+                g_only = -1;
+                present(plat, frame);
+
+                // Deviation is measured per triangle on a clear frame so overlapping AA edges
+                // do not add up.
+                bench::Diff d;
+                for (int i = 0; i < kTriangles; ++i)
+                {
+                    g_only = i;
+                    present(plat, frame);
+                    bench::Frame ref;
+                    ref.fill(0x0000);
+                    drawReference(ref, tris[i], radius, g_fill);
+                    const bench::Diff di = bench::compare(ref, frame);
+                    d.pixels += di.pixels;
+                    if (di.maxChannel > d.maxChannel)
+                        d.maxChannel = di.maxChannel;
+                }
+                std::printf("%-6s %-7s %6u %12.1f %12.1f %7.2fx %10u %8u\n",
+                            set.name, g_fill ? "fill" : "outline", radius, g_floatUs, g_fixedUs,
+                            g_floatUs / g_fixedUs, d.pixels, d.maxChannel);
+            }
+    g_tris = nullptr;
+    return 0;
+}